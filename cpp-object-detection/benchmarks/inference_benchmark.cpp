@@ -0,0 +1,94 @@
+/**
+ * End-to-end detect() cost per inference backend on the same ONNX model
+ *
+ * Usage: inference_benchmark MODEL.onnx [model-type] [iterations] [image] [threads]
+ * Both backends share letterbox preprocessing, decoding and NMS, so the
+ * difference between the rows is the forward pass alone. Run on the target
+ * (e.g. Raspberry Pi 4/5) with the thread count the application would use.
+ */
+#include "detection_model_interface.hpp"
+#include "logger.hpp"
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " MODEL.onnx [model-type] [iterations] [image] [threads]\n";
+        return 1;
+    }
+
+    const std::string model_path = argv[1];
+    const std::string model_name = argc > 2 ? argv[2] : "yolov5s";
+    int iterations = argc > 3 ? std::atoi(argv[3]) : 50;
+    if (iterations <= 0) {
+        iterations = 50;
+    }
+    const std::string image_path = argc > 4 ? argv[4] : "";
+    const int threads = argc > 5 ? std::max(0, std::atoi(argv[5])) : 0;
+
+    DetectionModelFactory::ModelType model_type;
+    try {
+        model_type = DetectionModelFactory::parseModelType(model_name);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    cv::Mat frame;
+    if (!image_path.empty()) {
+        frame = cv::imread(image_path);
+    }
+    if (frame.empty()) {
+        frame.create(720, 1280, CV_8UC3);
+        cv::randu(frame, cv::Scalar::all(0), cv::Scalar::all(256));
+    }
+    if (threads > 0) {
+        cv::setNumThreads(threads);
+    }
+
+    auto logger = std::make_shared<Logger>("inference_benchmark.log", false);
+
+    std::cout << "Model:        " << model_path << " (" << model_name << ")\n"
+              << "Frame:        " << frame.cols << "x" << frame.rows << "\n"
+              << "Threads:      " << (threads > 0 ? std::to_string(threads) : std::string("default")) << "\n"
+              << "Iterations:   " << iterations << "\n\n";
+
+    for (auto backend : {DetectionModelFactory::Backend::OPENCV_DNN, DetectionModelFactory::Backend::ONNX_RUNTIME}) {
+        std::string backend_name = DetectionModelFactory::backendToString(backend);
+        if (!DetectionModelFactory::isBackendAvailable(backend)) {
+            std::cout << "  " << std::left << std::setw(14) << backend_name << "not available in this build\n";
+            continue;
+        }
+
+        DetectionModelFactory::BackendOptions options;
+        options.backend = backend;
+        options.intra_op_threads = threads;
+
+        auto model = DetectionModelFactory::createModel(model_type, logger, options);
+        if (!model->initialize(model_path, "", "", 0.25, 1.0)) {
+            std::cout << "  " << std::left << std::setw(14) << backend_name << "failed to load model\n";
+            continue;
+        }
+        model->warmUp();
+
+        size_t detections = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            detections = model->detect(frame).size();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        double milliseconds = std::chrono::duration<double, std::milli>(elapsed).count() / iterations;
+
+        std::cout << "  " << std::left << std::setw(14) << backend_name
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+                  << milliseconds << " ms/frame  " << detections << " detections\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * NMS cost per frame: NmsEngine vs cv::dnn::NMSBoxes
+ *
+ * Usage: nms_benchmark [iterations]
+ * Candidate sets of 100-5,000 boxes are drawn around a few dozen object
+ * clusters across 12 classes, similar to a busy scene before NMS.
+ */
+#include "nms_engine.hpp"
+#include <opencv2/opencv.hpp>
+#include <opencv2/dnn.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr float IOU_THRESHOLD = 0.45f;
+constexpr int NUM_CLASSES = 12;
+
+struct CandidateSet {
+    std::vector<cv::Rect> boxes;
+    std::vector<float> scores;
+    std::vector<int> class_ids;
+};
+
+CandidateSet makeCandidates(int count, cv::RNG& rng) {
+    CandidateSet set;
+    const int clusters = 40;
+    std::vector<cv::Point> centers;
+    for (int c = 0; c < clusters; ++c) {
+        centers.emplace_back(rng.uniform(0, 1280), rng.uniform(0, 720));
+    }
+    for (int i = 0; i < count; ++i) {
+        const cv::Point& center = centers[rng.uniform(0, clusters)];
+        int width = rng.uniform(30, 200);
+        int height = rng.uniform(30, 200);
+        set.boxes.emplace_back(center.x - width / 2 + rng.uniform(-15, 16),
+                               center.y - height / 2 + rng.uniform(-15, 16), width, height);
+        set.scores.push_back(static_cast<float>(rng.uniform(0.25, 1.0)));
+        set.class_ids.push_back(rng.uniform(0, NUM_CLASSES));
+    }
+    return set;
+}
+
+double measureMicroseconds(int iterations, const std::function<size_t()>& body, size_t& kept) {
+    kept = body();  // Warm caches and grow scratch buffers
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        kept = body();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+void printRow(const std::string& name, double microseconds, size_t kept) {
+    std::cout << "  " << std::left << std::setw(36) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+              << microseconds << " us/frame   kept " << kept << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 200;
+    if (iterations <= 0) {
+        iterations = 200;
+    }
+
+    std::cout << "OpenCV:     " << CV_VERSION << "\n"
+              << "Iterations: " << iterations << "\n\n";
+
+    cv::RNG rng(42);
+    NmsEngine engine;
+
+    for (int count : {100, 500, 1000, 2000, 5000}) {
+        CandidateSet set = makeCandidates(count, rng);
+        std::cout << count << " candidates\n";
+        size_t kept = 0;
+
+        // Previous behaviour: one class-agnostic pass, fresh vectors every frame
+        double agnostic = measureMicroseconds(iterations, [&] {
+            std::vector<cv::Rect> boxes(set.boxes);
+            std::vector<float> scores(set.scores);
+            std::vector<int> indices;
+            cv::dnn::NMSBoxes(boxes, scores, 0.0f, IOU_THRESHOLD, indices);
+            return indices.size();
+        }, kept);
+        printRow("NMSBoxes (all classes together)", agnostic, kept);
+
+        // Same semantics as NmsEngine built from NMSBoxes
+        double per_class = measureMicroseconds(iterations, [&] {
+            std::map<int, std::pair<std::vector<cv::Rect>, std::vector<float>>> buckets;
+            for (size_t i = 0; i < set.boxes.size(); ++i) {
+                auto& bucket = buckets[set.class_ids[i]];
+                bucket.first.push_back(set.boxes[i]);
+                bucket.second.push_back(set.scores[i]);
+            }
+            size_t total = 0;
+            for (auto& entry : buckets) {
+                std::vector<int> indices;
+                cv::dnn::NMSBoxes(entry.second.first, entry.second.second, 0.0f, IOU_THRESHOLD, indices);
+                total += indices.size();
+            }
+            return total;
+        }, kept);
+        printRow("NMSBoxes (per class)", per_class, kept);
+
+        double engine_time = measureMicroseconds(iterations, [&] {
+            engine.clear();
+            for (size_t i = 0; i < set.boxes.size(); ++i) {
+                engine.add(set.boxes[i], set.scores[i], set.class_ids[i]);
+            }
+            return engine.suppress(IOU_THRESHOLD).size();
+        }, kept);
+        printRow("NmsEngine (per class)", engine_time, kept);
+        std::cout << "\n";
+    }
+
+    return 0;
+}
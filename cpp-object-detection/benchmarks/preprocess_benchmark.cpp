@@ -0,0 +1,141 @@
+/**
+ * Per-frame preprocessing cost: legacy blob path vs fused letterbox kernel
+ *
+ * Usage: preprocess_benchmark [iterations]
+ * Run on each target (e.g. Raspberry Pi 4/5 and an x86 workstation) and
+ * compare the "us/frame" columns; the SIMD line shows which instruction set
+ * OpenCV's universal intrinsics compiled to.
+ */
+#include "yolo_utils.hpp"
+#include <opencv2/opencv.hpp>
+#include <opencv2/dnn.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* architecture() {
+#if defined(__aarch64__)
+    return "arm64";
+#elif defined(__arm__)
+    return "arm";
+#elif defined(__x86_64__)
+    return "x86_64";
+#elif defined(__i386__)
+    return "x86";
+#else
+    return "unknown";
+#endif
+}
+
+const char* simdBackend() {
+#if CV_SIMD128 && CV_NEON
+    return "NEON (CV_SIMD128)";
+#elif CV_SIMD128 && CV_SSE2
+    return "SSE2+ (CV_SIMD128)";
+#elif CV_SIMD128
+    return "CV_SIMD128";
+#else
+    return "scalar";
+#endif
+}
+
+double measureMicroseconds(int iterations, const std::function<void()>& body) {
+    body();  // Warm caches and allocate persistent buffers
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        body();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+void printRow(const std::string& name, double microseconds) {
+    std::cout << "  " << std::left << std::setw(44) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+              << microseconds << " us/frame\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 200;
+    if (iterations <= 0) {
+        iterations = 200;
+    }
+
+    cv::setNumThreads(1);  // Per-worker cost; workers run in parallel
+
+    std::cout << "Architecture: " << architecture() << "\n"
+              << "SIMD:         " << simdBackend() << "\n"
+              << "OpenCV:       " << CV_VERSION << "\n"
+              << "Iterations:   " << iterations << "\n\n";
+
+    const float pixel_scale = 1.0f / 255.0f;
+    const std::vector<cv::Size> frame_sizes = {cv::Size(1280, 720), cv::Size(1920, 1080)};
+    const std::vector<double> scale_factors = {0.25, 0.5, 1.0};
+
+    for (const auto& frame_size : frame_sizes) {
+        cv::Mat frame(frame_size, CV_8UC3);
+        cv::randu(frame, cv::Scalar::all(0), cv::Scalar::all(256));
+
+        for (double scale_factor : scale_factors) {
+            int input_size = YoloUtils::computeInputSize(frame_size, scale_factor, 640);
+            auto letterbox = YoloUtils::computeLetterbox(frame_size, input_size);
+
+            std::cout << frame_size.width << "x" << frame_size.height
+                      << " @ scale " << scale_factor << " -> " << input_size << "x" << input_size << "\n";
+
+            // Original path: downscale, then blobFromImage stretches to a fixed 640x640
+            printRow("legacy resize + blobFromImage(640)", measureMicroseconds(iterations, [&] {
+                cv::Mat scaled;
+                cv::resize(frame, scaled, cv::Size(static_cast<int>(frame.cols * scale_factor),
+                                                   static_cast<int>(frame.rows * scale_factor)));
+                cv::Mat blob;
+                cv::dnn::blobFromImage(scaled, blob, pixel_scale, cv::Size(640, 640),
+                                       cv::Scalar(), true, false, CV_32F);
+            }));
+
+            // Letterbox with OpenCV building the blob (allocates every frame)
+            printRow("letterbox + copyMakeBorder + blobFromImage", measureMicroseconds(iterations, [&] {
+                cv::Mat resized, padded;
+                cv::resize(frame, resized, letterbox.resized);
+                cv::copyMakeBorder(resized, padded, letterbox.pad_y,
+                                   input_size - letterbox.pad_y - letterbox.resized.height,
+                                   letterbox.pad_x, input_size - letterbox.pad_x - letterbox.resized.width,
+                                   cv::BORDER_CONSTANT, cv::Scalar::all(YoloUtils::LETTERBOX_PAD_VALUE));
+                cv::Mat blob;
+                cv::dnn::blobFromImage(padded, blob, pixel_scale, cv::Size(),
+                                       cv::Scalar(), true, false, CV_32F);
+            }));
+
+            // Fused kernel into persistent buffers (what the models run)
+            cv::Mat resize_buffer, blob;
+            printRow("fused letterboxToBlob (persistent buffers)", measureMicroseconds(iterations, [&] {
+                YoloUtils::letterboxToBlob(frame, letterbox, pixel_scale, resize_buffer, blob);
+            }));
+
+            // Swap/normalize/CHW kernel alone, excluding the resize
+            cv::Mat resized;
+            cv::resize(frame, resized, letterbox.resized);
+            std::vector<float> planes(static_cast<size_t>(resized.cols) * 3);
+            printRow("  of which convertBgrRowToPlanes", measureMicroseconds(iterations, [&] {
+                for (int y = 0; y < resized.rows; ++y) {
+                    YoloUtils::convertBgrRowToPlanes(resized.ptr<uchar>(y), planes.data(),
+                                                     planes.data() + resized.cols,
+                                                     planes.data() + 2 * resized.cols,
+                                                     resized.cols, pixel_scale);
+                }
+            }));
+            std::cout << "\n";
+        }
+    }
+
+    return 0;
+}
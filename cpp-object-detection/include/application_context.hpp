@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <queue>
+#include <deque>
 #include <future>
 #include <chrono>
 #include <set>
@@ -9,10 +10,12 @@
 
 #include "config_manager.hpp"
 #include "logger.hpp"
-#include "webcam_interface.hpp"
+#include "frame_source_interface.hpp"
+#include "frame_capture_thread.hpp"
 #include "object_detector.hpp"
 #include "performance_monitor.hpp"
 #include "parallel_frame_processor.hpp"
+#include "inference_scheduler.hpp"
 #include "detection_model_interface.hpp"
 #include "viewfinder_window.hpp"
 #include "network_streamer.hpp"
@@ -20,6 +23,24 @@
 #include "google_sheets_client.hpp"
 #include "notification_manager.hpp"
 
+/**
+ * A camera beyond the first in a multi-camera process
+ * It has its own capture thread, tracker and photo directory; inference runs
+ * on the model shared through ApplicationContext::inference_scheduler.
+ */
+struct CameraPipeline {
+    int camera_id = 0;
+    std::string name;  // "camera<id>", used for its stream stats and output directory
+    std::shared_ptr<IFrameSource> source;
+    std::shared_ptr<FrameCaptureThread> capture_thread;
+    std::shared_ptr<ObjectDetector> tracker;  // Tracking only, inference delegated to ApplicationContext::detector
+    std::shared_ptr<ParallelFrameProcessor> frame_processor;
+    std::queue<std::future<ParallelFrameProcessor::FrameResult>> pending_frames;
+    CapturedFrame latest_capture;
+    ParallelFrameProcessor::FullResolutionSource full_source;
+    std::chrono::steady_clock::time_point last_frame_time;
+};
+
 /**
  * Context structure to hold shared application state
  */
@@ -31,7 +52,8 @@ struct ApplicationContext {
     // Core components
     std::shared_ptr<Logger> logger;
     std::shared_ptr<PerformanceMonitor> perf_monitor;
-    std::shared_ptr<WebcamInterface> webcam;
+    std::shared_ptr<IFrameSource> frame_source;  // Webcam, video file, image directory or synthetic
+    std::shared_ptr<FrameCaptureThread> capture_thread;  // Null when reading the camera inline
     std::shared_ptr<ObjectDetector> detector;
     std::shared_ptr<ParallelFrameProcessor> frame_processor;
     std::shared_ptr<ViewfinderWindow> viewfinder;
@@ -40,14 +62,24 @@ struct ApplicationContext {
     std::shared_ptr<GoogleSheetsClient> google_sheets_client;
     std::shared_ptr<NotificationManager> notification_manager;
     
+    // Multi-camera: the primary camera above plus these, all inferring through one scheduler
+    std::shared_ptr<InferenceScheduler> inference_scheduler;  // Null with a single camera
+    std::deque<CameraPipeline> additional_cameras;  // deque: pipelines are never relocated
+    
     // Processing state
     std::queue<std::future<ParallelFrameProcessor::FrameResult>> pending_frames;
     cv::Mat frame;
+    CapturedFrame latest_capture;  // Reused destination for frames from the capture thread
+    int decode_scale = 1;          // Inference frames are decoded at 1/decode_scale of the camera resolution
+    ParallelFrameProcessor::FullResolutionSource full_source;  // Camera JPEG handed along with reduced frames
+    cv::Mat display_frame;         // Full-resolution decode of a reduced frame, made on demand
+    bool display_frame_ready = false;
     std::chrono::steady_clock::time_point last_heartbeat;
     std::chrono::steady_clock::time_point last_frame_time;
     std::chrono::steady_clock::time_point start_time;
     std::chrono::milliseconds heartbeat_interval;
     std::chrono::milliseconds frame_interval;
+    bool unthrottled = false;  // Unpaced benchmark source: no frame rate or analysis rate limits
     int detection_width;
     int detection_height;
     
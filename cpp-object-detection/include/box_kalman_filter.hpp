@@ -0,0 +1,60 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <array>
+
+/**
+ * Constant-velocity Kalman filter over a bounding box
+ *
+ * The state is the box center, width and height, each with its own rate of
+ * change. The four axes are independent (block-diagonal covariance), so the
+ * filter runs as four 2-state filters with no matrix work. Time steps are in
+ * seconds, so detections may arrive at any, irregular rate.
+ *
+ * Noise scales with the box height: a person 60 pixels tall and one 600
+ * pixels tall get the same relative smoothing.
+ */
+class BoxKalmanFilter {
+public:
+    BoxKalmanFilter();
+
+    /**
+     * Start at a detected box with zero velocity
+     */
+    explicit BoxKalmanFilter(const cv::Rect& box);
+
+    /**
+     * Advance the state by dt_seconds and correct it with a detected box
+     */
+    void update(const cv::Rect& box, double dt_seconds);
+
+    /**
+     * Box extrapolated dt_seconds past the last update; the state is not changed
+     */
+    cv::Rect predict(double dt_seconds) const;
+
+    /**
+     * Estimated velocity of the box center in pixels per second
+     */
+    cv::Point2f getVelocity() const;
+
+    static constexpr float MEASUREMENT_NOISE = 0.05f;   // Detection jitter, in box heights
+    static constexpr float ACCELERATION_NOISE = 1.0f;   // Unmodelled acceleration, in box heights per s^2
+    static constexpr float INITIAL_VELOCITY_STD = 1.0f; // Velocity uncertainty of a new track, box heights per s
+
+private:
+    struct Axis {
+        float position = 0.0f;
+        float velocity = 0.0f;
+        float var_pp = 0.0f;  // Covariance of (position, velocity)
+        float var_pv = 0.0f;
+        float var_vv = 0.0f;
+
+        void predict(float dt, float accel_var);
+        void correct(float measured, float measurement_var);
+    };
+
+    std::array<Axis, 4> axes_;  // Center x, center y, width, height
+
+    static std::array<float, 4> measure(const cv::Rect& box);
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <bitset>
+#include <string>
+#include <vector>
+
+/**
+ * Process-wide table of object class names and their dense ids
+ *
+ * Models intern their class list once at load, and every Detection they
+ * produce carries only the id in class_id. Filtering, tracking and drawing
+ * then work on ids: target checks are a bitset test and colors an array
+ * lookup. The name is looked up only at the edges (logs, files, JSON, labels).
+ *
+ * Names are never removed, so an id stays valid for the life of the process
+ * and means the same class for every model and camera. Interning is
+ * thread-safe; name() and color() read without locking.
+ */
+class ClassRegistry {
+public:
+    static constexpr int MAX_CLASSES = 256;
+    using ClassSet = std::bitset<MAX_CLASSES>;
+
+    /**
+     * Id of a class name, registering it on first use
+     * @return Class id, or -1 if MAX_CLASSES names are already registered
+     */
+    static int intern(const std::string& name);
+
+    /**
+     * Intern a list of names, e.g. a model's classes, in order
+     */
+    static std::vector<int> internAll(const std::vector<std::string>& names);
+
+    /**
+     * Id of a registered class name, or -1
+     */
+    static int find(const std::string& name);
+
+    /**
+     * Name of a class id; empty for an unknown id
+     */
+    static const std::string& name(int class_id);
+
+    /**
+     * Drawing color of a class id (BGR); white for classes without their own color
+     */
+    static const cv::Scalar& color(int class_id);
+
+    /**
+     * Set of the given class names, for id-based membership tests
+     */
+    static ClassSet makeSet(const std::vector<std::string>& names);
+
+    static bool contains(const ClassSet& set, int class_id) {
+        return class_id >= 0 && class_id < MAX_CLASSES && set.test(static_cast<size_t>(class_id));
+    }
+};
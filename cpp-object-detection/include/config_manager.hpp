@@ -2,6 +2,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 /**
  * Configuration manager for the object detection application.
@@ -22,8 +23,20 @@ public:
         
         // Video capture
         int camera_id = 0;
+        std::vector<int> camera_ids;  // Every --camera-id given; more than one runs all cameras on one shared model
         int frame_width = 1280;   // 720p width
         int frame_height = 720;   // 720p height
+        bool enable_capture_thread = true;  // Drain the camera on a dedicated thread, analyze the freshest frame
+        std::string capture_backend = "opencv";  // Capture backend: opencv, v4l2 (mmap MJPEG, Linux only)
+        bool reduced_decode = false;  // Decode MJPEG for inference at the DCT scale nearest the detection resolution
+        
+        // Frame source (webcam or recorded/generated input for testing and benchmarks)
+        std::string frame_source = "webcam";      // webcam, video, images, synthetic
+        std::string source_path;                  // Video file or image directory
+        double source_fps = 0.0;                  // Pacing rate for non-webcam sources (0 = video's own rate, else 30)
+        std::string source_pacing = "realtime";   // realtime, or fast to process every frame as fast as possible
+        bool source_loop = false;                 // Restart video/image sources when they end
+        int source_frame_limit = 0;               // Synthetic source: stop after N frames (0 = endless)
         
         // Object detection
         std::string model_path = "models/yolov5s.onnx";
@@ -38,7 +51,28 @@ public:
         int processing_threads = 1;
         bool enable_parallel_processing = false;
         int max_frame_queue_size = 10;
+        int inference_replicas = 0;  // Independent model instances for concurrent inference (0 = one per processing thread)
+        int inference_threads = 0;   // Intra-op threads per forward pass (0 = cores / replicas)
+        std::string inference_backend = "opencv";  // Inference backend: opencv, onnxruntime
+        int inter_op_threads = 0;    // ONNX Runtime threads across independent graph nodes (0 = sequential)
+        std::string graph_optimization = "all";  // ONNX Runtime graph optimization: disable, basic, extended, all
+        int inference_batch_size = 1;  // Queued frames per forward pass in parallel mode (1 = no batching)
+        int batch_timeout_ms = 10;     // Longest wait for a batch to fill before running a partial one
         double analysis_rate_limit = 1.0;  // Maximum images to analyze per second (default: 1)
+        int inference_interval = 1;        // Run the detector on every Nth analyzed image, predict tracks in between
+        bool enable_optical_flow = false;  // Move tracks with optical flow instead of Kalman predictions in between
+        bool enable_motion_gate = false;   // Skip inference on static frames while no moving object is tracked
+        double motion_threshold = 0.005;   // Fraction of changed gate pixels that counts as motion
+        bool enable_motion_roi = false;    // Infer native-resolution crops of motion regions instead of the full frame
+        int max_motion_rois = 4;           // Most regions inferred per frame before falling back to merging
+        bool enable_tiling = false;        // Infer overlapping native-resolution tiles plus the scaled full frame
+        int tile_columns = 0;              // Tile grid (0 = fewest tiles no larger than the network input)
+        int tile_rows = 0;
+        double tile_overlap = 0.2;         // Fraction of a tile shared with its neighbour
+        int tile_interval = 1;             // Frames between runs of tiles not listed in tile_every_frame
+        std::vector<int> tile_every_frame; // Row-major tile indices inferred on every frame
+        std::vector<std::string> include_zones;  // Polygons "x,y;x,y;..." in 0..1 frame coordinates
+        std::vector<std::string> exclude_zones;
         
         // Debug
         bool verbose = false;
@@ -48,6 +82,7 @@ public:
         // Network streaming
         bool enable_streaming = false;  // Enable MJPEG HTTP streaming
         int streaming_port = 8080;      // Port for HTTP streaming server
+        bool stream_passthrough = false;  // Stream camera JPEGs untouched (no overlay) when the capture backend provides them
         
         // Image preprocessing
         bool enable_brightness_filter = false;  // Enable high brightness filter for glass reflections
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "detection_model_interface.hpp"
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Agreement between a reference model (e.g. FP32) and a candidate model
+ * (e.g. its INT8 quantization) on the same frames
+ *
+ * Detections are matched greedily per frame: each reference detection, in
+ * descending confidence order, takes the unmatched candidate detection of the
+ * same class with the highest IoU at or above the threshold. The FP32 output
+ * is treated as ground truth, so recall is "how much of what FP32 found is
+ * still found" and precision is "how much of what the candidate found FP32
+ * agrees with".
+ */
+class DetectionAgreement {
+public:
+    struct Counts {
+        size_t reference = 0;
+        size_t candidate = 0;
+        size_t matched = 0;
+    };
+
+    explicit DetectionAgreement(double iou_threshold = 0.5);
+
+    /**
+     * Match one frame's detections and add them to the totals
+     */
+    void addFrame(const std::vector<Detection>& reference, const std::vector<Detection>& candidate);
+
+    size_t frames() const { return frames_; }
+    const Counts& totals() const { return totals_; }
+    const std::map<std::string, Counts>& perClass() const { return per_class_; }
+
+    double recall() const;
+    double precision() const;
+    double f1() const;
+
+    /**
+     * Mean IoU of matched pairs
+     */
+    double meanIou() const;
+
+    /**
+     * Mean absolute confidence difference of matched pairs
+     */
+    double meanConfidenceDelta() const;
+
+private:
+    double iou_threshold_;
+    size_t frames_;
+    Counts totals_;
+    std::map<std::string, Counts> per_class_;
+    double iou_sum_;
+    double confidence_delta_sum_;
+};
@@ -9,10 +9,9 @@
  * Detection result structure
  */
 struct Detection {
-    std::string class_name;
     double confidence;
     cv::Rect bbox;
-    int class_id;
+    int class_id;  // ClassRegistry id; ClassRegistry::name() gives the name for output
     bool is_stationary;  // Indicates if the object is considered stationary
     int stationary_duration_seconds;  // How long object has been stationary (0 if not stationary)
     
@@ -65,6 +64,34 @@ public:
      */
     virtual std::vector<Detection> detect(const cv::Mat& frame) = 0;
     
+    /**
+     * Detect objects in several frames with as few forward passes as possible
+     * The default runs detect() per frame; models whose network has a dynamic
+     * batch axis letterbox all frames into one [N, 3, H, W] tensor instead.
+     * @param frames Input frames (empty frames yield no detections)
+     * @return One detection list per frame, in input order
+     */
+    virtual std::vector<std::vector<Detection>> detectBatch(const std::vector<cv::Mat>& frames) {
+        std::vector<std::vector<Detection>> results;
+        results.reserve(frames.size());
+        for (const auto& frame : frames) {
+            results.push_back(detect(frame));
+        }
+        return results;
+    }
+    
+    /**
+     * Detect objects in a crop of the camera frame at the crop's own resolution
+     * Unlike detect(), the detection scale factor is not applied: the crop is
+     * letterboxed into the smallest stride-aligned input that holds it, up to
+     * the nominal input size. The default simply runs detect().
+     * @param crop Region of the camera frame (may be a view into it)
+     * @return Detections in crop coordinates
+     */
+    virtual std::vector<Detection> detectRegion(const cv::Mat& crop) {
+        return detect(crop);
+    }
+    
     /**
      * Get model performance metrics
      * @return ModelMetrics structure with performance information
@@ -89,11 +116,29 @@ public:
      */
     virtual std::string getModelName() const = 0;
     
+    /**
+     * Get the nominal (largest) square input size the network runs at
+     * @return Input side in pixels, or 0 if unknown
+     */
+    virtual int getInputSize() const {
+        return 0;
+    }
+    
     /**
      * Warm up the model with a dummy inference
      * This helps get accurate timing measurements
      */
     virtual void warmUp() = 0;
+    
+    /**
+     * Restrict class scoring to the classes the caller will keep
+     * Must be called before initialize(). Models that cannot restrict
+     * decoding ignore it; an empty list means all classes.
+     * @param class_names Class names of interest
+     */
+    virtual void setTargetClasses(const std::vector<std::string>& class_names) {
+        (void)class_names;
+    }
 };
 
 /**
@@ -108,6 +153,23 @@ public:
         YOLO_V8_MEDIUM    // Balanced speed/accuracy
     };
     
+    enum class Backend {
+        OPENCV_DNN,       // cv::dnn (default, always available)
+        ONNX_RUNTIME      // ONNX Runtime CPU execution provider (optional at build time)
+    };
+    
+    /**
+     * Inference backend selection and runtime tuning
+     * Thread and optimization settings only apply to ONNX Runtime; the OpenCV
+     * backend uses cv::setNumThreads instead.
+     */
+    struct BackendOptions {
+        Backend backend = Backend::OPENCV_DNN;
+        int intra_op_threads = 0;                  // Threads within one operator (0 = runtime default)
+        int inter_op_threads = 0;                  // Threads across independent graph nodes (0 = sequential)
+        std::string graph_optimization = "all";    // disable, basic, extended or all
+    };
+    
     /**
      * Create a detection model of the specified type
      * @param type Model type to create
@@ -118,6 +180,35 @@ public:
         ModelType type, 
         std::shared_ptr<class Logger> logger);
     
+    /**
+     * Create a detection model of the specified type on a specific backend
+     * Falls back to OpenCV DNN with a warning if the requested backend was
+     * not compiled in.
+     * @param type Model type to create
+     * @param logger Logger instance for the model
+     * @param options Backend selection and tuning
+     * @return Unique pointer to the model instance
+     */
+    static std::unique_ptr<IDetectionModel> createModel(
+        ModelType type, 
+        std::shared_ptr<class Logger> logger,
+        const BackendOptions& options);
+    
+    /**
+     * Check whether a backend was compiled into this build
+     */
+    static bool isBackendAvailable(Backend backend);
+    
+    /**
+     * Parse backend from string ("opencv" or "onnxruntime")
+     */
+    static Backend parseBackend(const std::string& backend_name);
+    
+    /**
+     * Get backend as string
+     */
+    static std::string backendToString(Backend backend);
+    
     /**
      * Get available model types with their characteristics
      * @return Vector of available models and their metrics
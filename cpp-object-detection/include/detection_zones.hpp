@@ -0,0 +1,84 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "detection_model_interface.hpp"
+
+/**
+ * User-defined polygon zones restricting where objects are detected
+ *
+ * Polygons use coordinates relative to the frame (0..1), so the same zones
+ * work at camera resolution, at a reduced decode scale and at any detection
+ * resolution. The analyzed area is the union of the include zones (the
+ * whole frame if there are none) minus the union of the exclude zones.
+ *
+ * The zones are rasterized once per frame size into a mask. Before
+ * inference the pixels outside the analyzed area are blacked out, so a
+ * busy street or a swaying tree produces nothing to detect. Masking is
+ * applied to the small copies the motion gate, ROI extractor and network
+ * actually look at, not to the camera frame. Afterwards
+ * detections lying mostly outside the area are dropped before tracking,
+ * photos and notifications.
+ *
+ * Thread-safe: masks are built under a lock and shared read-only.
+ */
+class DetectionZones {
+public:
+    using Polygon = std::vector<cv::Point2f>;
+
+    DetectionZones(std::vector<Polygon> include_zones, std::vector<Polygon> exclude_zones);
+
+    /**
+     * Parse "x,y;x,y;x,y..." with at least three points, each coordinate in 0..1
+     * @return false if the text is not a valid polygon
+     */
+    static bool parsePolygon(const std::string& text, Polygon& polygon);
+
+    /**
+     * Mask of the analyzed area (255) for frames of the given size
+     * @param channels Channels per pixel, so the mask can be ANDed with a color frame directly
+     */
+    cv::Mat getMask(const cv::Size& frame_size, int channels = 1);
+
+    /**
+     * Copy of the frame with everything outside the analyzed area set to black
+     */
+    cv::Mat applyMask(const cv::Mat& frame);
+
+    /**
+     * Black out everything outside the analyzed area in one pass
+     * @param masked Reused between calls; may be the frame itself to mask in place
+     */
+    void applyMask(const cv::Mat& frame, cv::Mat& masked);
+
+    /**
+     * Keep detections with at least min_overlap of their box inside the analyzed area
+     * @param frame_size Size of the frame the boxes refer to
+     */
+    std::vector<Detection> filter(const std::vector<Detection>& detections, const cv::Size& frame_size,
+                                  double min_overlap = 0.5);
+
+    /**
+     * Number of detections dropped by filter() so far
+     */
+    uint64_t getFilteredCount() const { return filtered_count_.load(); }
+
+    size_t getIncludeZoneCount() const { return include_zones_.size(); }
+    size_t getExcludeZoneCount() const { return exclude_zones_.size(); }
+
+private:
+    std::vector<Polygon> include_zones_;
+    std::vector<Polygon> exclude_zones_;
+
+    std::mutex mask_mutex_;
+    std::map<std::tuple<int, int, int>, cv::Mat> masks_;  // Analyzed-area masks by (width, height, channels)
+    std::atomic<uint64_t> filtered_count_;
+
+    cv::Mat rasterize(const cv::Size& frame_size) const;
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "frame_source_interface.hpp"
+#include "logger.hpp"
+
+/**
+ * Frame source replaying a video file
+ * Real-time pacing follows the file's frame rate unless an explicit rate is given.
+ */
+class VideoFileSource : public IFrameSource {
+public:
+    VideoFileSource(const std::string& path, FramePacing pacing, double fps, bool loop,
+                    std::shared_ptr<Logger> logger);
+    ~VideoFileSource() override;
+
+    bool initialize() override;
+    bool captureFrame(cv::Mat& frame) override;
+    bool isReady() const override;
+    bool isExhausted() const override { return exhausted_; }
+    std::string getSourceInfo() const override;
+    void release() override;
+
+private:
+    std::string path_;
+    FramePacing pacing_;
+    double requested_fps_;  // 0 = use the file's rate
+    double fps_;
+    bool loop_;
+    std::shared_ptr<Logger> logger_;
+    cv::VideoCapture capture_;
+    FramePacer pacer_;
+    bool exhausted_;
+    uint64_t frames_read_;
+
+    static constexpr double DEFAULT_FPS = 30.0;  // When the container does not report a rate
+};
+
+/**
+ * Frame source replaying the images in a directory in file name order
+ * If every image is a JPEG, frames are handed out as the file bytes
+ * (providesEncodedFrames), exercising the same passthrough and reduced-decode
+ * path as a V4L2 MJPEG camera.
+ */
+class ImageDirectorySource : public IFrameSource {
+public:
+    ImageDirectorySource(const std::string& directory, FramePacing pacing, double fps, bool loop,
+                         std::shared_ptr<Logger> logger);
+    ~ImageDirectorySource() override = default;
+
+    bool initialize() override;
+    bool captureFrame(cv::Mat& frame) override;
+    bool captureEncodedFrame(std::vector<uchar>& jpeg) override;
+    bool providesEncodedFrames() const override { return initialized_ && all_jpeg_; }
+    bool isReady() const override { return initialized_ && !exhausted_; }
+    bool isExhausted() const override { return exhausted_; }
+    std::string getSourceInfo() const override;
+    void release() override;
+
+    /**
+     * Image files found by initialize(), sorted by name
+     */
+    const std::vector<std::string>& getImagePaths() const { return image_paths_; }
+
+private:
+    std::string directory_;
+    FramePacing pacing_;
+    double fps_;
+    bool loop_;
+    std::shared_ptr<Logger> logger_;
+    FramePacer pacer_;
+    std::vector<std::string> image_paths_;
+    size_t next_index_;
+    bool all_jpeg_;
+    bool initialized_;
+    bool exhausted_;
+
+    static constexpr double DEFAULT_FPS = 30.0;
+
+    // Path of the next image, or empty once the directory is exhausted
+    std::string nextPath();
+};
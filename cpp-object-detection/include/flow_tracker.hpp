@@ -0,0 +1,114 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "logger.hpp"
+
+/**
+ * Moves tracked boxes between keyframe detections with sparse optical flow
+ *
+ * On every inferred frame (the keyframe) a handful of corner features are
+ * picked inside each tracked box. On the frames in between, those points are
+ * followed with pyramidal Lucas-Kanade flow on a small grayscale copy of the
+ * frame, and each box moves by the median displacement of its points and
+ * scales by the median change of their spread. A point only counts when
+ * tracking it back lands near where it started.
+ *
+ * propagate() fails, asking for a new detection, when a box keeps too few
+ * of its points (occlusion, blur, an object turning away) or when something
+ * changed in the frame away from all tracked boxes (a new object walked in).
+ * Boxes too small or too plain to hold features are left out of the result,
+ * so the caller falls back to its motion model for them.
+ *
+ * Not thread-safe: keyframes and propagation must come from one thread in
+ * capture order. The statistics may be read from any thread.
+ */
+class FlowTracker {
+public:
+    struct Stats {
+        uint64_t frames_propagated = 0;
+        uint64_t low_confidence_fallbacks = 0;  // A box lost too many of its points
+        uint64_t new_motion_fallbacks = 0;      // Something moved outside the tracked boxes
+        double avg_points_per_box = 0.0;        // Points seeded per box at keyframes
+    };
+
+    explicit FlowTracker(std::shared_ptr<Logger> logger);
+
+    /**
+     * Small grayscale copy of a frame, FLOW_WIDTH pixels wide, to pass to setKeyframe() and propagate()
+     */
+    static cv::Mat prepareImage(const cv::Mat& frame);
+
+    /**
+     * Start tracking from an inferred frame
+     * @param image Output of prepareImage() for the frame
+     * @param boxes Boxes to follow in frame coordinates, indexed by track slot; empty boxes are skipped
+     * @param frame_size Size of the frame the boxes refer to
+     */
+    void setKeyframe(const cv::Mat& image, const std::vector<cv::Rect>& boxes, const cv::Size& frame_size);
+
+    /**
+     * Follow the keyframe boxes into the next frame
+     * @param image Output of prepareImage() for the frame
+     * @param boxes Set to the moved boxes, in frame coordinates and indexed like the keyframe boxes;
+     *              boxes without features are left empty
+     * @return false when a new detection is needed; the tracker then waits for the next keyframe
+     */
+    bool propagate(const cv::Mat& image, std::vector<cv::Rect>& boxes);
+
+    bool hasKeyframe() const { return !previous_.empty(); }
+
+    Stats getStats() const;
+
+    void logStats() const;
+
+    static constexpr int FLOW_WIDTH = 320;
+
+private:
+    struct Track {
+        size_t index = 0;                  // Position of the box in the keyframe boxes
+        cv::Rect2f box;                    // In image coordinates
+        std::vector<cv::Point2f> points;   // Empty if the box could not hold enough features
+    };
+
+    std::shared_ptr<Logger> logger_;
+    cv::Mat previous_;                     // Image the tracked points lie on
+    double scale_;                         // Image pixels per frame pixel
+    std::vector<Track> tracks_;            // The first track_count_ are in use; the rest keep their buffers
+    size_t track_count_;
+    size_t keyframe_size_;                 // Number of keyframe boxes, empty ones included
+
+    // Reused buffers
+    cv::Mat difference_;
+    std::vector<cv::Point2f> points_;
+    std::vector<cv::Point2f> next_points_;
+    std::vector<cv::Point2f> back_points_;
+    std::vector<uchar> status_;
+    std::vector<uchar> back_status_;
+    std::vector<float> errors_;
+    std::vector<cv::Point2f> before_;
+    std::vector<cv::Point2f> after_;
+    std::vector<float> shift_x_;
+    std::vector<float> shift_y_;
+    std::vector<float> spread_;
+
+    std::atomic<uint64_t> frames_propagated_;
+    std::atomic<uint64_t> low_confidence_fallbacks_;
+    std::atomic<uint64_t> new_motion_fallbacks_;
+    std::atomic<uint64_t> keyframe_boxes_;
+    std::atomic<uint64_t> keyframe_points_;
+
+    bool newMotionOutsideTracks(const cv::Mat& image);
+
+    static constexpr int MAX_POINTS_PER_BOX = 12;
+    static constexpr int MIN_POINTS_PER_BOX = 4;
+    static constexpr double MIN_POINTS_KEPT = 0.5;         // Fraction of a box's points that must survive
+    static constexpr float MAX_ROUND_TRIP_ERROR = 1.0f;    // Pixels between a point and its back-tracked self
+    static constexpr int PYRAMID_LEVELS = 2;               // Above the base image: 320, 160 and 80 wide
+    static constexpr int DIFFERENCE_THRESHOLD = 25;        // Gray levels that count as a change
+    static constexpr double NEW_MOTION_FRACTION = 0.002;   // Changed pixels outside the boxes that trigger a detection
+    static constexpr float BOX_MARGIN = 0.25f;             // Fraction of a box size around it still counted as the object
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "latest_frame_slot.hpp"
+#include "frame_source_interface.hpp"
+#include "logger.hpp"
+
+/**
+ * Frame grabbed by the capture thread
+ */
+struct CapturedFrame {
+    cv::Mat frame;
+    std::vector<uchar> jpeg;  // Source's JPEG payload when it provides encoded frames, else empty
+    int decode_scale = 1;     // frame was decoded at 1/decode_scale of the JPEG resolution
+    uint64_t sequence = 0;  // Increments with every frame read from the camera
+    std::chrono::steady_clock::time_point capture_time;  // When the read returned
+};
+
+/**
+ * Dedicated thread that continuously drains the camera (or any frame source)
+ *
+ * Reading the camera only when the processing loop is ready leaves frames
+ * sitting in the driver queue, so the loop analyzes a frame that is up to one
+ * frame interval old. This thread reads every frame as soon as the camera
+ * delivers it and publishes it to a LatestFrameSlot; the processing loop
+ * picks up the freshest frame without blocking and older unread frames are
+ * dropped. Camera recovery (healthCheck/reconnect) runs on this thread too,
+ * so the source is only ever touched by one thread.
+ *
+ * When the source delivers JPEGs (V4L2 MJPEG, image directory) only the compressed payload
+ * is captured here; tryGetLatest() decodes it, so superseded frames are never
+ * decoded at all.
+ */
+class FrameCaptureThread {
+public:
+    FrameCaptureThread(std::shared_ptr<IFrameSource> source, std::shared_ptr<Logger> logger);
+    ~FrameCaptureThread();
+
+    /**
+     * Decode MJPEG frames at 1/scale resolution (1, 2, 4 or 8) in tryGetLatest()
+     * The full-resolution JPEG stays in CapturedFrame::jpeg for on-demand decoding.
+     * Must be called before start().
+     */
+    void setDecodeScale(int scale);
+
+    /**
+     * Start capturing; the source must already be initialized
+     */
+    bool start();
+
+    /**
+     * Stop capturing and join the thread
+     */
+    void stop();
+
+    /**
+     * Copy out the latest frame if a new one arrived since the last call
+     * Never blocks on the camera; an MJPEG frame is decoded on this call.
+     * The destination's buffers are reused between calls.
+     * Must always be called from the same (consumer) thread.
+     * @return false if no new frame is available yet
+     */
+    bool tryGetLatest(CapturedFrame& captured);
+
+    /**
+     * Check whether the camera is delivering frames or could be recovered
+     */
+    bool isHealthy() const { return healthy_.load(); }
+
+    bool isRunning() const { return running_.load(); }
+
+    /**
+     * Check whether a finite source delivered its last frame and the thread exited
+     * Every frame published before this turned true is still available to tryGetLatest().
+     */
+    bool isFinished() const { return finished_.load(); }
+
+    /**
+     * Frames read from the camera since start()
+     */
+    uint64_t getFramesCaptured() const { return frames_captured_.load(); }
+
+    /**
+     * Frames replaced by a newer one before the consumer picked them up
+     */
+    uint64_t getFramesDropped() const { return frames_dropped_.load(); }
+
+private:
+    std::shared_ptr<IFrameSource> source_;
+    std::shared_ptr<Logger> logger_;
+    LatestFrameSlot<CapturedFrame> slot_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    std::atomic<bool> healthy_;
+    std::atomic<bool> finished_;
+    std::atomic<uint64_t> frames_captured_;
+    std::atomic<uint64_t> frames_dropped_;
+    int decode_scale_;
+
+    static constexpr int CAPTURE_RETRY_DELAY_MS = 100;  // Back-off after a failed read
+
+    void captureLoop();
+};
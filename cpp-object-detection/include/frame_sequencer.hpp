@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <condition_variable>
+
+/**
+ * Reorder buffer that releases items strictly in sequence-number order
+ *
+ * Parallel inference workers finish frames in arbitrary order. Each frame
+ * gets a sequence number at capture time; workers push their results here
+ * as soon as inference completes, and a single consumer pops them back out
+ * in capture order. This keeps all stateful stages (tracking, photo
+ * decisions, burst logic) single-threaded without locking the workers.
+ *
+ * Sequence numbers that will never produce a result must be released with
+ * skip() so the consumer does not wait on the gap.
+ */
+template <typename T>
+class FrameSequencer {
+public:
+    explicit FrameSequencer(uint64_t first_sequence = 0)
+        : next_sequence_(first_sequence), closed_(false) {}
+
+    /**
+     * Add the result for a sequence number (called from worker threads)
+     */
+    void push(uint64_t sequence, T item) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (sequence < next_sequence_) {
+                return;  // Already skipped past this sequence number
+            }
+            pending_.emplace(sequence, std::optional<T>(std::move(item)));
+        }
+        ready_condition_.notify_one();
+    }
+
+    /**
+     * Mark a sequence number as never producing a result
+     */
+    void skip(uint64_t sequence) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (sequence < next_sequence_) {
+                return;
+            }
+            pending_.emplace(sequence, std::nullopt);
+        }
+        ready_condition_.notify_one();
+    }
+
+    /**
+     * Block until the next in-order item is available
+     * Returns false once the sequencer is closed and fully drained.
+     * After close(), missing sequence numbers are stepped over so that
+     * everything already pushed is still delivered in order.
+     */
+    bool waitNext(T& item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            auto it = pending_.begin();
+            if (it != pending_.end() && it->first == next_sequence_) {
+                std::optional<T> entry = std::move(it->second);
+                pending_.erase(it);
+                next_sequence_++;
+                if (entry) {
+                    item = std::move(*entry);
+                    return true;
+                }
+                continue;  // Skipped sequence number
+            }
+
+            if (closed_) {
+                if (pending_.empty()) {
+                    return false;
+                }
+                next_sequence_ = pending_.begin()->first;
+                continue;
+            }
+
+            ready_condition_.wait(lock);
+        }
+    }
+
+    /**
+     * Pop the next in-order item without blocking
+     * Returns false if the next sequence number has not arrived yet.
+     */
+    bool tryNext(T& item) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (!pending_.empty() && pending_.begin()->first == next_sequence_) {
+            auto it = pending_.begin();
+            std::optional<T> entry = std::move(it->second);
+            pending_.erase(it);
+            next_sequence_++;
+            if (entry) {
+                item = std::move(*entry);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Stop waiting for missing sequence numbers and wake the consumer
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        ready_condition_.notify_all();
+    }
+
+    /**
+     * Number of results buffered while waiting for an earlier sequence number
+     */
+    size_t pendingCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pending_.size();
+    }
+
+    /**
+     * Sequence number the consumer is waiting for
+     */
+    uint64_t nextSequence() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return next_sequence_;
+    }
+
+private:
+    std::map<uint64_t, std::optional<T>> pending_;
+    uint64_t next_sequence_;
+    bool closed_;
+    mutable std::mutex mutex_;
+    std::condition_variable ready_condition_;
+};
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * How a recorded or generated source hands out frames
+ */
+enum class FramePacing {
+    REAL_TIME,            // One frame per source frame interval, like a live camera
+    AS_FAST_AS_POSSIBLE   // Never wait; for throughput benchmarks
+};
+
+/**
+ * Abstract interface for everything that produces frames for the pipeline
+ * A live webcam, a video file, a directory of images or a synthetic generator
+ * all look the same to the capture thread and the processing loop, so the
+ * whole pipeline can run and be benchmarked without a camera.
+ */
+class IFrameSource {
+public:
+    virtual ~IFrameSource() = default;
+
+    /**
+     * Open the source
+     * @return true if frames can be captured
+     */
+    virtual bool initialize() = 0;
+
+    /**
+     * Capture the next frame as BGR
+     * Returns true if frame was captured successfully
+     */
+    virtual bool captureFrame(cv::Mat& frame) = 0;
+
+    /**
+     * Capture the next frame as the source's own JPEG without decoding it
+     * Only available when providesEncodedFrames() is true.
+     */
+    virtual bool captureEncodedFrame(std::vector<uchar>& jpeg) {
+        (void)jpeg;
+        return false;
+    }
+
+    /**
+     * Check whether the source delivers JPEG-compressed frames
+     */
+    virtual bool providesEncodedFrames() const { return false; }
+
+    /**
+     * Check if the source is open and delivering frames
+     */
+    virtual bool isReady() const = 0;
+
+    /**
+     * Check whether a finite source (file, directory) has delivered its last frame
+     * Capture failures after this point are the end of the stream, not an error.
+     */
+    virtual bool isExhausted() const { return false; }
+
+    /**
+     * Human readable description (device, resolution, rate)
+     */
+    virtual std::string getSourceInfo() const = 0;
+
+    /**
+     * Release source resources
+     */
+    virtual void release() = 0;
+
+    /**
+     * Check health and attempt recovery after repeated capture failures
+     * Returns true if the source is healthy or was successfully recovered
+     */
+    virtual bool healthCheck() { return isReady(); }
+
+    /**
+     * Decode a captured JPEG into BGR, reusing frame's buffer when the size matches
+     * @param scale 1, 2, 4 or 8: decode at 1/scale resolution, scaled in the
+     *              DCT domain by libjpeg rather than resized after a full decode
+     */
+    static bool decodeFrame(const std::vector<uchar>& jpeg, cv::Mat& frame, int scale = 1);
+
+    /**
+     * Pick the smallest JPEG decode (1, 2, 4 or 8) that still covers the detection resolution
+     * e.g. 0.5 -> 2, 0.3 -> 2, 0.25 -> 4, 1.0 -> 1
+     */
+    static int selectDecodeScale(double detection_scale_factor);
+};
+
+/**
+ * Fixed-rate schedule for sources that are not paced by hardware
+ * Frames are due at start + n * interval, so time spent reading or drawing a
+ * frame does not add drift. A consumer that falls more than one interval
+ * behind resets the schedule instead of receiving a burst of catch-up frames.
+ */
+class FramePacer {
+public:
+    void configure(FramePacing pacing, double fps) {
+        pacing_ = pacing;
+        interval_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(fps > 0.0 ? 1.0 / fps : 0.0));
+        next_due_ = std::chrono::steady_clock::time_point();
+    }
+
+    /**
+     * Block until the next frame is due (returns immediately when unpaced)
+     */
+    void wait() {
+        if (pacing_ != FramePacing::REAL_TIME || interval_.count() <= 0) {
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (next_due_ == std::chrono::steady_clock::time_point() || now - next_due_ > interval_) {
+            next_due_ = now;
+        } else if (next_due_ > now) {
+            std::this_thread::sleep_until(next_due_);
+        }
+        next_due_ += interval_;
+    }
+
+private:
+    FramePacing pacing_ = FramePacing::REAL_TIME;
+    std::chrono::steady_clock::duration interval_{0};
+    std::chrono::steady_clock::time_point next_due_;
+};
+
+/**
+ * Factory for creating frame sources from configuration
+ */
+class FrameSourceFactory {
+public:
+    enum class SourceType {
+        WEBCAM,           // Live USB camera (OpenCV or V4L2 capture)
+        VIDEO_FILE,       // Any container/codec cv::VideoCapture can read
+        IMAGE_DIRECTORY,  // Sorted still images; JPEGs are passed through undecoded
+        SYNTHETIC         // Generated moving objects, no files needed
+    };
+
+    /**
+     * Everything needed to open any source type; fields not used by the
+     * selected type are ignored
+     */
+    struct SourceOptions {
+        SourceType type = SourceType::WEBCAM;
+        int camera_id = 0;
+        int width = 1280;                         // Camera request / synthetic frame size
+        int height = 720;
+        std::string capture_backend = "opencv";   // Webcam: opencv or v4l2
+        std::string path;                         // Video file or image directory
+        double fps = 0.0;                         // Pacing rate (0 = video's own rate, 30 otherwise)
+        FramePacing pacing = FramePacing::REAL_TIME;
+        bool loop = false;                        // Restart finite sources at the end
+        int frame_limit = 0;                      // Synthetic: stop after N frames (0 = endless)
+    };
+
+    /**
+     * Create an (uninitialized) frame source
+     */
+    static std::unique_ptr<IFrameSource> createSource(const SourceOptions& options,
+                                                      std::shared_ptr<class Logger> logger);
+
+    /**
+     * Parse source type from string ("webcam", "video", "images" or "synthetic")
+     */
+    static SourceType parseSourceType(const std::string& source_name);
+
+    /**
+     * Get source type as string
+     */
+    static std::string sourceTypeToString(SourceType type);
+
+    /**
+     * Parse pacing from string ("realtime" or "fast")
+     */
+    static FramePacing parsePacing(const std::string& pacing_name);
+};
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "object_detector.hpp"
+#include "logger.hpp"
+
+/**
+ * Inference workers shared by several camera streams
+ *
+ * With more than one camera in a process, every camera keeps its own capture
+ * thread, tracker and frame processor, but they all feed this scheduler so a
+ * single set of model replicas serves every camera. Each stream has its own
+ * bounded queue; workers take frames round-robin across streams, so a camera
+ * producing frames faster than the others fills (and drops from) its own
+ * queue instead of starving them. With batching, one forward pass may hold
+ * frames from several cameras.
+ *
+ * Completion callbacks run on a worker thread, once per submitted frame.
+ */
+class InferenceScheduler {
+public:
+    /**
+     * Called with the inference outcome of one frame
+     */
+    using Completion = std::function<void(bool inference_ok, std::vector<Detection>& detections)>;
+
+    /**
+     * Per-camera counters for logging and the performance report
+     */
+    struct StreamStats {
+        std::string name;
+        uint64_t submitted = 0;
+        uint64_t inferred = 0;
+        uint64_t dropped = 0;       // Rejected because the stream's queue was full
+        size_t queued = 0;
+        double avg_inference_ms = 0.0;  // Forward-pass time attributed to this stream's frames
+    };
+
+    InferenceScheduler(std::shared_ptr<ObjectDetector> detector,
+                       std::shared_ptr<Logger> logger,
+                       int num_workers = 1,
+                       size_t max_queue_per_stream = 10);
+
+    ~InferenceScheduler();
+
+    /**
+     * Enable batched inference (see ParallelFrameProcessor::setBatching)
+     * Must be called before initialize().
+     */
+    void setBatching(size_t max_batch_size, int batch_timeout_ms);
+
+    /**
+     * Register a camera stream and get its id for submit()
+     */
+    int registerStream(const std::string& name);
+
+    /**
+     * Start the worker threads
+     */
+    bool initialize();
+
+    /**
+     * Queue a frame of a stream for inference
+     * Returns false (without calling done) if the stream's queue is full.
+     * @param regions Motion regions to infer as native-resolution crops
+     *                instead of the whole frame (empty for a full-frame pass)
+     * @param origins Frame position of each region when frame packs the regions,
+     *                as for ObjectDetector::detectObjectsInRegions()
+     */
+    bool submit(int stream_id, const cv::Mat& frame, Completion done,
+                std::vector<cv::Rect> regions = {}, std::vector<cv::Point> origins = {});
+
+    /**
+     * Fail all queued frames of a stream and wait for its in-flight frames
+     * After this returns no further completion of the stream will run.
+     */
+    void drainStream(int stream_id);
+
+    /**
+     * Stop the workers; frames still queued complete with inference_ok = false
+     */
+    void shutdown();
+
+    /**
+     * Get number of frames waiting in a stream's queue
+     */
+    size_t getQueueSize(int stream_id) const;
+
+    /**
+     * Get counters for every registered stream, in registration order
+     */
+    std::vector<StreamStats> getStreamStats() const;
+
+    /**
+     * Log one line of counters per stream
+     */
+    void logStreamStats() const;
+
+private:
+    struct Job {
+        int stream_id;
+        cv::Mat frame;
+        Completion done;
+        std::vector<cv::Rect> regions;
+        std::vector<cv::Point> origins;
+    };
+
+    struct Stream {
+        std::string name;
+        std::deque<Job> queue;
+        size_t in_flight = 0;
+        uint64_t submitted = 0;
+        uint64_t inferred = 0;
+        uint64_t dropped = 0;
+        double total_inference_ms = 0.0;
+    };
+
+    std::shared_ptr<ObjectDetector> detector_;
+    std::shared_ptr<Logger> logger_;
+    int num_workers_;
+    size_t max_queue_per_stream_;
+    size_t max_batch_size_;
+    std::chrono::milliseconds batch_timeout_;
+
+    std::vector<Stream> streams_;   // Guarded by mutex_
+    size_t next_stream_;            // Round-robin cursor, guarded by mutex_
+    size_t total_queued_;           // Guarded by mutex_
+    mutable std::mutex mutex_;
+    std::condition_variable work_condition_;
+    std::condition_variable idle_condition_;  // Signalled when a stream's in-flight count drops
+    std::vector<std::thread> worker_threads_;
+    std::atomic<bool> shutdown_requested_;
+
+    void workerThread();
+
+    // Take up to max_batch_size_ jobs, one per stream in turn (caller holds mutex_)
+    std::vector<Job> takeFairBatch();
+
+    void runJobs(std::vector<Job>& jobs);
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Lock-free single-producer/single-consumer "latest value wins" triple buffer
+ *
+ * The producer (capture thread) always owns one buffer to write into, the
+ * consumer always owns one buffer to read from, and the third buffer holds
+ * the most recently published value. Publishing and consuming are a single
+ * atomic exchange each, so neither side ever blocks or waits for the other.
+ * A value published before the consumer picked up the previous one simply
+ * replaces it: the consumer only ever sees the freshest value.
+ *
+ * Buffers are recycled rather than reallocated, so a T holding a cv::Mat is
+ * refilled in place once the three buffers have reached the frame size.
+ */
+template <typename T>
+class LatestFrameSlot {
+public:
+    LatestFrameSlot() : middle_state_(1), back_index_(0), front_index_(2) {}
+
+    LatestFrameSlot(const LatestFrameSlot&) = delete;
+    LatestFrameSlot& operator=(const LatestFrameSlot&) = delete;
+
+    /**
+     * Buffer the producer fills before calling publish() (producer thread only)
+     */
+    T& writeBuffer() { return buffers_[back_index_]; }
+
+    /**
+     * Make the write buffer the latest value (producer thread only)
+     * Returns true if an unread value was replaced, i.e. the consumer fell behind.
+     */
+    bool publish() {
+        uint8_t previous = middle_state_.exchange(static_cast<uint8_t>(back_index_ | FRESH_FLAG),
+                                                  std::memory_order_acq_rel);
+        back_index_ = previous & INDEX_MASK;
+        return (previous & FRESH_FLAG) != 0;
+    }
+
+    /**
+     * Take the latest value if one was published since the last call (consumer thread only)
+     * Returns nullptr without blocking when nothing new is available. The
+     * returned buffer stays valid and untouched until the next consume().
+     */
+    const T* consume() {
+        if ((middle_state_.load(std::memory_order_acquire) & FRESH_FLAG) == 0) {
+            return nullptr;
+        }
+        uint8_t previous = middle_state_.exchange(front_index_, std::memory_order_acq_rel);
+        front_index_ = previous & INDEX_MASK;
+        return &buffers_[front_index_];
+    }
+
+    /**
+     * Check whether a value was published since the last consume()
+     */
+    bool hasFresh() const {
+        return (middle_state_.load(std::memory_order_acquire) & FRESH_FLAG) != 0;
+    }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH_FLAG = 0x4;
+
+    std::array<T, 3> buffers_;
+    std::atomic<uint8_t> middle_state_;  // Index of the published buffer | FRESH_FLAG if unread
+    uint8_t back_index_;                 // Owned by the producer
+    uint8_t front_index_;                // Owned by the consumer
+};
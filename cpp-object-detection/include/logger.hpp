@@ -69,6 +69,11 @@ public:
     void warning(const std::string& message);
     void error(const std::string& message);
     
+    /**
+     * Whether debug() writes anything; check it before building debug messages on hot paths
+     */
+    bool isDebugEnabled() const { return verbose_; }
+    
     /**
      * Record a detection event for hourly summary
      */
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <cstddef>
+#include "detection_model_interface.hpp"
+
+/**
+ * Pool of independently initialized detection model replicas
+ *
+ * A cv::dnn::Net is not safe to call from several threads at once, so
+ * parallel frame processing needs one network instance per concurrent
+ * inference. Workers check out a replica for the duration of a forward
+ * pass and hand it back afterwards; when replicas are exhausted, callers
+ * block until one is released.
+ *
+ * The pool does not own the models - the owner (ObjectDetector) keeps
+ * them alive for at least as long as the pool exists.
+ */
+class ModelReplicaPool {
+public:
+    /**
+     * RAII handle to a checked-out replica, returned to the pool on destruction
+     */
+    class Lease {
+    public:
+        Lease() : pool_(nullptr), model_(nullptr) {}
+        Lease(ModelReplicaPool* pool, IDetectionModel* model) : pool_(pool), model_(model) {}
+        ~Lease() { reset(); }
+
+        Lease(Lease&& other) noexcept : pool_(other.pool_), model_(other.model_) {
+            other.pool_ = nullptr;
+            other.model_ = nullptr;
+        }
+        Lease& operator=(Lease&& other) noexcept {
+            if (this != &other) {
+                reset();
+                pool_ = other.pool_;
+                model_ = other.model_;
+                other.pool_ = nullptr;
+                other.model_ = nullptr;
+            }
+            return *this;
+        }
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        IDetectionModel* get() const { return model_; }
+        IDetectionModel* operator->() const { return model_; }
+        IDetectionModel& operator*() const { return *model_; }
+        explicit operator bool() const { return model_ != nullptr; }
+
+        /**
+         * Return the replica to the pool early
+         */
+        void reset();
+
+    private:
+        ModelReplicaPool* pool_;
+        IDetectionModel* model_;
+    };
+
+    explicit ModelReplicaPool(const std::vector<IDetectionModel*>& replicas);
+
+    /**
+     * Check out a replica, blocking until one is available
+     */
+    Lease acquire();
+
+    /**
+     * Check out a replica without blocking
+     * Returns an empty lease if all replicas are busy
+     */
+    Lease tryAcquire();
+
+    /**
+     * Total number of replicas managed by the pool
+     */
+    size_t size() const { return replicas_.size(); }
+
+    /**
+     * Number of replicas currently free
+     */
+    size_t available() const;
+
+private:
+    std::vector<IDetectionModel*> replicas_;
+    std::vector<IDetectionModel*> free_replicas_;
+    mutable std::mutex mutex_;
+    std::condition_variable available_condition_;
+
+    void release(IDetectionModel* model);
+};
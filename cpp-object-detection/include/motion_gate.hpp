@@ -0,0 +1,86 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include "logger.hpp"
+
+/**
+ * Cheap pre-inference motion check that lets the DNN skip empty, static scenes
+ *
+ * Each frame is reduced to a tiny grayscale image (160x90) and compared with
+ * a running-average background. If fewer than changed_fraction of its pixels
+ * differ by more than pixel_threshold, nothing moved. Inference is skipped
+ * only when nothing moved AND the last inferred frame had no moving target
+ * objects; in addition a full inference is forced every refresh_seconds so a
+ * slow change the background absorbed is still picked up.
+ *
+ * shouldRunInference() must be called from a single thread (the one
+ * submitting frames); the statistics may be read from any thread.
+ */
+class MotionGate {
+public:
+    struct Stats {
+        uint64_t frames_checked = 0;
+        uint64_t frames_skipped = 0;
+        uint64_t forced_refreshes = 0;  // Static frames inferred anyway because refresh_seconds elapsed
+        double skip_rate = 0.0;         // frames_skipped / frames_checked
+        double avg_gate_ms = 0.0;       // Cost of the gate itself per frame
+        double last_changed_fraction = 0.0;
+    };
+
+    MotionGate(std::shared_ptr<Logger> logger,
+               double changed_fraction = 0.005,
+               int pixel_threshold = 25,
+               int refresh_seconds = 10);
+
+    /**
+     * Decide whether the frame needs a DNN pass
+     * @param objects_active true while the last inferred frame held moving target objects
+     * @param mask Optional GATE_WIDTH x GATE_HEIGHT mask; changes where it is 0 are ignored
+     */
+    bool shouldRunInference(const cv::Mat& frame, bool objects_active, const cv::Mat& mask = cv::Mat());
+
+    /**
+     * Forget the background (e.g. after the camera was reopened)
+     */
+    void reset();
+
+    Stats getStats() const;
+
+    /**
+     * Log skip counts and the inference time they saved
+     * @param avg_inference_ms Average inference time of the frames that did run
+     */
+    void logStats(double avg_inference_ms) const;
+
+    /**
+     * Count bytes of a and b differing by more than threshold (SIMD where available)
+     */
+    static int countChangedPixels(const uchar* a, const uchar* b, int count, int threshold);
+
+    static constexpr int GATE_WIDTH = 160;   // 16:9 like the 720p camera, ~14k pixels to compare
+    static constexpr int GATE_HEIGHT = 90;
+
+private:
+    std::shared_ptr<Logger> logger_;
+    double changed_fraction_;
+    int pixel_threshold_;
+    std::chrono::seconds refresh_interval_;
+
+    cv::Mat small_color_;   // Reused downsampling buffers
+    cv::Mat small_gray_;
+    cv::Mat background_;        // CV_32F running average
+    cv::Mat background_gray_;   // CV_8U copy compared against each frame
+    std::chrono::steady_clock::time_point last_inference_;
+
+    std::atomic<uint64_t> frames_checked_;
+    std::atomic<uint64_t> frames_skipped_;
+    std::atomic<uint64_t> forced_refreshes_;
+    std::atomic<double> total_gate_ms_;
+    std::atomic<double> last_changed_fraction_;
+
+    static constexpr double BACKGROUND_LEARNING_RATE = 0.05;  // Background follows lighting over ~20 frames
+};
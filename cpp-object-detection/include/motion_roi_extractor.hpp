@@ -0,0 +1,106 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "logger.hpp"
+
+/**
+ * Finds the parts of a frame worth running the detector on
+ *
+ * A MOG2 background subtractor runs on a 320-pixel-wide copy of each frame.
+ * Its foreground blobs are padded, merged until at most max_regions remain,
+ * grown to at least min_region_size and mapped back to frame coordinates.
+ * Each region is then inferred as a native-resolution crop, so a distant
+ * person covering 40 pixels is not shrunk by detection_scale_factor first.
+ *
+ * The background model absorbs anything that stops moving, so the caller
+ * also passes the boxes of the objects it is still tracking. They are padded
+ * and merged like blobs, which keeps a person sitting still in view inferred
+ * instead of letting the track expire and come back as a new object.
+ *
+ * An empty result means "infer the full frame": no motion at all, the
+ * background model still warming up, or regions covering more than
+ * max_coverage of the frame (where one full-frame pass is cheaper).
+ *
+ * extract() must be called from a single thread (the one submitting
+ * frames); the statistics may be read from any thread.
+ */
+class MotionRoiExtractor {
+public:
+    struct Stats {
+        uint64_t frames_checked = 0;
+        uint64_t region_frames = 0;      // Frames inferred as region crops
+        double avg_regions = 0.0;        // Regions per region frame
+        double avg_coverage = 0.0;       // Fraction of the frame inferred per region frame
+    };
+
+    MotionRoiExtractor(std::shared_ptr<Logger> logger,
+                       int max_regions = 4,
+                       int min_region_size = 256,
+                       double max_coverage = 0.5);
+
+    /**
+     * Get regions to infer instead of the full frame
+     * @param track_boxes Boxes of tracked objects in frame coordinates, inferred whether or not they move
+     * @param mask Optional analysisSize() mask; motion where it is 0 is ignored
+     * @return Non-overlapping regions in frame coordinates, or empty for a full-frame pass
+     */
+    std::vector<cv::Rect> extract(const cv::Mat& frame, const std::vector<cv::Rect>& track_boxes = {},
+                                  const cv::Mat& mask = cv::Mat());
+
+    /**
+     * Size of the copy the background model runs on for frames of frame_size
+     */
+    static cv::Size analysisSize(const cv::Size& frame_size);
+
+    Stats getStats() const;
+
+    /**
+     * Log how many frames were inferred as crops and how much of the frame they covered
+     */
+    void logStats() const;
+
+    /**
+     * Grow a box by padding times its size on every side, clipped to bounds
+     */
+    static cv::Rect padRegion(const cv::Rect& box, double padding, const cv::Rect& bounds);
+
+    /**
+     * Merge boxes closer than gap pixels, then the pairs with the smallest
+     * union, until no two boxes overlap and at most max_regions remain
+     */
+    static std::vector<cv::Rect> mergeRegions(std::vector<cv::Rect> boxes, int gap, size_t max_regions);
+
+    /**
+     * Grow a box around its center to at least min_size per side, shifted to stay inside frame_size
+     */
+    static cv::Rect expandRegion(const cv::Rect& box, int min_size, const cv::Size& frame_size);
+
+    static constexpr int ANALYSIS_WIDTH = 320;  // Background model resolution
+
+private:
+    std::shared_ptr<Logger> logger_;
+    int max_regions_;
+    int min_region_size_;
+    double max_coverage_;
+
+    cv::Ptr<cv::BackgroundSubtractorMOG2> subtractor_;
+    cv::Mat small_;       // Reused buffers
+    cv::Mat foreground_;
+    cv::Mat kernel_;
+    std::vector<std::vector<cv::Point>> contours_;
+
+    std::atomic<uint64_t> frames_checked_;
+    std::atomic<uint64_t> region_frames_;
+    std::atomic<uint64_t> total_regions_;
+    std::atomic<double> total_coverage_;
+
+    static constexpr int MOG2_HISTORY = 300;          // ~1 minute of background at 5 fps
+    static constexpr double MOG2_VAR_THRESHOLD = 25.0;
+    static constexpr int FOREGROUND_THRESHOLD = 200;  // MOG2 marks shadows 127; keep only solid foreground
+    static constexpr double MIN_BLOB_FRACTION = 0.0005;  // Ignore specks below 0.05% of the frame
+    static constexpr double REGION_PADDING = 0.25;    // Context added around each blob, per side
+};
@@ -35,6 +35,12 @@ public:
      */
     void updateFrame(const cv::Mat& frame, const std::vector<Detection>& detections);
     
+    /**
+     * Update the current frame with an already encoded camera JPEG
+     * The bytes are sent to clients as-is, without decoding or re-encoding.
+     */
+    void updateEncodedFrame(const std::vector<uchar>& jpeg);
+    
     /**
      * Update the current frame with statistics overlay
      */
@@ -81,6 +87,7 @@ private:
     
     // Frame management
     cv::Mat current_frame_;
+    std::vector<uchar> current_jpeg_;  // Set instead of current_frame_ for passthrough frames
     std::mutex frame_mutex_;
     
     // Server thread
@@ -110,6 +117,5 @@ private:
                       bool burst_mode_enabled = false,
                       double disk_usage_percent = -1.0,
                       double cpu_temp_celsius = -1.0);
-    cv::Scalar getColorForClass(const std::string& class_name) const;
     std::string getLocalIpAddress() const;
 };
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+/**
+ * Class-aware non-maximum suppression with reusable scratch memory
+ *
+ * Boxes only suppress boxes of the same class, so e.g. a person riding a
+ * bicycle keeps both detections. Boxes are bucketed per class by sorting an
+ * index array in place; each bucket is copied into contiguous coordinate
+ * arrays so IoU against the remaining boxes runs as a SIMD row kernel.
+ *
+ * All buffers keep their capacity between frames, so after warm-up a frame
+ * performs no allocations. One engine per model instance - not thread-safe.
+ *
+ * Usage:
+ *   nms.clear();
+ *   nms.add(box, score, class_id);  // for each candidate
+ *   for (int index : nms.suppress(0.45f)) { ... }  // indices in add() order
+ */
+class NmsEngine {
+public:
+    NmsEngine() = default;
+
+    /**
+     * Drop all boxes from the previous frame (capacity is kept)
+     */
+    void clear();
+
+    /**
+     * Reserve room for the expected number of boxes per frame
+     */
+    void reserve(size_t count);
+
+    /**
+     * Add a candidate box
+     * @return Index used to refer to this box in suppress() results
+     */
+    int add(const cv::Rect& box, float score, int class_id);
+
+    /**
+     * Run per-class NMS over the added boxes
+     * @param iou_threshold Boxes overlapping a higher-scoring box of the same
+     *                      class by more than this IoU are removed
+     * @return Indices of surviving boxes, highest score first. The reference
+     *         stays valid until the next call to clear() or suppress().
+     */
+    const std::vector<int>& suppress(float iou_threshold);
+
+    /**
+     * Number of boxes added since the last clear()
+     */
+    size_t size() const { return scores_.size(); }
+
+    /**
+     * Box, score and class of an added box by index
+     */
+    cv::Rect box(int index) const {
+        return cv::Rect(cv::Point(static_cast<int>(x1_[index]), static_cast<int>(y1_[index])),
+                        cv::Point(static_cast<int>(x2_[index]), static_cast<int>(y2_[index])));
+    }
+    float score(int index) const { return scores_[index]; }
+    int classId(int index) const { return class_ids_[index]; }
+
+    /**
+     * Intersection-over-union of two boxes (0 if either is empty)
+     */
+    static float iou(const cv::Rect& a, const cv::Rect& b);
+
+private:
+    // Input boxes in add() order (structure of arrays)
+    std::vector<float> x1_, y1_, x2_, y2_;
+    std::vector<float> scores_;
+    std::vector<int> class_ids_;
+
+    // Per-frame scratch
+    std::vector<int> order_;                 // Indices sorted by (class, score desc)
+    std::vector<float> bx1_, by1_, bx2_, by2_, barea_;  // Current bucket, contiguous
+    std::vector<float> overlap_;             // Kernel output for one row
+    std::vector<unsigned char> suppressed_;
+    std::vector<int> keep_;
+
+    void suppressBucket(size_t begin, size_t end, float iou_threshold);
+};
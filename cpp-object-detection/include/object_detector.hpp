@@ -5,10 +5,16 @@
 #include <string>
 #include <map>
 #include <memory>
-#include <deque>
 #include <chrono>
+#include <cstdint>
+#include <mutex>
 #include "logger.hpp"
+#include "box_kalman_filter.hpp"
+#include "class_registry.hpp"
+#include "track_assignment.hpp"
+#include "tracker_table.hpp"
 #include "detection_model_interface.hpp"
+#include "model_replica_pool.hpp"
 
 /**
  * Object detection orchestrator using pluggable detection models
@@ -17,11 +23,19 @@
  */
 class ObjectDetector {
 public:
+    /**
+     * Snapshot of one track, as handed out by getTrackedObjects()
+     */
     struct ObjectTracker {
-        std::string object_type;
-        cv::Point2f center;
+        uint64_t id = 0;  // Unique per detector, stable for the life of the track
+        int class_id = -1;  // ClassRegistry id; ClassRegistry::name() gives the object type
+        cv::Point2f center;  // Center of the last matched detection
+        cv::Rect bbox;  // Latest box: as detected on inferred frames, Kalman-predicted in between
+        float confidence = 0.0f;  // Confidence of the last matched detection
+        BoxKalmanFilter motion;  // Constant-velocity box state as of last_detection_time
+        std::chrono::steady_clock::time_point last_detection_time;
         cv::Point2f previous_center;  // Track previous position for movement detection
-        std::deque<cv::Point2f> position_history;  // Track path of object movement
+        PositionHistory position_history;  // Track path of object movement, oldest first
         bool was_present_last_frame;
         int frames_since_detection;
         bool is_new;  // Flag to indicate if this is a newly entered object
@@ -29,7 +43,7 @@ public:
         std::chrono::steady_clock::time_point stationary_since;  // When object became stationary
         
         // Constants for movement history tracking
-        static constexpr size_t MAX_POSITION_HISTORY = 10;  // Keep last 10 positions
+        static constexpr size_t MAX_POSITION_HISTORY = PositionHistory::CAPACITY;  // Keep last 10 positions
         static constexpr float STATIONARY_MOVEMENT_THRESHOLD = 10.0f;  // Max avg movement (pixels) to be stationary
     };
 
@@ -42,6 +56,14 @@ public:
                   double detection_scale_factor = 1.0,
                   bool enable_gpu = false);
     
+    /**
+     * Create a detector that tracks objects independently but runs inference
+     * on model_owner's model replicas, so several cameras need only one model
+     * in memory. initialize() loads nothing; switchModel() must be called on
+     * the owner instead.
+     */
+    ObjectDetector(std::shared_ptr<ObjectDetector> model_owner, std::shared_ptr<Logger> logger);
+    
     ~ObjectDetector();
 
     /**
@@ -51,9 +73,47 @@ public:
     
     /**
      * Detect objects in a frame
+     * Thread-safe: each call runs on a replica checked out from the model pool
      */
     std::vector<Detection> detectObjects(const cv::Mat& frame);
     
+    /**
+     * Detect objects in several frames with one replica and, where the model
+     * supports it, a single batched forward pass
+     * Thread-safe like detectObjects(). Returns one detection list per frame.
+     */
+    std::vector<std::vector<Detection>> detectObjectsBatch(const std::vector<cv::Mat>& frames);
+    
+    /**
+     * Detect objects in regions of a frame, each cropped at native resolution
+     * The detection scale factor is not applied to the crops, so small or
+     * distant objects inside a region keep full detail. Regions should not
+     * overlap. Thread-safe like detectObjects().
+     * @param origins Frame position of each region when frame is a packed copy of
+     *                the regions rather than the frame itself; empty otherwise
+     * @return Detections of all regions in frame coordinates
+     */
+    std::vector<Detection> detectObjectsInRegions(const cv::Mat& frame, const std::vector<cv::Rect>& regions,
+                                                  const std::vector<cv::Point>& origins = {});
+    
+    /**
+     * Set the number of independent model replicas to create on initialize()
+     * Each replica owns its own network so that several worker threads can
+     * run inference concurrently. Must be called before initialize().
+     */
+    void setInferenceReplicas(int replicas);
+    
+    /**
+     * Set the inference backend and its tuning options for models created on
+     * initialize() and switchModel(). Must be called before initialize().
+     */
+    void setBackendOptions(const DetectionModelFactory::BackendOptions& options);
+    
+    /**
+     * Get the number of initialized model replicas available for inference
+     */
+    size_t getInferenceReplicaCount() const;
+    
     /**
      * Process frame and track object enter/exit events
      */
@@ -69,11 +129,25 @@ public:
      */
     bool isTargetClass(const std::string& class_name) const;
     
+    /**
+     * Check if a detection is of a target class, by its class id
+     */
+    bool isTargetClass(const Detection& detection) const {
+        return ClassRegistry::contains(target_class_set_, detection.class_id);
+    }
+    
     /**
      * Get current model information and performance metrics
      */
     ModelMetrics getModelMetrics() const;
     
+    /**
+     * Get the size a frame is reduced to before detectObjects() runs the network
+     * Follows the detection scale factor and the model's input size. Returns the
+     * frame size itself if the frame is inferred at full resolution.
+     */
+    cv::Size getDetectionResolution(const cv::Size& frame_size) const;
+    
     /**
      * Switch to a different detection model
      */
@@ -95,17 +169,60 @@ public:
     std::vector<std::pair<std::string, int>> getTopDetectedObjects(int top_n = 10) const;
      
     /*
-     * Get currently tracked objects
+     * Get currently tracked objects, oldest track first
+     * Tracks live in a slot table; this copies them out into records, once per
+     * tracking update however often it is called. The reference stays valid
+     * until the next updateTracking(), predictTracks() or moveTracks().
+     */
+    const std::vector<ObjectTracker>& getTrackedObjects() const;
+    
+    /**
+     * Same records as getTrackedObjects(), kept alive for as long as the caller holds them
+     * Meant for handing tracker state to other threads without copying it.
+     * Snapshot buffers nobody holds any more are refilled in place, so a
+     * steady pipeline cycles through a few buffers without allocating.
      */
-    const std::vector<ObjectTracker>& getTrackedObjects() const { return tracked_objects_; }
+    std::shared_ptr<const std::vector<ObjectTracker>> shareTrackedObjects() const;
     
     /**
      * Update object tracking with new detections
+     * @param timestamp Capture time of the frame the detections come from
      */
-    void updateTracking(const std::vector<Detection>& detections) {
-        updateTrackedObjects(detections);
+    void updateTracking(const std::vector<Detection>& detections,
+                        std::chrono::steady_clock::time_point timestamp = std::chrono::steady_clock::now()) {
+        updateTrackedObjects(detections, timestamp);
     }
     
+    /**
+     * Advance tracks to a frame that was not inferred
+     * Each track's box is extrapolated from its Kalman state. Tracks whose
+     * predicted box has left the frame, or that have gone undetected for too
+     * long, exit now rather than at the next inference.
+     * @param timestamp Capture time of the frame
+     * @param frame_size Camera frame size for the exit check (empty to skip it)
+     * @param present Set to the predicted boxes of the objects present on the last inferred frame
+     */
+    void predictTracks(std::chrono::steady_clock::time_point timestamp, const cv::Size& frame_size,
+                       std::vector<Detection>& present);
+    
+    /**
+     * Boxes of the objects present on the last inferred frame, indexed by track slot
+     * Slots without such an object get an empty box. This is the layout
+     * moveTracks() takes, so boxes can be followed (e.g. by optical flow) and
+     * handed back without a lookup by track id.
+     */
+    void presentTrackBoxes(std::vector<cv::Rect>& boxes) const;
+    
+    /**
+     * Move tracks to boxes measured on a frame that was not inferred (e.g. by optical flow)
+     * This is not a detection: misses, exits and the Kalman state are left alone.
+     * @param boxes New boxes indexed as presentTrackBoxes() filled them
+     * @param timestamp Capture time of the frame; tracks with an empty or no box are predicted to it
+     * @param present Set to the boxes of the objects present on the last inferred frame
+     */
+    void moveTracks(const std::vector<cv::Rect>& boxes, std::chrono::steady_clock::time_point timestamp,
+                    std::vector<Detection>& present);
+    
     /**
      * Enrich detections with stationary status from tracked objects
      * This should be called after updateTracking() to populate the is_stationary flag
@@ -131,24 +248,58 @@ private:
     bool enable_gpu_;
     std::shared_ptr<Logger> logger_;
     DetectionModelFactory::ModelType model_type_;
+    DetectionModelFactory::BackendOptions backend_options_;
     std::shared_ptr<class GoogleSheetsClient> google_sheets_client_;  // Optional Google Sheets integration
+    std::shared_ptr<ObjectDetector> model_owner_;  // Set when inference is delegated to a shared model
     
     std::unique_ptr<IDetectionModel> detection_model_;
-    std::vector<ObjectTracker> tracked_objects_;
+    std::vector<std::unique_ptr<IDetectionModel>> model_replicas_;  // Additional replicas beyond detection_model_
+    std::unique_ptr<ModelReplicaPool> replica_pool_;
+    int inference_replicas_;
+    ClassRegistry::ClassSet target_class_set_;  // getTargetClasses() by class id
+    TrackerTable trackers_;
+    uint64_t next_track_id_;
+    // Records built on demand by getTrackedObjects(): the current buffer, and
+    // older ones that stay allocated for reuse once their holders let go
+    mutable std::vector<std::shared_ptr<std::vector<ObjectTracker>>> snapshots_;
+    mutable size_t current_snapshot_;
+    mutable bool snapshot_stale_;
+    
+    // Matching buffers reused by every tracking update
+    TrackAssignment::GridIndex match_grid_;
+    std::vector<TrackAssignment::Edge> match_edges_;
+    TrackAssignment::Workspace match_workspace_;
+    std::vector<int> match_assignment_;
+    std::vector<int> match_candidates_;
+    std::vector<cv::Point2f> detection_centers_;
+    std::vector<int> detection_class_ids_;
+    std::vector<int> cleanup_order_;
     
     bool initialized_;
     
     // Statistics tracking with bounded growth
     int total_objects_detected_;
     std::map<std::string, int> object_type_counts_;
+    mutable std::mutex stats_mutex_;  // Guards statistics only, not tracker state
     
     // Limits to prevent unbounded growth
     static constexpr size_t MAX_TRACKED_OBJECTS = 100;  // Reasonable limit for concurrent objects
     static constexpr int MAX_OBJECT_TYPE_ENTRIES = 50;   // Limit different object types tracked
+    static constexpr int MAX_MISSED_FRAMES = 30;         // Inferred frames without a match before a track exits
+    static constexpr double MAX_MISSING_SECONDS = 6.0;   // Same, in time, for low inference rates...
+    static constexpr int MIN_MISSES_FOR_TIMEOUT = 3;     // ...once the track has missed this many inferred frames
+    static constexpr double MAX_PREDICTION_SECONDS = 2.0;  // Boxes stop moving this long after the last detection
     
-    void updateTrackedObjects(const std::vector<Detection>& detections);
+    std::unique_ptr<IDetectionModel> createInitializedModel(DetectionModelFactory::ModelType type);
+    void rebuildReplicaPool();
+    void reserveTrackingBuffers();
+    void updateTrackedObjects(const std::vector<Detection>& detections, std::chrono::steady_clock::time_point timestamp);
+    cv::Rect predictBox(int slot, std::chrono::steady_clock::time_point timestamp) const;
+    void removeExitedTrackers(std::chrono::steady_clock::time_point timestamp, const cv::Size& frame_size);
+    void presentTrackDetections(std::vector<Detection>& present) const;
+    void refreshSnapshot() const;
     void logObjectEvents(const std::vector<Detection>& current_detections);
     void cleanupOldTrackedObjects();
     void limitObjectTypeCounts();
-    void updateStationaryStatus(ObjectTracker& tracker);
+    void updateStationaryStatus(int slot);
 };
\ No newline at end of file
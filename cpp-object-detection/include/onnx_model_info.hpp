@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Lightweight inspection of ONNX model files
+ *
+ * Walks the protobuf wire format just far enough to find the graph's node
+ * types, initializer data types and first input's element type, so the models
+ * can tell FP32, FP16 and INT8-quantized exports apart before loading them.
+ * No protobuf/onnx dependency is needed; weights are skipped, not decoded.
+ */
+namespace OnnxModelInfo {
+
+enum class Precision {
+    FP32,
+    FP16,   // float16 weights (and usually float16 input/output tensors)
+    INT8    // Quantized: QDQ or QOperator format
+};
+
+enum class QuantFormat {
+    NONE,
+    QDQ,        // QuantizeLinear/DequantizeLinear pairs around float ops (quantize_static default)
+    QOPERATOR   // Integer operators such as QLinearConv / ConvInteger
+};
+
+// ONNX TensorProto.DataType values used here
+constexpr int ELEM_TYPE_FLOAT = 1;
+constexpr int ELEM_TYPE_UINT8 = 2;
+constexpr int ELEM_TYPE_INT8 = 3;
+constexpr int ELEM_TYPE_FLOAT16 = 10;
+
+struct Summary {
+    bool valid = false;               // False if the file could not be read or parsed
+    Precision precision = Precision::FP32;
+    QuantFormat quant_format = QuantFormat::NONE;
+    int input_elem_type = 0;          // Element type of the first graph input (0 = unknown)
+    int node_count = 0;
+    int quantize_nodes = 0;           // QuantizeLinear
+    int dequantize_nodes = 0;         // DequantizeLinear
+    int integer_op_nodes = 0;         // QLinear* / *Integer operators
+    int float_initializers = 0;
+    int float16_initializers = 0;
+};
+
+/**
+ * Inspect an ONNX model file
+ */
+Summary inspect(const std::string& model_path);
+
+/**
+ * Inspect a serialized ONNX ModelProto held in memory
+ */
+Summary inspectBuffer(const uint8_t* data, size_t size);
+
+/**
+ * Human-readable precision, e.g. "FP32", "FP16" or "INT8 (QDQ)"
+ */
+std::string describe(const Summary& summary);
+
+}  // namespace OnnxModelInfo
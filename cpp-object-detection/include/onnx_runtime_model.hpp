@@ -0,0 +1,100 @@
+#pragma once
+
+#include "detection_model_interface.hpp"
+#include "logger.hpp"
+#include "yolo_utils.hpp"
+#include "nms_engine.hpp"
+#include <onnxruntime_cxx_api.h>
+#include <chrono>
+
+/**
+ * YOLO model running on ONNX Runtime (CPU execution provider)
+ *
+ * Loads the same .onnx files as the OpenCV DNN models and shares their
+ * letterbox preprocessing, output decoding and NMS, so only the forward pass
+ * differs between backends. Handles both the YOLOv5 [1, N, 5 + classes] and
+ * the YOLOv8 [1, 4 + classes, N] output layouts depending on the model type,
+ * and batches frames into one Run() when the model's batch axis is dynamic.
+ *
+ * Only compiled when ONNX Runtime is found at build time (HAVE_ONNXRUNTIME).
+ */
+class OnnxRuntimeModel : public IDetectionModel {
+public:
+    OnnxRuntimeModel(std::shared_ptr<Logger> logger,
+                     DetectionModelFactory::ModelType model_type,
+                     const DetectionModelFactory::BackendOptions& options);
+    ~OnnxRuntimeModel() override = default;
+
+    bool initialize(const std::string& model_path,
+                   const std::string& config_path,
+                   const std::string& classes_path,
+                   double confidence_threshold,
+                   double detection_scale_factor = 1.0) override;
+
+    std::vector<Detection> detect(const cv::Mat& frame) override;
+    
+    std::vector<Detection> detectRegion(const cv::Mat& crop) override;
+
+    std::vector<std::vector<Detection>> detectBatch(const std::vector<cv::Mat>& frames) override;
+
+    ModelMetrics getMetrics() const override;
+
+    std::vector<std::string> getSupportedClasses() const override;
+
+    bool isInitialized() const override;
+
+    std::string getModelName() const override;
+
+    int getInputSize() const override;
+
+    void warmUp() override;
+
+    void setTargetClasses(const std::vector<std::string>& class_names) override;
+
+private:
+    std::shared_ptr<Logger> logger_;
+    DetectionModelFactory::ModelType model_type_;
+    DetectionModelFactory::BackendOptions options_;
+    bool anchor_free_;         // YOLOv8 layout (no objectness, channel-major)
+    std::string short_name_;   // e.g. "YOLOv5s/ORT" for log messages
+    std::unique_ptr<Ort::Session> session_;
+    Ort::MemoryInfo memory_info_;
+    std::string input_name_;
+    std::string output_name_;
+    int fixed_input_size_;     // Input size baked into the model, 0 if the spatial axes are dynamic
+    bool dynamic_batch_;       // Batch axis is dynamic, so several frames can share one Run()
+    bool half_input_;          // FP16 export without keep_io_types: feed float16 tensors
+    std::vector<std::string> class_names_;
+    std::vector<int> registry_ids_;  // ClassRegistry id of each model class
+    double confidence_threshold_;
+    double detection_scale_factor_;
+    bool initialized_;
+    cv::Mat resize_buffer_;    // Reused preprocessing buffers (one model instance per worker)
+    cv::Mat input_blob_;
+    YoloUtils::Batch batch_;   // Reused by detectBatch()
+    cv::Mat half_blob_;        // float16 copy of input_blob_ for half-precision models
+    cv::Mat output_buffer_;    // float32 copy of half-precision outputs
+    std::vector<float> best_scores_;
+    std::vector<YoloUtils::Candidate> candidates_;
+    NmsEngine nms_;
+    std::vector<std::string> target_class_names_;
+    std::vector<int> target_class_ids_;  // Empty = score all classes
+    mutable int avg_inference_time_ms_;
+
+    static constexpr int NOMINAL_INPUT_SIZE = 640;
+    static constexpr float SCALE_FACTOR = 1.0 / 255.0;
+    static constexpr float NMS_IOU_THRESHOLD = 0.45f;
+
+    bool loadClassNames(const std::string& classes_path);
+    bool loadModel(const std::string& model_path);
+    std::vector<Detection> detectScaled(const cv::Mat& frame, double scale_factor);
+    std::vector<Detection> runNetwork(const cv::Mat& frame, int input_size);
+    void runBatch(const std::vector<cv::Mat>& frames, std::vector<std::vector<Detection>>& results);
+    const float* runSession(int batch_size, int input_size, std::vector<Ort::Value>& outputs,
+                            std::vector<int64_t>& shape);
+    std::vector<Detection> postProcess(const cv::Mat& frame,
+                                     const YoloUtils::Letterbox& letterbox,
+                                     const float* output,
+                                     const std::vector<int64_t>& shape);
+    void updateInferenceTime(int inference_time_ms) const;
+};
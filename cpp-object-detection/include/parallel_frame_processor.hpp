@@ -14,17 +14,73 @@
 #include "logger.hpp"
 #include "performance_monitor.hpp"
 #include "detection_model_interface.hpp"
+#include "frame_sequencer.hpp"
+#include "inference_scheduler.hpp"
+#include "motion_gate.hpp"
+#include "motion_roi_extractor.hpp"
+#include "tiled_inference.hpp"
+#include "detection_zones.hpp"
+#include "flow_tracker.hpp"
 
 /**
  * Parallel frame processor that can handle multiple frames concurrently
  * while maintaining sequential processing order
+ *
+ * Pipeline in parallel mode:
+ *   submitFrame() -> frame_queue_ -> N inference workers (lock-free, one model replica each)
+ *                 -> FrameSequencer (reorder by capture sequence)
+ *                 -> single tracking thread (tracking, stationary status, photos) -> future
+ *
+ * With batching enabled, a worker that wakes up waits briefly for the queue to
+ * fill, drains up to max_batch_size frames and runs them through one
+ * [N, 3, H, W] forward pass; results are scattered back per frame before the
+ * sequencer, so ordering and futures behave exactly as with batches of one.
+ *
+ * With a shared InferenceScheduler (multi-camera), the processor starts no
+ * inference workers of its own: frames go to the scheduler's queue for this
+ * camera and come back into the sequencer, while tracking and photos stay
+ * per camera.
+ *
+ * With a MotionGate, submitFrame() first checks the frame for motion; a
+ * static scene without moving target objects skips inference and passes
+ * through the sequencer with no detections.
+ *
+ * With a MotionRoiExtractor, submitFrame() also looks for motion regions;
+ * when there are a few, inference runs on native-resolution crops of them
+ * instead of the scaled-down full frame.
+ *
+ * With TiledInference, frames inferred whole are split into overlapping
+ * native-resolution tiles (and run one at a time, never batched).
+ *
+ * With DetectionZones, pixels outside the analyzed area are blacked out
+ * before the motion checks and inference, and detections outside it are
+ * dropped before tracking, so they never reach photos or notifications.
  */
 class ParallelFrameProcessor {
 public:
     struct FrameResult {
-        std::chrono::high_resolution_clock::time_point capture_time;
+        std::chrono::steady_clock::time_point capture_time;
         bool processed;
         std::vector<Detection> detections;
+        uint64_t sequence = 0;  // Capture order of the frame
+        // No inference ran (static scene, or between inference frames); detections are
+        // the tracks predicted onto this frame and no photos or new-object events result
+        bool inference_skipped = false;
+        // Tracker state right after this frame was applied, so consumers never
+        // read the live tracker while the tracking thread is mutating it. Shared,
+        // not copied: frames between two tracking updates get the same records
+        std::shared_ptr<const std::vector<ObjectDetector::ObjectTracker>> tracked_objects;
+    };
+
+    /**
+     * Full-resolution camera JPEG behind a reduced-scale frame
+     * When a submitted frame was decoded at 1/decode_scale of the camera
+     * resolution, its detections are mapped back to camera coordinates and
+     * the full frame is decoded only if a detection photo is actually saved.
+     */
+    struct FullResolutionSource {
+        std::vector<uchar> jpeg;
+        int decode_scale = 1;
     };
 
     ParallelFrameProcessor(std::shared_ptr<ObjectDetector> detector,
@@ -43,16 +99,102 @@ public:
      */
     bool initialize();
     
+    /**
+     * Enable batched inference in parallel mode
+     * Workers drain up to max_batch_size queued frames per forward pass, waiting
+     * at most batch_timeout_ms for a burst to fill the batch. A batch size of 1
+     * (the default) forwards every frame on its own. Must be called before initialize().
+     */
+    void setBatching(size_t max_batch_size, int batch_timeout_ms);
+    
+    /**
+     * Get the maximum number of frames per forward pass
+     */
+    size_t getMaxBatchSize() const { return max_batch_size_; }
+    
+    /**
+     * Run inference on a scheduler shared with other cameras instead of own workers
+     * Frames are always processed asynchronously in this mode, whatever num_threads
+     * is. Must be called before initialize().
+     */
+    void setInferenceScheduler(std::shared_ptr<InferenceScheduler> scheduler, int stream_id);
+    
+    /**
+     * Skip inference for frames the gate finds static while no moving target object is in view
+     * Must be called before initialize().
+     */
+    void setMotionGate(std::shared_ptr<MotionGate> gate);
+    
+    /**
+     * Get the motion gate, or null if every frame is inferred
+     */
+    std::shared_ptr<MotionGate> getMotionGate() const { return motion_gate_; }
+    
+    /**
+     * Run inference on every interval-th submitted frame only
+     * The frames in between take their detections from the tracker's Kalman
+     * predictions, so overlays and exits keep the capture rate while the
+     * network runs at a fraction of it. Must be called before initialize().
+     */
+    void setInferenceInterval(int interval);
+    
+    /**
+     * Get the number of submitted frames per inferred frame
+     */
+    int getInferenceInterval() const { return inference_interval_; }
+    
+    /**
+     * Move tracks with optical flow, rather than Kalman predictions, on the
+     * frames between inferences. When flow loses an object or something new
+     * moves into view, the next frame is inferred regardless of the interval.
+     * Must be called before initialize().
+     */
+    void setFlowTracker(std::shared_ptr<FlowTracker> tracker);
+    
+    /**
+     * Infer motion regions as native-resolution crops instead of the full frame
+     * Must be called before initialize().
+     */
+    void setMotionRoiExtractor(std::shared_ptr<MotionRoiExtractor> extractor);
+    
+    /**
+     * Infer whole frames as overlapping high-resolution tiles
+     * Not available with a shared inference scheduler. Must be called before initialize().
+     */
+    void setTiledInference(std::shared_ptr<TiledInference> tiled);
+    
+    /**
+     * Restrict detection to the include zones minus the exclude zones
+     * Must be called before initialize().
+     */
+    void setDetectionZones(std::shared_ptr<DetectionZones> zones);
+    
+    /**
+     * Log motion gate skip counts, motion region, tile and zone usage, where enabled
+     */
+    void logInferenceStats() const;
+    
+    /**
+     * Get the running average inference time per frame in milliseconds
+     */
+    double getAverageInferenceTime() const;
+    
     /**
      * Submit a frame for processing
      * Returns future that will contain the detection results
+     * @param source Full-resolution JPEG if frame is a reduced-scale decode, else nullptr
+     * @param capture_time When the camera read returned; tracking times motion and exits by it
      */
-    std::future<FrameResult> submitFrame(const cv::Mat& frame);
+    std::future<FrameResult> submitFrame(const cv::Mat& frame, const FullResolutionSource* source = nullptr,
+                                         std::chrono::steady_clock::time_point capture_time =
+                                             std::chrono::steady_clock::now());
     
     /**
      * Process a frame synchronously (for single-threaded mode)
      */
-    FrameResult processFrameSync(const cv::Mat& frame);
+    FrameResult processFrameSync(const cv::Mat& frame, const FullResolutionSource* source = nullptr,
+                                 std::chrono::steady_clock::time_point capture_time =
+                                     std::chrono::steady_clock::now());
     
     /**
      * Shutdown the processor and stop all threads
@@ -62,7 +204,7 @@ public:
     /**
      * Check if parallel processing is enabled
      */
-    bool isParallelEnabled() const { return num_threads_ > 1; }
+    bool isParallelEnabled() const { return num_threads_ > 1 || scheduler_ != nullptr; }
     
     /**
      * Get current queue size
@@ -78,6 +220,18 @@ public:
      * Check if brightness filter is currently active
      */
     bool isBrightnessFilterActive() const { return brightness_filter_active_; }
+    
+    /**
+     * Get number of inferred frames waiting in the reorder buffer for an earlier frame
+     */
+    size_t getReorderBacklog() const { return sequencer_.pendingCount(); }
+    
+    /**
+     * Estimate the mean luma (0-255) of an 8-bit frame from every stride-th pixel in each direction
+     */
+    static double estimateBrightness(const cv::Mat& frame, int stride = BRIGHTNESS_SAMPLE_STRIDE);
+    
+    static constexpr int BRIGHTNESS_SAMPLE_STRIDE = 8;
 
 private:
     std::shared_ptr<ObjectDetector> detector_;
@@ -89,6 +243,23 @@ private:
     std::string output_dir_;
     bool enable_brightness_filter_;
     int stationary_timeout_seconds_;  // Timeout before stopping photos of stationary objects
+    size_t max_batch_size_;            // Frames per forward pass (1 = no batching)
+    std::chrono::milliseconds batch_timeout_;  // How long a worker waits for a batch to fill
+    std::shared_ptr<InferenceScheduler> scheduler_;  // Shared multi-camera inference, or null for own workers
+    int stream_id_;
+    std::shared_ptr<MotionGate> motion_gate_;        // Null when every frame is inferred
+    std::shared_ptr<MotionRoiExtractor> roi_extractor_;  // Null when frames are always inferred whole
+    std::shared_ptr<TiledInference> tiled_;          // Null when whole frames go through one forward pass
+    std::shared_ptr<DetectionZones> zones_;          // Null when the whole frame is analyzed
+    std::shared_ptr<FlowTracker> flow_tracker_;      // Null when skipped frames use Kalman predictions
+    std::vector<cv::Rect> flow_boxes_;               // Track boxes by slot, for and from the flow tracker
+    int inference_interval_;                         // Submitted frames per inferred frame
+    uint64_t frames_submitted_;                      // Only touched by the submitting thread
+    std::atomic<bool> keyframe_requested_;           // Flow tracking asks for the next frame to be inferred
+    std::atomic<int> moving_objects_;                // Non-stationary target objects in the last inferred frame
+    std::mutex track_regions_mutex_;
+    std::vector<cv::Rect> track_regions_;            // Camera-coordinate boxes of live tracks, for the ROI extractor
+    std::atomic<double> avg_inference_ms_;           // Exponential moving average over inferred frames
     
     // Photo storage rate limiting
     std::chrono::steady_clock::time_point last_photo_time_;
@@ -99,27 +270,116 @@ private:
     // Track object state from last saved photo
     std::map<std::string, int> last_saved_object_counts_;
     
+    // Frame waiting for an inference worker
+    struct QueuedFrame {
+        uint64_t sequence;
+        cv::Mat frame;
+        FullResolutionSource source;
+        std::vector<cv::Rect> regions;  // Motion crops to infer, empty for the full frame
+        std::chrono::steady_clock::time_point capture_time;
+        std::promise<FrameResult> promise;
+    };
+    
+    // Inference output waiting in the reorder buffer for the tracking thread
+    struct InferredFrame {
+        uint64_t sequence = 0;
+        cv::Mat frame;
+        cv::Size camera_size;  // Frame size in camera coordinates, for skipped frames that keep no frame
+        cv::Mat flow_image;    // Small grayscale frame for optical flow, on skipped frames between inferences
+        FullResolutionSource source;
+        std::chrono::steady_clock::time_point capture_time;
+        bool inference_ok = false;
+        bool inference_skipped = false;
+        std::vector<Detection> detections;
+        std::promise<FrameResult> promise;
+    };
+    
     // Threading infrastructure
     std::vector<std::thread> worker_threads_;
-    std::queue<std::pair<cv::Mat, std::promise<FrameResult>>> frame_queue_;
-    std::mutex queue_mutex_;
+    std::thread tracking_thread_;
+    std::queue<QueuedFrame> frame_queue_;
+    mutable std::mutex queue_mutex_;
     std::condition_variable queue_condition_;
     std::atomic<bool> shutdown_requested_;
     std::atomic<size_t> frames_in_progress_;
     std::atomic<bool> brightness_filter_active_;
+    uint64_t next_sequence_;  // Guarded by queue_mutex_
+    FrameSequencer<InferredFrame> sequencer_;
+    
+    // Hand a frame to the shared scheduler; its result re-enters through the sequencer
+    std::future<FrameResult> submitToScheduler(const cv::Mat& frame, const FullResolutionSource* source,
+                                               std::chrono::steady_clock::time_point capture_time);
+    
+    // Resolve a frame the motion gate or inference interval skipped, in capture order, from predicted tracks
+    // or, between inferences with a flow tracker, from tracks moved by optical flow
+    std::future<FrameResult> submitSkippedFrame(const cv::Mat& frame, const FullResolutionSource* source,
+                                                std::chrono::steady_clock::time_point capture_time,
+                                                bool between_inferences);
+    
+    // Detections for a skipped frame; flow_image is empty unless the flow tracker should move the tracks
+    void trackSkippedFrame(const cv::Mat& flow_image, std::chrono::steady_clock::time_point capture_time,
+                           const cv::Size& camera_size, std::vector<Detection>& detections);
+    
+    // Small grayscale copy of the frame for the flow tracker, blank outside the detection zones
+    cv::Mat flowInput(const cv::Mat& frame);
     
-    // Worker thread function
+    void recordInferenceTime(double milliseconds_per_frame);
+    
+    // Motion regions of the frame plus the tracked objects in it, or empty for full-frame inference
+    std::vector<cv::Rect> findMotionRegions(const cv::Mat& frame, const FullResolutionSource* source);
+    
+    // Inference worker thread function (stateless with respect to tracking)
     void workerThread();
     
-    // Process a single frame (thread-safe)
-    FrameResult processFrameInternal(const cv::Mat& frame);
+    // Run inference on frames drained together and hand each result to the sequencer
+    void inferFrames(std::vector<QueuedFrame>& frames);
+    
+    // Single consumer applying inferred frames in capture order
+    void trackingThread();
+    
+    // Process a single frame end to end (sequential mode)
+    FrameResult processFrameInternal(const cv::Mat& frame, const FullResolutionSource* source,
+                                     const std::vector<cv::Rect>& regions,
+                                     std::chrono::steady_clock::time_point capture_time);
+    
+    // Stage 1: brightness filter + inference (of the regions, if any), safe to run concurrently
+    bool runInference(const cv::Mat& frame, const std::vector<cv::Rect>& regions, std::vector<Detection>& detections);
+    
+    // Inference of a frame prepareFrame() already reduced to detection resolution, in original coordinates
+    std::vector<Detection> detectReduced(const cv::Mat& prepared, const cv::Size& frame_size);
+    
+    // Stage 1 for several frames with a single batched forward pass
+    bool runBatchInference(const std::vector<cv::Mat>& frames, std::vector<std::vector<Detection>>& detections);
+    
+    // Brightness filter and zone mask applied ahead of inference when enabled. A filtered or
+    // masked full frame is returned at detection resolution, with reduced set when that is
+    // smaller than the original. With regions, only the region crops are filtered and
+    // masked, stacked into an image of their own: regions is rewritten to their places in it
+    // and origins receives their frame positions (left empty when the frame is returned).
+    // Frames that may share a batched forward pass are only reduced by the brightness filter,
+    // since a batch runs at one input size derived from the camera frame.
+    cv::Mat prepareFrame(const cv::Mat& frame, std::vector<cv::Rect>& regions, std::vector<cv::Point>& origins,
+                         bool& reduced, bool batched = false);
+    
+    // Zone mask at the given analysis size, or an empty Mat when the whole frame is analyzed
+    cv::Mat zoneMask(const cv::Size& size);
+    
+    // Stage 2: tracking, stationary enrichment and photo decisions, must run in capture order
+    void applyTrackingStage(const cv::Mat& frame, const FullResolutionSource* source, FrameResult& result);
+    
+    // Scale detections on a 1/decode_scale frame back to camera coordinates
+    static void mapToFullResolution(std::vector<Detection>& detections, int decode_scale);
+    
+    // Scale detections on a frame reduced by prepareFrame() back to the submitted frame
+    static void mapFromDetectionResolution(std::vector<Detection>& detections, const cv::Size& detection_size,
+                                           const cv::Size& frame_size);
     
     // Helper methods for photo storage
-    void saveDetectionPhoto(const cv::Mat& frame, const std::vector<Detection>& detections, const std::shared_ptr<ObjectDetector>& detector);
-    cv::Scalar getColorForClass(const std::string& class_name) const;
+    void saveDetectionPhoto(const cv::Mat& frame, const FullResolutionSource* source,
+                            const std::vector<Detection>& detections, const std::shared_ptr<ObjectDetector>& detector);
     std::string generateFilename(const std::vector<Detection>& detections) const;
     
     // Brightness detection and filtering
     bool detectHighBrightness(const cv::Mat& frame);
-    cv::Mat applyBrightnessFilter(const cv::Mat& frame);
+    void applyBrightnessFilter(const cv::Mat& frame, cv::Mat& filtered);
 };
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "frame_source_interface.hpp"
+#include "logger.hpp"
+
+/**
+ * Frame source generating moving objects over a static background
+ * Objects move at constant velocity and bounce off the frame edges. The scene
+ * comes from a fixed seed, so every run produces identical frames; this makes
+ * benchmarks on machines without a camera reproducible.
+ */
+class SyntheticFrameSource : public IFrameSource {
+public:
+    SyntheticFrameSource(int width, int height, FramePacing pacing, double fps, int frame_limit,
+                         std::shared_ptr<Logger> logger);
+    ~SyntheticFrameSource() override = default;
+
+    bool initialize() override;
+    bool captureFrame(cv::Mat& frame) override;
+    bool isReady() const override { return initialized_ && !isExhausted(); }
+    bool isExhausted() const override;
+    std::string getSourceInfo() const override;
+    void release() override;
+
+    /**
+     * Frames generated since initialize()
+     */
+    uint64_t getFramesGenerated() const { return frames_generated_; }
+
+private:
+    struct MovingObject {
+        cv::Point2f position;  // Top-left corner
+        cv::Point2f velocity;  // Pixels per frame
+        cv::Size size;
+        cv::Scalar color;
+    };
+
+    int width_;
+    int height_;
+    FramePacing pacing_;
+    double fps_;
+    int frame_limit_;
+    std::shared_ptr<Logger> logger_;
+    FramePacer pacer_;
+    cv::Mat background_;
+    std::vector<MovingObject> objects_;
+    uint64_t frames_generated_;
+    bool initialized_;
+
+    static constexpr int OBJECT_COUNT = 4;
+    static constexpr unsigned int SCENE_SEED = 42;
+    static constexpr double DEFAULT_FPS = 30.0;
+
+    void advanceObjects();
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "logger.hpp"
+#include "object_detector.hpp"
+
+/**
+ * High-resolution detection by splitting the frame into overlapping tiles
+ *
+ * Each tile is sized so that it reaches the network at (close to) native
+ * resolution, so a person 30 pixels tall in a 4K frame is not scaled away.
+ * Alongside the tiles, the whole frame still runs once at the normal
+ * detection scale, so objects larger than a tile are seen in one piece.
+ *
+ * Tiles and the full-frame pass run one after another on the calling
+ * worker; frames in flight on other workers use the detector's other
+ * replicas. Boxes from different tiles are then combined by
+ * fuseDetections(): duplicates in the overlap bands are merged, as are the
+ * two halves of an object cut by a tile seam.
+ *
+ * To bound CPU use, only the tiles listed in every_frame_tiles run on every
+ * frame; the rest run every tile_interval frames, staggered so each frame
+ * runs a similar share. A tile that is not due this frame contributes the
+ * detections from its last run.
+ */
+class TiledInference {
+public:
+    struct Options {
+        int columns = 0;                    // Tile grid; 0 picks the fewest tiles no larger than tile_size
+        int rows = 0;
+        double overlap = 0.2;               // Fraction of a tile shared with its neighbour
+        int tile_interval = 1;              // Frames between runs of tiles not in every_frame_tiles
+        std::vector<int> every_frame_tiles; // Row-major tile indices inferred on every frame
+    };
+
+    struct Stats {
+        uint64_t frames = 0;
+        double avg_tiles_per_frame = 0.0;   // Tiles actually inferred, excluding reused results
+        uint64_t fused_boxes = 0;           // Boxes merged away by the fusion step
+        int tile_count = 0;
+    };
+
+    /**
+     * A detection together with the tile it came from, for seam fusion
+     */
+    struct TileDetection {
+        Detection detection;
+        cv::Rect tile;                      // Frame-sized for the full-frame pass
+    };
+
+    TiledInference(std::shared_ptr<ObjectDetector> detector,
+                   std::shared_ptr<Logger> logger,
+                   const Options& options,
+                   int tile_size = 640);
+
+    /**
+     * Detect objects in a frame using the tile schedule
+     * Thread-safe; concurrent calls share the cache of tile results.
+     * @return Fused detections in frame coordinates
+     */
+    std::vector<Detection> detect(const cv::Mat& frame);
+
+    Stats getStats() const;
+
+    void logStats() const;
+
+    /**
+     * Lay out an overlapping grid of tiles covering the frame
+     * @param columns,rows Grid size, or 0 for the fewest tiles no larger than tile_size
+     * @return Row-major tile rectangles
+     */
+    static std::vector<cv::Rect> computeTiles(const cv::Size& frame_size, int columns, int rows,
+                                              int tile_size, double overlap);
+
+    /**
+     * Whether a tile runs on the given frame under the schedule
+     */
+    static bool isTileDue(int tile_index, uint64_t frame_index, int tile_interval,
+                          const std::vector<int>& every_frame_tiles);
+
+    /**
+     * Merge detections of the same class that describe one object
+     * Only boxes from different sources (tiles or the full-frame pass) are
+     * merged; boxes one source kept apart after its own NMS stay apart. Such
+     * a pair is merged when the boxes overlap inside both sources' area and
+     * either overlap strongly (IoU) or one lies mostly inside the other (a
+     * partial view next to the full-frame box), or when both are cut by the
+     * same tile seam and line up across it. Merged boxes take the union of
+     * their extents and the highest confidence.
+     * @param frame_size Tile edges on the frame border are not seams
+     * @param fused_count Incremented by the number of boxes merged away
+     */
+    static std::vector<Detection> fuseDetections(std::vector<TileDetection> candidates, const cv::Size& frame_size,
+                                                 uint64_t* fused_count = nullptr);
+
+private:
+    std::shared_ptr<ObjectDetector> detector_;
+    std::shared_ptr<Logger> logger_;
+    Options options_;
+    int tile_size_;
+
+    mutable std::mutex cache_mutex_;
+    cv::Size layout_size_;                              // Frame size the tiles were laid out for
+    std::vector<cv::Rect> tiles_;
+    std::vector<std::vector<Detection>> last_results_;  // Per tile, frame coordinates
+    uint64_t next_frame_;
+
+    std::atomic<uint64_t> frames_;
+    std::atomic<uint64_t> tiles_inferred_;
+    std::atomic<uint64_t> fused_boxes_;
+
+    static constexpr float DUPLICATE_IOU = 0.5f;
+    static constexpr float CONTAINED_FRACTION = 0.6f;  // Intersection over the smaller box
+    static constexpr float SEAM_ALIGNMENT = 0.5f;      // Shared extent along the seam over the shorter box
+    static constexpr int SEAM_MARGIN = 2;              // Pixels from a tile edge that count as cut by it
+};
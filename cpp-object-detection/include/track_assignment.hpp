@@ -0,0 +1,102 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * One-to-one matching of detections to tracks
+ *
+ * Candidate pairs are found through a uniform grid, so each detection is
+ * only compared with the tracks in its neighbourhood rather than with every
+ * track. The candidates are then assigned by minimum total cost: pairs are
+ * split into groups that share no detection or track, and each group is
+ * solved exactly with the Hungarian algorithm. A crowd of separate objects
+ * becomes many tiny problems, and two people crossing become one 2x2
+ * problem. The answer no longer depends on which detection came first.
+ */
+class TrackAssignment {
+public:
+    /**
+     * Uniform grid of points for neighbourhood queries
+     * Entries are kept in one array sorted by cell, so a grid that is cleared
+     * and refilled every frame stops allocating once it has seen its largest frame.
+     */
+    class GridIndex {
+    public:
+        explicit GridIndex(float cell_size);
+
+        void insert(const cv::Point2f& point, int id);
+
+        /**
+         * Remove all points, keeping the memory for the next fill
+         */
+        void clear() { entries_.clear(); }
+
+        /**
+         * Ids stored in the 3x3 cells around the point, sorted and without duplicates
+         * This includes every id inserted within cell_size of the point.
+         */
+        void query(const cv::Point2f& point, std::vector<int>& ids) const;
+
+    private:
+        float cell_size_;
+        std::vector<std::pair<int64_t, int>> entries_;  // (cell key, id), sorted
+
+        int32_t cellOf(float coordinate) const;
+        static int64_t cellKey(int32_t column, int32_t row);
+    };
+
+    /**
+     * A permitted pairing of a row (detection) with a column (track)
+     */
+    struct Edge {
+        int row;
+        int column;
+        double cost;
+    };
+
+    /**
+     * Scratch memory for solve() and hungarian()
+     * Reused across calls, so matching stops allocating once it has seen its
+     * largest problem.
+     */
+    struct Workspace {
+        std::vector<int> parent;              // Union-find over rows, then columns
+        std::vector<int> group_offsets;       // Start of each group's edges in grouped_edges
+        std::vector<int> grouped_edges;       // Edge indices, grouped by connected component
+        std::vector<int> local_row;
+        std::vector<int> local_column;
+        std::vector<int> group_rows;
+        std::vector<int> group_columns;
+        std::vector<double> cost;
+        std::vector<int> matched;
+        std::vector<double> row_potential;
+        std::vector<double> column_potential;
+        std::vector<int> column_owner;
+        std::vector<int> previous_column;
+        std::vector<double> slack;
+        std::vector<char> visited;
+    };
+
+    /**
+     * Match rows to columns over the permitted pairs
+     * Assigns as many rows as possible, and among those assignments the one with
+     * the lowest total cost.
+     * @param assignment Set to the column assigned to each row, or -1 if the row has no partner
+     */
+    static void solve(int rows, int columns, const std::vector<Edge>& edges, Workspace& workspace,
+                      std::vector<int>& assignment);
+
+    /**
+     * Minimum-cost assignment for a dense cost matrix (Hungarian algorithm, O(rows^2 * columns))
+     * @param cost Row-major rows x columns costs, rows <= columns
+     * @param assignment Set to the column assigned to each row
+     */
+    static void hungarian(const std::vector<double>& cost, int rows, int columns, Workspace& workspace,
+                          std::vector<int>& assignment);
+
+private:
+    static constexpr double FORBIDDEN_COST = 1e9;  // Pairs without an edge; real costs stay far below
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "box_kalman_filter.hpp"
+
+/**
+ * Last positions of a track in a fixed ring stored inline
+ *
+ * Works like a bounded deque: push_back() on a full history drops the
+ * oldest position. Nothing is ever allocated.
+ */
+class PositionHistory {
+public:
+    static constexpr size_t CAPACITY = 10;
+
+    void push_back(const cv::Point2f& point) {
+        if (size_ == CAPACITY) {
+            pop_front();
+        }
+        points_[(start_ + size_) % CAPACITY] = point;
+        size_++;
+    }
+
+    void pop_front() {
+        if (size_ > 0) {
+            start_ = (start_ + 1) % CAPACITY;
+            size_--;
+        }
+    }
+
+    void clear() {
+        start_ = 0;
+        size_ = 0;
+    }
+
+    /**
+     * Position i counted from the oldest
+     */
+    const cv::Point2f& operator[](size_t i) const { return points_[(start_ + i) % CAPACITY]; }
+    const cv::Point2f& front() const { return (*this)[0]; }
+    const cv::Point2f& back() const { return (*this)[size_ - 1]; }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    std::array<cv::Point2f, CAPACITY> points_;
+    size_t start_ = 0;
+    size_t size_ = 0;
+};
+
+/**
+ * Tracker state of one camera as parallel columns indexed by slot
+ *
+ * Every column is sized for the full capacity up front. A new track takes a
+ * slot from the free list and an exiting track gives it back, so tracking in
+ * steady state allocates nothing, and a pass over one field (centers for
+ * matching, frame counts for exits) reads one contiguous array rather than
+ * whole tracker records.
+ *
+ * Tracks store ClassRegistry ids; their names are looked up for output only.
+ *
+ * Not thread-safe; owned by the thread that runs tracking.
+ */
+class TrackerTable {
+public:
+    enum Flag : uint8_t {
+        PRESENT = 1,     // Matched on the last inferred frame
+        NEW = 2,         // Created on the last inferred frame it was seen
+        STATIONARY = 4,
+    };
+
+    explicit TrackerTable(size_t capacity);
+
+    /**
+     * Take a free slot for a new track, with an empty history and no flags set
+     * @return Slot index, or -1 if the table is full
+     */
+    int acquire();
+
+    /**
+     * Return a slot to the free list
+     */
+    void release(int slot);
+
+    /**
+     * Release every slot the predicate returns true for; the others keep their order
+     * @return Number of slots released
+     */
+    template <typename Predicate>
+    size_t releaseIf(Predicate predicate) {
+        size_t kept = 0;
+        for (int slot : active_) {
+            if (predicate(slot)) {
+                free_.push_back(slot);
+            } else {
+                active_[kept++] = slot;
+            }
+        }
+        size_t released = active_.size() - kept;
+        active_.resize(kept);
+        return released;
+    }
+
+    /**
+     * Slots in use, oldest track first
+     */
+    const std::vector<int>& slots() const { return active_; }
+
+    size_t size() const { return active_.size(); }
+    size_t capacity() const { return ids.size(); }
+    bool empty() const { return active_.empty(); }
+    bool full() const { return free_.empty(); }
+
+    bool has(int slot, Flag flag) const { return (flags[slot] & flag) != 0; }
+    void set(int slot, Flag flag, bool value) {
+        flags[slot] = static_cast<uint8_t>(value ? (flags[slot] | flag) : (flags[slot] & ~flag));
+    }
+
+    // Columns, indexed by slot; only slots() hold live tracks
+    std::vector<uint64_t> ids;
+    std::vector<int> class_ids;                 // ClassRegistry ids
+    std::vector<cv::Point2f> centers;           // Center of the last matched detection
+    std::vector<cv::Point2f> previous_centers;
+    std::vector<cv::Rect> boxes;                // Detected or predicted, as in ObjectDetector::ObjectTracker
+    std::vector<float> confidences;
+    std::vector<BoxKalmanFilter> motions;
+    std::vector<std::chrono::steady_clock::time_point> last_detection_times;
+    std::vector<PositionHistory> histories;
+    std::vector<int> frames_since_detection;
+    std::vector<uint8_t> flags;
+    std::vector<std::chrono::steady_clock::time_point> stationary_since;
+
+private:
+    std::vector<int> active_;
+    std::vector<int> free_;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "logger.hpp"
+
+/**
+ * Native Video4Linux2 MJPEG capture using memory-mapped driver buffers
+ *
+ * cv::VideoCapture decodes every MJPEG frame to BGR inside read(), even when
+ * the frame is only going to be streamed, saved or dropped. This backend
+ * dequeues the compressed JPEG payload straight from the driver's mmap'd
+ * buffers and leaves decoding to the caller, so frames that never reach
+ * inference are never decoded.
+ *
+ * Only available on Linux; open() fails elsewhere and callers fall back to
+ * cv::VideoCapture.
+ */
+class V4l2Capture {
+public:
+    explicit V4l2Capture(std::shared_ptr<Logger> logger);
+    ~V4l2Capture();
+
+    V4l2Capture(const V4l2Capture&) = delete;
+    V4l2Capture& operator=(const V4l2Capture&) = delete;
+
+    /**
+     * Open /dev/video<device_index>, negotiate MJPEG at the requested size and
+     * start streaming. The driver may pick the nearest supported resolution.
+     */
+    bool open(int device_index, int width, int height, int fps);
+
+    /**
+     * Stop streaming, unmap the buffers and close the device
+     */
+    void close();
+
+    bool isOpen() const { return streaming_; }
+
+    /**
+     * Dequeue the next frame without copying it
+     * data points into the driver buffer and stays valid until the next
+     * grab() or close(); the buffer is handed back to the driver then.
+     * Blocks for at most GRAB_TIMEOUT_MS.
+     */
+    bool grab(const uint8_t*& data, size_t& size);
+
+    /**
+     * Dequeue the next frame and copy its JPEG payload into jpeg
+     * The driver buffer is requeued immediately. The vector's capacity is
+     * reused, so steady state capture does not allocate.
+     */
+    bool grab(std::vector<uint8_t>& jpeg);
+
+    /**
+     * Negotiated frame size and rate (valid after open())
+     */
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    double getFps() const { return fps_; }
+
+    /**
+     * Check whether this build can use V4L2 at all
+     */
+    static bool isSupported();
+
+private:
+    struct MappedBuffer {
+        void* start;
+        size_t length;
+    };
+
+    std::shared_ptr<Logger> logger_;
+    std::string device_path_;
+    int fd_;
+    bool streaming_;
+    int held_index_;  // Buffer dequeued by the last grab(), -1 if none
+    int width_;
+    int height_;
+    double fps_;
+    std::vector<MappedBuffer> buffers_;
+
+    static constexpr unsigned int BUFFER_COUNT = 4;  // Driver queue depth
+    static constexpr int GRAB_TIMEOUT_MS = 2000;
+
+    bool requeueHeld();
+};
@@ -87,7 +87,4 @@ private:
                       bool burst_mode_enabled = false,
                       double disk_usage_percent = -1.0,
                       double cpu_temp_celsius = -1.0);
-    
-    // Get color for different object classes
-    cv::Scalar getColorForClass(const std::string& class_name) const;
 };
@@ -3,48 +3,71 @@
 #include <opencv2/opencv.hpp>
 #include <memory>
 #include <vector>
+#include "frame_source_interface.hpp"
 #include "logger.hpp"
+#include "v4l2_capture.hpp"
 
 /**
  * Webcam interface for capturing frames from USB cameras
  */
-class WebcamInterface {
+class WebcamInterface : public IFrameSource {
 public:
     WebcamInterface(int camera_id, int width, int height, 
                    std::shared_ptr<Logger> logger);
-    ~WebcamInterface();
+    ~WebcamInterface() override;
+
+    /**
+     * Select the capture backend: "opencv" (cv::VideoCapture) or "v4l2"
+     * (native mmap MJPEG capture, Linux only). Call before initialize().
+     * If the V4L2 backend cannot be opened, initialize() falls back to OpenCV.
+     */
+    void setCaptureBackend(const std::string& backend);
 
     /**
      * Initialize the camera connection
      */
-    bool initialize();
+    bool initialize() override;
     
     /**
      * Capture a frame from the camera
      * Returns true if frame was captured successfully
      */
-    bool captureFrame(cv::Mat& frame);
+    bool captureFrame(cv::Mat& frame) override;
+
+    /**
+     * Capture the camera's compressed JPEG without decoding it
+     * Only available when providesEncodedFrames() is true.
+     * Returns true if a frame was captured successfully
+     */
+    bool captureEncodedFrame(std::vector<uchar>& jpeg) override;
+
+    /**
+     * Check whether the active backend delivers the camera's MJPEG payload
+     */
+    bool providesEncodedFrames() const override;
     
     /**
      * Check if camera is initialized and ready
      */
-    bool isReady() const;
+    bool isReady() const override;
     
     /**
      * Get camera information
      */
     std::string getCameraInfo() const;
     
+    std::string getSourceInfo() const override { return getCameraInfo(); }
+    
     /**
      * Release camera resources
      */
-    void release();
+    void release() override;
     
     /**
      * Perform camera health check and attempt recovery if needed
      * Returns true if camera is healthy or was successfully recovered
      */
-    bool healthCheck();
+    bool healthCheck() override;
     
     /**
      * Attempt to reconnect to the camera
@@ -70,7 +93,10 @@ private:
     int height_;
     std::shared_ptr<Logger> logger_;
     std::unique_ptr<cv::VideoCapture> capture_;
+    std::unique_ptr<V4l2Capture> v4l2_capture_;
+    bool prefer_v4l2_;
     bool initialized_;
+    std::vector<uchar> encoded_buffer_;  // Reused by captureFrame() on the V4L2 backend
     
     // Keep-alive tracking to prevent USB camera standby
     std::chrono::steady_clock::time_point last_keepalive_time_;
@@ -80,6 +106,8 @@ private:
     int consecutive_failures_;
     static constexpr int MAX_CONSECUTIVE_FAILURES = 5;
     
+    bool usingV4l2() const;
+    bool readFrame(cv::Mat& frame);
     bool testCameraCapabilities();
     void setCameraProperties();
 };
\ No newline at end of file
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+#include "detection_model_interface.hpp"
+#include "nms_engine.hpp"
+
+/**
+ * Shared pre/post-processing helpers for YOLO-family models
+ */
+namespace YoloUtils {
+    constexpr int STRIDE = 32;            // Largest YOLOv5 feature stride; input sides must be a multiple of it
+    constexpr int MIN_INPUT_SIZE = 160;   // Smallest input side worth running the network at
+    constexpr int LETTERBOX_PAD_VALUE = 114;  // Grey padding used by the YOLOv5 training pipeline
+
+    /**
+     * Mapping between a source frame and the square letterboxed network input
+     */
+    struct Letterbox {
+        cv::Size input_size;  // Network input size (square, stride-aligned)
+        cv::Size resized;     // Size of the frame content inside the letterbox
+        float scale = 1.0f;   // Source pixels -> network pixels
+        int pad_x = 0;        // Left padding in network pixels
+        int pad_y = 0;        // Top padding in network pixels
+    };
+
+    /**
+     * Decoded box that passed the confidence threshold (network coordinates)
+     */
+    struct Candidate {
+        float center_x;
+        float center_y;
+        float width;
+        float height;
+        float confidence;  // objectness * class score
+        int class_id;
+    };
+
+    /**
+     * Non-empty frames of a detectBatch() call, letterboxed to one input size
+     * Empty frames take no slot in the batch and get no detections. Kept by
+     * the model and reused, so batching allocates nothing in steady state.
+     */
+    struct Batch {
+        std::vector<cv::Mat> frames;         // Views of the non-empty frames
+        std::vector<size_t> indices;         // Position of frames[b] in the caller's list
+        std::vector<Letterbox> letterboxes;
+        int input_size = 0;
+
+        size_t size() const { return frames.size(); }
+        bool empty() const { return frames.empty(); }
+    };
+
+    /**
+     * Derive the network input side from the frame size and detection scale factor
+     * The longer frame side is scaled, rounded to the nearest multiple of the stride
+     * and clamped to [MIN_INPUT_SIZE, nominal_size], so e.g. a 1280x720 frame at
+     * scale 0.25/0.33/0.375/0.5 runs at 320/416/480/640.
+     *
+     * @param frame_size Source frame size
+     * @param scale_factor Detection scale factor (0.0-1.0)
+     * @param nominal_size Input side the model was exported for (upper bound)
+     */
+    int computeInputSize(const cv::Size& frame_size, double scale_factor, int nominal_size);
+
+    /**
+     * Compute the aspect-preserving letterbox geometry for a frame
+     */
+    Letterbox computeLetterbox(const cv::Size& frame_size, int input_size);
+
+    /**
+     * Letterbox a BGR frame straight into a 1x3xHxW float RGB input tensor
+     * The frame is resized once into resize_buffer, then a single fused pass
+     * (SIMD where OpenCV universal intrinsics are available) swaps BGR->RGB,
+     * scales by pixel_scale, de-interleaves into planes and fills the padding.
+     * Equivalent to cv::dnn::blobFromImage(letterboxed, pixel_scale, Size(), Scalar(), true).
+     *
+     * @param frame Source frame (CV_8UC3, BGR)
+     * @param letterbox Geometry from computeLetterbox()
+     * @param pixel_scale Multiplier applied to every pixel value (e.g. 1/255)
+     * @param resize_buffer Reused between calls; holds the resized frame content
+     * @param blob Reused between calls; reallocated only when the input size changes
+     */
+    void letterboxToBlob(const cv::Mat& frame, const Letterbox& letterbox, float pixel_scale,
+                         cv::Mat& resize_buffer, cv::Mat& blob);
+
+    /**
+     * Letterbox several frames into one Nx3xHxW input tensor for a batched forward pass
+     * Every letterbox must share the same input size; frames may differ in size.
+     * Image i occupies the i-th 3xHxW slice, laid out exactly as letterboxToBlob().
+     *
+     * @param frames Source frames (CV_8UC3, BGR)
+     * @param letterboxes Geometry from computeLetterbox(), one per frame
+     * @param pixel_scale Multiplier applied to every pixel value (e.g. 1/255)
+     * @param resize_buffer Reused between frames and calls
+     * @param blob Reused between calls; reallocated only when the batch shape changes
+     */
+    void letterboxToBatchBlob(const std::vector<cv::Mat>& frames, const std::vector<Letterbox>& letterboxes,
+                              float pixel_scale, cv::Mat& resize_buffer, cv::Mat& blob);
+
+    /**
+     * Prepare one batched forward pass
+     * Collects the non-empty frames, picks one input size for all of them
+     * (frames from one camera share it anyway) and letterboxes them into an
+     * Nx3xHxW blob. The model then only runs its forward pass.
+     *
+     * @param frames Frames passed to detectBatch()
+     * @param fixed_input_size Input side of a static-shape export, or 0 to use
+     *        computeInputSize() on the first frame
+     * @param scale_factor Detection scale factor for computeInputSize()
+     * @param nominal_size Input side the model was exported for
+     * @param pixel_scale Multiplier applied to every pixel value (e.g. 1/255)
+     * @param batch Refilled; capacity is kept between calls
+     * @return false if every frame was empty (nothing to run)
+     */
+    bool prepareBatch(const std::vector<cv::Mat>& frames, int fixed_input_size, double scale_factor,
+                      int nominal_size, float pixel_scale, Batch& batch,
+                      cv::Mat& resize_buffer, cv::Mat& blob);
+
+    /**
+     * Check that a cv::dnn batched output holds one slice per image
+     * Exports with a fixed batch axis of 1 return a single image instead.
+     * Half-precision outputs are converted to float once for the whole batch.
+     */
+    bool acceptBatchOutput(std::vector<cv::Mat>& outputs, size_t batch_size);
+
+    /**
+     * Hand each image's detections back in the caller's frame order
+     * @param decode Called with the batch slot b; returns that image's detections
+     */
+    template <typename Decode>
+    void scatterBatch(const Batch& batch, std::vector<std::vector<Detection>>& results, Decode decode) {
+        for (size_t b = 0; b < batch.size(); ++b) {
+            results[batch.indices[b]] = decode(b);
+        }
+    }
+
+    /**
+     * Convert one interleaved BGR row into three float RGB planes
+     * Exposed for benchmarking and tests.
+     */
+    void convertBgrRowToPlanes(const uchar* bgr, float* red, float* green, float* blue,
+                               int width, float pixel_scale);
+
+    /**
+     * Decode a YOLOv5 output tensor ([rows, 5 + classes] floats per image)
+     * Objectness of 16 rows at a time is gathered into a column and compared
+     * with vector instructions, so background rows are skipped without
+     * touching their class scores. Surviving rows are scored only over
+     * class_ids (all classes when empty, with a vector max).
+     *
+     * @param data Start of the output rows
+     * @param rows Number of rows (anchors)
+     * @param row_size Floats per row (5 + number of classes)
+     * @param class_ids Classes to score, or empty for all
+     * @param confidence_threshold Minimum objectness and final confidence
+     * @param candidates Cleared and refilled; capacity is kept between frames
+     */
+    void decodeYoloV5(const float* data, int rows, int row_size,
+                      const std::vector<int>& class_ids, float confidence_threshold,
+                      std::vector<Candidate>& candidates);
+
+    /**
+     * Decode a YOLOv8 output tensor ([4 + classes, anchors], channel-major)
+     * YOLOv8 is anchor-free with no objectness and stores each channel as a
+     * contiguous row over all anchors. Rather than transposing, the best score
+     * per anchor is accumulated one class row at a time with SIMD max over
+     * contiguous memory; only anchors that pass the threshold are then
+     * revisited to find their class and box. Classes tied for the best score
+     * resolve to the lowest class id.
+     *
+     * @param data Start of the output tensor
+     * @param channels Number of channels (4 + number of classes)
+     * @param anchors Number of anchors (e.g. 8400 at 640x640)
+     * @param class_ids Classes to score, or empty for all
+     * @param confidence_threshold Minimum class score
+     * @param best_scores Scratch buffer, resized to anchors and reused
+     * @param candidates Cleared and refilled; capacity is kept between frames
+     */
+    void decodeYoloV8(const float* data, int channels, int anchors,
+                      const std::vector<int>& class_ids, float confidence_threshold,
+                      std::vector<float>& best_scores, std::vector<Candidate>& candidates);
+
+    /**
+     * The 80 COCO class names in model output order
+     * Used when no classes file is available.
+     */
+    std::vector<std::string> cocoClassNames();
+
+    /**
+     * Map class names to their indices in a model's class list
+     * Names the model does not know are skipped. Models resolve their target
+     * classes once at load, so decoding only ever scores those.
+     */
+    std::vector<int> resolveClassIds(const std::vector<std::string>& target_names,
+                                     const std::vector<std::string>& class_names);
+
+    /**
+     * Map a center-format box in network coordinates back to the source frame
+     * The result is clipped to the frame bounds.
+     */
+    cv::Rect unprojectBox(float center_x, float center_y, float width, float height,
+                          const Letterbox& letterbox, const cv::Size& frame_size);
+
+    /**
+     * Turn decoded candidates into detections in source frame coordinates
+     * Boxes are unprojected through the letterbox, then suppressed per class
+     * (overlapping boxes of different classes, e.g. a person on a bicycle,
+     * are both kept).
+     *
+     * @param candidates Output of decodeYoloV5() / decodeYoloV8()
+     * @param registry_ids ClassRegistry id of each model class; candidates outside it are dropped
+     * @param nms Scratch engine, reused across frames
+     * @param detections Cleared and refilled
+     */
+    void suppressCandidates(const std::vector<Candidate>& candidates, const Letterbox& letterbox,
+                            const cv::Size& frame_size, float iou_threshold,
+                            const std::vector<int>& registry_ids, NmsEngine& nms,
+                            std::vector<Detection>& detections);
+}
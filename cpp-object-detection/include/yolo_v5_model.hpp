@@ -2,6 +2,8 @@
 
 #include "detection_model_interface.hpp"
 #include "logger.hpp"
+#include "yolo_utils.hpp"
+#include "nms_engine.hpp"
 #include <opencv2/dnn.hpp>
 #include <chrono>
 
@@ -22,6 +24,10 @@ public:
     
     std::vector<Detection> detect(const cv::Mat& frame) override;
     
+    std::vector<Detection> detectRegion(const cv::Mat& crop) override;
+    
+    std::vector<std::vector<Detection>> detectBatch(const std::vector<cv::Mat>& frames) override;
+    
     ModelMetrics getMetrics() const override;
     
     std::vector<std::string> getSupportedClasses() const override;
@@ -30,8 +36,12 @@ public:
     
     std::string getModelName() const override;
     
+    int getInputSize() const override;
+    
     void warmUp() override;
     
+    void setTargetClasses(const std::vector<std::string>& class_names) override;
+    
     /**
      * Set GPU acceleration preference
      * @param enable_gpu Whether to enable GPU/CUDA acceleration
@@ -42,23 +52,38 @@ private:
     std::shared_ptr<Logger> logger_;
     cv::dnn::Net net_;
     std::vector<std::string> class_names_;
+    std::vector<int> registry_ids_;  // ClassRegistry id of each model class
     double confidence_threshold_;
     double detection_scale_factor_;
     bool initialized_;
     bool enable_gpu_;
+    bool dynamic_input_size_;  // Cleared if the network rejects non-nominal input sizes
+    bool batch_supported_;     // Cleared if the network rejects a batch axis larger than 1
+    cv::Mat resize_buffer_;    // Reused preprocessing buffers (one model instance per worker)
+    cv::Mat input_blob_;
+    YoloUtils::Batch batch_;   // Reused by detectBatch()
+    std::vector<YoloUtils::Candidate> candidates_;
+    NmsEngine nms_;
+    std::vector<std::string> target_class_names_;
+    std::vector<int> target_class_ids_;  // Empty = score all classes
     mutable std::chrono::steady_clock::time_point last_inference_start_;
     mutable int avg_inference_time_ms_;
     
-    // YOLOv5s specific parameters
+    // YOLOv5s specific parameters (nominal input; smaller inputs are used for --detection-scale < 1)
     static constexpr int INPUT_WIDTH = 640;
     static constexpr int INPUT_HEIGHT = 640;
     static constexpr float SCALE_FACTOR = 1.0 / 255.0;
-    static const cv::Scalar MEAN;
+    static constexpr float NMS_IOU_THRESHOLD = 0.45f;  // Standard YOLO overlap threshold
     
     bool loadClassNames(const std::string& classes_path);
     bool loadModel(const std::string& model_path);
-    std::vector<Detection> postProcess(const cv::Mat& frame, 
-                                     const std::vector<cv::Mat>& outputs);
+    std::vector<Detection> detectScaled(const cv::Mat& frame, double scale_factor);
+    std::vector<Detection> runNetwork(const cv::Mat& frame, int input_size);
+    bool runBatch(const std::vector<cv::Mat>& frames, std::vector<std::vector<Detection>>& results);
+    std::vector<Detection> postProcess(const cv::Mat& frame,
+                                     const YoloUtils::Letterbox& letterbox,
+                                     const std::vector<cv::Mat>& outputs,
+                                     int batch_index = 0);
     void updateInferenceTime(int inference_time_ms) const;
 };
 
@@ -79,6 +104,10 @@ public:
     
     std::vector<Detection> detect(const cv::Mat& frame) override;
     
+    std::vector<Detection> detectRegion(const cv::Mat& crop) override;
+    
+    std::vector<std::vector<Detection>> detectBatch(const std::vector<cv::Mat>& frames) override;
+    
     ModelMetrics getMetrics() const override;
     
     std::vector<std::string> getSupportedClasses() const override;
@@ -87,8 +116,12 @@ public:
     
     std::string getModelName() const override;
     
+    int getInputSize() const override;
+    
     void warmUp() override;
     
+    void setTargetClasses(const std::vector<std::string>& class_names) override;
+    
     /**
      * Set GPU acceleration preference
      * @param enable_gpu Whether to enable GPU/CUDA acceleration
@@ -99,22 +132,37 @@ private:
     std::shared_ptr<Logger> logger_;
     cv::dnn::Net net_;
     std::vector<std::string> class_names_;
+    std::vector<int> registry_ids_;  // ClassRegistry id of each model class
     double confidence_threshold_;
     double detection_scale_factor_;
     bool initialized_;
     bool enable_gpu_;
+    bool dynamic_input_size_;  // Cleared if the network rejects non-nominal input sizes
+    bool batch_supported_;     // Cleared if the network rejects a batch axis larger than 1
+    cv::Mat resize_buffer_;    // Reused preprocessing buffers (one model instance per worker)
+    cv::Mat input_blob_;
+    YoloUtils::Batch batch_;   // Reused by detectBatch()
+    std::vector<YoloUtils::Candidate> candidates_;
+    NmsEngine nms_;
+    std::vector<std::string> target_class_names_;
+    std::vector<int> target_class_ids_;  // Empty = score all classes
     mutable std::chrono::steady_clock::time_point last_inference_start_;
     mutable int avg_inference_time_ms_;
     
-    // YOLOv5l specific parameters (larger input size for better accuracy)
+    // YOLOv5l specific parameters (larger nominal input size for better accuracy)
     static constexpr int INPUT_WIDTH = 832;   // Larger input for better accuracy
     static constexpr int INPUT_HEIGHT = 832;
     static constexpr float SCALE_FACTOR = 1.0 / 255.0;
-    static const cv::Scalar MEAN;
+    static constexpr float NMS_IOU_THRESHOLD = 0.45f;  // Standard YOLO overlap threshold
     
     bool loadClassNames(const std::string& classes_path);
     bool loadModel(const std::string& model_path);
-    std::vector<Detection> postProcess(const cv::Mat& frame, 
-                                     const std::vector<cv::Mat>& outputs);
+    std::vector<Detection> detectScaled(const cv::Mat& frame, double scale_factor);
+    std::vector<Detection> runNetwork(const cv::Mat& frame, int input_size);
+    bool runBatch(const std::vector<cv::Mat>& frames, std::vector<std::vector<Detection>>& results);
+    std::vector<Detection> postProcess(const cv::Mat& frame,
+                                     const YoloUtils::Letterbox& letterbox,
+                                     const std::vector<cv::Mat>& outputs,
+                                     int batch_index = 0);
     void updateInferenceTime(int inference_time_ms) const;
 };
\ No newline at end of file
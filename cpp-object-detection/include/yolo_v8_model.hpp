@@ -0,0 +1,100 @@
+#pragma once
+
+#include "detection_model_interface.hpp"
+#include "logger.hpp"
+#include "yolo_utils.hpp"
+#include "nms_engine.hpp"
+#include <opencv2/dnn.hpp>
+#include <chrono>
+
+/**
+ * YOLOv8 model implementation (anchor-free, no objectness score)
+ *
+ * Handles the [1, 4 + classes, anchors] output layout of Ultralytics ONNX
+ * exports. Nano is the fastest model available and the one to run on a
+ * Raspberry Pi; Medium trades speed for the best accuracy.
+ *
+ * Export with: yolo export model=yolov8n.pt format=onnx dynamic=True
+ */
+class YoloV8Model : public IDetectionModel {
+public:
+    enum class Variant {
+        NANO,    // yolov8n - ~6MB, fastest
+        MEDIUM   // yolov8m - ~52MB, most accurate
+    };
+
+    YoloV8Model(std::shared_ptr<Logger> logger, Variant variant);
+    ~YoloV8Model() override = default;
+
+    bool initialize(const std::string& model_path,
+                   const std::string& config_path,
+                   const std::string& classes_path,
+                   double confidence_threshold,
+                   double detection_scale_factor = 1.0) override;
+
+    std::vector<Detection> detect(const cv::Mat& frame) override;
+    
+    std::vector<Detection> detectRegion(const cv::Mat& crop) override;
+
+    std::vector<std::vector<Detection>> detectBatch(const std::vector<cv::Mat>& frames) override;
+
+    ModelMetrics getMetrics() const override;
+
+    std::vector<std::string> getSupportedClasses() const override;
+
+    bool isInitialized() const override;
+
+    std::string getModelName() const override;
+
+    int getInputSize() const override;
+
+    void warmUp() override;
+
+    void setTargetClasses(const std::vector<std::string>& class_names) override;
+
+    /**
+     * Set GPU acceleration preference
+     * @param enable_gpu Whether to enable GPU/CUDA acceleration
+     */
+    void setEnableGpu(bool enable_gpu);
+
+private:
+    std::shared_ptr<Logger> logger_;
+    Variant variant_;
+    std::string short_name_;   // "YOLOv8n" / "YOLOv8m" for log messages
+    cv::dnn::Net net_;
+    std::vector<std::string> class_names_;
+    std::vector<int> registry_ids_;  // ClassRegistry id of each model class
+    double confidence_threshold_;
+    double detection_scale_factor_;
+    bool initialized_;
+    bool enable_gpu_;
+    bool dynamic_input_size_;  // Cleared if the network rejects non-nominal input sizes
+    bool batch_supported_;     // Cleared if the network rejects a batch axis larger than 1
+    cv::Mat resize_buffer_;    // Reused preprocessing buffers (one model instance per worker)
+    cv::Mat input_blob_;
+    YoloUtils::Batch batch_;   // Reused by detectBatch()
+    std::vector<float> best_scores_;
+    std::vector<YoloUtils::Candidate> candidates_;
+    NmsEngine nms_;
+    std::vector<std::string> target_class_names_;
+    std::vector<int> target_class_ids_;  // Empty = score all classes
+    mutable int avg_inference_time_ms_;
+
+    // YOLOv8 parameters (both variants are exported at 640x640)
+    static constexpr int INPUT_WIDTH = 640;
+    static constexpr int INPUT_HEIGHT = 640;
+    static constexpr float SCALE_FACTOR = 1.0 / 255.0;
+    static constexpr float NMS_IOU_THRESHOLD = 0.45f;
+
+    bool loadClassNames(const std::string& classes_path);
+    bool loadModel(const std::string& model_path);
+    std::vector<Detection> detectScaled(const cv::Mat& frame, double scale_factor);
+    std::vector<Detection> runNetwork(const cv::Mat& frame, int input_size);
+    bool runBatch(const std::vector<cv::Mat>& frames, std::vector<std::vector<Detection>>& results);
+    std::vector<Detection> postProcess(const cv::Mat& frame,
+                                     const YoloUtils::Letterbox& letterbox,
+                                     const std::vector<cv::Mat>& outputs,
+                                     int batch_index = 0);
+    void updateInferenceTime(int inference_time_ms) const;
+};
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""Quantize a YOLO ONNX model for CPU inference.
+
+INT8 uses ONNX Runtime static quantization in QDQ format, calibrated on the
+tensors written by `quantization_tool calibrate` (our own captured frames,
+preprocessed exactly like the detector does). FP16 converts the weights and
+keeps float32 inputs/outputs.
+
+Requires: pip install onnx onnxruntime numpy (and onnxconverter-common for --fp16)
+"""
+
+import argparse
+import glob
+import os
+import sys
+
+import numpy as np
+
+
+class TensorDirReader:
+    """CalibrationDataReader over calib_*.bin files (1x3xSxS float32)."""
+
+    def __init__(self, calibration_dir, input_name):
+        self.files = sorted(glob.glob(os.path.join(calibration_dir, "calib_*.bin")))
+        self.input_name = input_name
+        self.index = 0
+
+    def get_next(self):
+        if self.index >= len(self.files):
+            return None
+        data = np.fromfile(self.files[self.index], dtype=np.float32)
+        self.index += 1
+        size = int(round((data.size / 3) ** 0.5))
+        return {self.input_name: data.reshape(1, 3, size, size)}
+
+    def rewind(self):
+        self.index = 0
+
+
+def quantize_int8(args):
+    import onnx
+    from onnxruntime.quantization import (CalibrationMethod, QuantFormat, QuantType,
+                                          quantize_static)
+    from onnxruntime.quantization.shape_inference import quant_pre_process
+
+    model = onnx.load(args.model)
+    input_name = model.graph.input[0].name
+    reader = TensorDirReader(args.calibration, input_name)
+    if not reader.files:
+        sys.exit("No calib_*.bin tensors in " + args.calibration)
+
+    # Shape inference + graph cleanup recommended before static quantization
+    prepared = args.output + ".prep.onnx"
+    quant_pre_process(args.model, prepared)
+
+    # Optionally keep nodes in float, e.g. the final detection-head convolutions
+    # if the comparison shows they cost too much accuracy
+    exclude = args.exclude_nodes.split(",") if args.exclude_nodes else []
+
+    quantize_static(
+        prepared,
+        args.output,
+        reader,
+        quant_format=QuantFormat.QDQ,
+        activation_type=QuantType.QUInt8,
+        weight_type=QuantType.QInt8,
+        per_channel=args.per_channel,
+        calibrate_method=CalibrationMethod.MinMax if args.method == "minmax" else CalibrationMethod.Entropy,
+        nodes_to_exclude=exclude,
+    )
+    os.remove(prepared)
+    print("INT8 (QDQ) model written to " + args.output + " using " + str(len(reader.files)) + " calibration frames")
+
+
+def convert_fp16(args):
+    import onnx
+    from onnxconverter_common import float16
+
+    model = onnx.load(args.model)
+    model_fp16 = float16.convert_float_to_float16(model, keep_io_types=True)
+    onnx.save(model_fp16, args.output)
+    print("FP16 model written to " + args.output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--model", required=True, help="FP32 ONNX model")
+    parser.add_argument("--output", required=True, help="Quantized model to write")
+    parser.add_argument("--calibration", help="Directory of calib_*.bin tensors (INT8 only)")
+    parser.add_argument("--fp16", action="store_true", help="Convert to FP16 instead of INT8")
+    parser.add_argument("--per-channel", action="store_true", help="Per-channel weight scales (more accurate)")
+    parser.add_argument("--method", choices=["minmax", "entropy"], default="minmax", help="Calibration method")
+    parser.add_argument("--exclude-nodes", default="", help="Comma-separated node names to keep in float")
+    args = parser.parse_args()
+
+    if args.fp16:
+        convert_fp16(args)
+    else:
+        if not args.calibration:
+            parser.error("--calibration is required for INT8 quantization")
+        quantize_int8(args)
+
+
+if __name__ == "__main__":
+    main()
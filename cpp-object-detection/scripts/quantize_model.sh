@@ -0,0 +1,56 @@
+#!/bin/bash
+# Quantize a YOLO model on our own captured frames and report the accuracy trade-off
+#
+# Usage: scripts/quantize_model.sh FP32_MODEL FRAMES_DIR [OUTPUT_MODEL] [MODEL_TYPE] [BACKEND]
+# Example: scripts/quantize_model.sh models/yolov5s.onnx captures/ models/yolov5s-int8.onnx yolov5s
+#
+# Set QUANTIZE_ARGS to pass extra options to quantize_model.py (e.g. "--per-channel" or "--fp16").
+# Requires the quantization_tool target (cmake -DBUILD_TOOLS=ON) and
+# pip install onnx onnxruntime numpy
+
+set -e
+
+# Colors for output
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+RED='\033[0;31m'
+NC='\033[0m' # No Color
+
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 FP32_MODEL FRAMES_DIR [OUTPUT_MODEL] [MODEL_TYPE] [BACKEND]"
+    exit 1
+fi
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" &> /dev/null && pwd )"
+PROJECT_ROOT="$(dirname "$SCRIPT_DIR")"
+TOOL="${QUANTIZATION_TOOL:-$PROJECT_ROOT/build/tools/quantization_tool}"
+
+FP32_MODEL="$1"
+FRAMES_DIR="$2"
+OUTPUT_MODEL="${3:-${FP32_MODEL%.onnx}-int8.onnx}"
+MODEL_TYPE="${4:-yolov5s}"
+BACKEND="${5:-opencv}"
+
+if [ ! -x "$TOOL" ]; then
+    echo -e "${RED}quantization_tool not found at $TOOL${NC}"
+    echo "Build it with: cmake .. -DBUILD_TOOLS=ON && make quantization_tool"
+    echo "or set QUANTIZATION_TOOL to its path"
+    exit 1
+fi
+
+CALIBRATION_DIR="$(mktemp -d)"
+trap 'rm -rf "$CALIBRATION_DIR"' EXIT
+
+echo -e "${GREEN}[1/3] Preparing calibration tensors from $FRAMES_DIR${NC}"
+# Calibrate at the model type's own input size (832 for yolov5l, 640 for the others)
+"$TOOL" calibrate "$FRAMES_DIR" "$CALIBRATION_DIR" "$MODEL_TYPE" 200
+
+echo -e "${GREEN}[2/3] Quantizing $FP32_MODEL${NC}"
+# shellcheck disable=SC2086
+python3 "$SCRIPT_DIR/quantize_model.py" --model "$FP32_MODEL" --output "$OUTPUT_MODEL" \
+    --calibration "$CALIBRATION_DIR" $QUANTIZE_ARGS
+
+echo -e "${GREEN}[3/3] Comparing detections against the FP32 model${NC}"
+"$TOOL" compare "$FP32_MODEL" "$OUTPUT_MODEL" "$FRAMES_DIR" "$MODEL_TYPE" "$BACKEND"
+
+echo -e "${YELLOW}Use it with: ./object_detection --model-type $MODEL_TYPE --model-path $OUTPUT_MODEL${NC}"
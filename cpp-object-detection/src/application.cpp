@@ -2,6 +2,8 @@
 #include <iostream>
 #include <csignal>
 #include <thread>
+#include <algorithm>
+#include <sys/stat.h>
 
 // External reference to global running flag
 extern std::atomic<bool> running;
@@ -49,6 +51,77 @@ bool parseAndValidateConfig(ApplicationContext& ctx, int argc, char* argv[]) {
     return true;
 }
 
+// Photo directory of one camera when several cameras share the process
+static std::string cameraOutputDir(const std::string& output_dir, int camera_id) {
+    return output_dir + "/camera" + std::to_string(camera_id);
+}
+
+// Open every camera after the first with its own capture thread, tracker and
+// frame processor, all feeding the shared inference scheduler
+static bool initializeAdditionalCameras(ApplicationContext& ctx, const FrameSourceFactory::SourceOptions& primary_options,
+                                        int processing_threads) {
+    for (size_t i = 1; i < ctx.config.camera_ids.size(); ++i) {
+        CameraPipeline camera;
+        camera.camera_id = ctx.config.camera_ids[i];
+        camera.name = "camera" + std::to_string(camera.camera_id);
+
+        FrameSourceFactory::SourceOptions options = primary_options;
+        options.camera_id = camera.camera_id;
+        camera.source = FrameSourceFactory::createSource(options, ctx.logger);
+        if (!camera.source->initialize()) {
+            ctx.logger->error("Failed to initialize " + camera.name);
+            return false;
+        }
+        ctx.logger->info(camera.name + " initialized: " + camera.source->getSourceInfo());
+
+        // Frames must match the model scale chosen for the primary camera's decode
+        int decode_scale = camera.source->providesEncodedFrames() ? ctx.decode_scale : 1;
+        if (decode_scale != ctx.decode_scale) {
+            ctx.logger->warning(camera.name + " does not deliver JPEG frames - reduced decode unavailable for it");
+        }
+
+        // Several cameras are never read inline: the loop must not block on any one of them
+        camera.capture_thread = std::make_shared<FrameCaptureThread>(camera.source, ctx.logger);
+        camera.capture_thread->setDecodeScale(decode_scale);
+        if (!camera.capture_thread->start()) {
+            ctx.logger->error("Failed to start capture thread for " + camera.name);
+            return false;
+        }
+
+        camera.tracker = std::make_shared<ObjectDetector>(ctx.detector, ctx.logger);
+        camera.tracker->initialize();
+        if (ctx.google_sheets_client) {
+            camera.tracker->setGoogleSheetsClient(ctx.google_sheets_client);
+        }
+
+        camera.frame_processor = std::make_shared<ParallelFrameProcessor>(
+            camera.tracker, ctx.logger, ctx.perf_monitor, processing_threads, ctx.config.max_frame_queue_size,
+            cameraOutputDir(ctx.config.output_dir, camera.camera_id), ctx.config.enable_brightness_filter,
+            ctx.config.stationary_timeout_seconds);
+        camera.frame_processor->setInferenceScheduler(ctx.inference_scheduler,
+                                                      ctx.inference_scheduler->registerStream(camera.name));
+        camera.frame_processor->setInferenceInterval(ctx.config.inference_interval);
+        if (ctx.config.enable_optical_flow) {
+            camera.frame_processor->setFlowTracker(std::make_shared<FlowTracker>(ctx.logger));
+        }
+        if (ctx.config.enable_motion_gate) {
+            camera.frame_processor->setMotionGate(std::make_shared<MotionGate>(ctx.logger, ctx.config.motion_threshold));
+        }
+        if (ctx.config.enable_motion_roi) {
+            camera.frame_processor->setMotionRoiExtractor(
+                std::make_shared<MotionRoiExtractor>(ctx.logger, ctx.config.max_motion_rois));
+        }
+        if (!camera.frame_processor->initialize()) {
+            ctx.logger->error("Failed to initialize frame processor for " + camera.name);
+            return false;
+        }
+
+        camera.last_frame_time = std::chrono::steady_clock::now();
+        ctx.additional_cameras.push_back(std::move(camera));
+    }
+    return true;
+}
+
 bool initializeComponents(ApplicationContext& ctx) {
     // Initialize logger
     ctx.logger = std::make_shared<Logger>(ctx.config.log_file, ctx.config.verbose);
@@ -60,16 +133,64 @@ bool initializeComponents(ApplicationContext& ctx) {
     ctx.perf_monitor = std::make_shared<PerformanceMonitor>(
         ctx.logger, ctx.config.min_fps_warning_threshold);
 
-    // Initialize webcam interface
-    ctx.webcam = std::make_shared<WebcamInterface>(
-        ctx.config.camera_id, ctx.config.frame_width, ctx.config.frame_height, ctx.logger);
+    // Initialize frame source (webcam, or recorded/generated frames for testing and benchmarks)
+    FrameSourceFactory::SourceOptions source_options;
+    try {
+        source_options.type = FrameSourceFactory::parseSourceType(ctx.config.frame_source);
+        source_options.pacing = FrameSourceFactory::parsePacing(ctx.config.source_pacing);
+    } catch (const std::exception& e) {
+        ctx.logger->error(e.what());
+        return false;
+    }
+    source_options.camera_id = ctx.config.camera_id;
+    source_options.width = ctx.config.frame_width;
+    source_options.height = ctx.config.frame_height;
+    source_options.capture_backend = ctx.config.capture_backend;
+    source_options.path = ctx.config.source_path;
+    source_options.fps = ctx.config.source_fps;
+    source_options.loop = ctx.config.source_loop;
+    source_options.frame_limit = ctx.config.source_frame_limit;
+    ctx.frame_source = FrameSourceFactory::createSource(source_options, ctx.logger);
     
-    if (!ctx.webcam->initialize()) {
-        ctx.logger->error("Failed to initialize webcam interface");
+    if (!ctx.frame_source->initialize()) {
+        ctx.logger->error("Failed to initialize " + FrameSourceFactory::sourceTypeToString(source_options.type) +
+                          " frame source");
         return false;
     }
 
-    ctx.logger->info("Webcam initialized: " + ctx.webcam->getCameraInfo());
+    ctx.logger->info("Frame source initialized: " + ctx.frame_source->getSourceInfo());
+    if (ctx.config.stream_passthrough && !ctx.frame_source->providesEncodedFrames()) {
+        ctx.logger->warning("--stream-passthrough needs the V4L2 capture backend; streaming annotated frames instead");
+    }
+
+    // Unpaced recorded sources are benchmarks: every frame is read inline and
+    // processed without the live-camera frame rate and analysis rate limits
+    ctx.unthrottled = source_options.type != FrameSourceFactory::SourceType::WEBCAM &&
+                      source_options.pacing == FramePacing::AS_FAST_AS_POSSIBLE;
+    if (ctx.unthrottled) {
+        ctx.logger->info("Unpaced frame source: processing every frame as fast as possible");
+    }
+
+    // Decode the inference copy of each camera JPEG at the DCT scale nearest the detection resolution
+    if (ctx.config.reduced_decode) {
+        if (ctx.frame_source->providesEncodedFrames()) {
+            ctx.decode_scale = IFrameSource::selectDecodeScale(ctx.config.detection_scale_factor);
+            ctx.logger->info("Reduced JPEG decode: inference frames decoded at 1/" +
+                             std::to_string(ctx.decode_scale) + " scale");
+        } else {
+            ctx.logger->warning("--reduced-decode needs the V4L2 capture backend; decoding full frames");
+        }
+    }
+
+    // Drain the camera continuously so the processing loop never analyzes a stale driver buffer
+    if (ctx.config.enable_capture_thread && !ctx.unthrottled) {
+        ctx.capture_thread = std::make_shared<FrameCaptureThread>(ctx.frame_source, ctx.logger);
+        ctx.capture_thread->setDecodeScale(ctx.decode_scale);
+        if (!ctx.capture_thread->start()) {
+            ctx.logger->error("Failed to start capture thread");
+            return false;
+        }
+    }
 
     // Initialize object detector with model type selection
     DetectionModelFactory::ModelType model_type;
@@ -81,11 +202,48 @@ bool initializeComponents(ApplicationContext& ctx) {
         return false;
     }
 
+    // A reduced decode already shrank the frame, so the model scales the rest of the
+    // way and picks the same network input as it would from the full frame
+    double model_scale_factor = std::min(1.0, ctx.config.detection_scale_factor * ctx.decode_scale);
     ctx.detector = std::make_shared<ObjectDetector>(
         ctx.config.model_path, ctx.config.config_path, ctx.config.classes_path,
-        ctx.config.min_confidence, ctx.logger, model_type, ctx.config.detection_scale_factor,
+        ctx.config.min_confidence, ctx.logger, model_type, model_scale_factor,
         ctx.config.enable_gpu);
 
+    // Split the cores between concurrent model replicas and intra-op threads per forward pass.
+    // A single shared cv::dnn::Net serializes inference, so parallel workers each need their own replica.
+    int effective_threads = ctx.config.enable_parallel_processing ? ctx.config.processing_threads : 1;
+    int inference_replicas = ctx.config.inference_replicas > 0 ? ctx.config.inference_replicas : effective_threads;
+    inference_replicas = std::min(inference_replicas, effective_threads);
+    int inference_threads = ctx.config.inference_threads;
+    if (inference_threads == 0 && inference_replicas > 1) {
+        int hardware_threads = static_cast<int>(std::thread::hardware_concurrency());
+        inference_threads = std::max(1, hardware_threads / inference_replicas);
+    }
+    if (inference_threads > 0) {
+        cv::setNumThreads(inference_threads);
+    }
+    ctx.detector->setInferenceReplicas(inference_replicas);
+    ctx.logger->info("Inference concurrency: " + std::to_string(inference_replicas) + " model replica(s), " +
+                     (inference_threads > 0 ? std::to_string(inference_threads) : std::string("default")) +
+                     " intra-op thread(s) each");
+
+    // Select the inference backend; ONNX Runtime takes its thread counts per session
+    DetectionModelFactory::BackendOptions backend_options;
+    try {
+        backend_options.backend = DetectionModelFactory::parseBackend(ctx.config.inference_backend);
+    } catch (const std::exception& e) {
+        ctx.logger->error("Invalid inference backend: " + ctx.config.inference_backend);
+        ctx.logger->error("Available backends: opencv, onnxruntime");
+        return false;
+    }
+    backend_options.intra_op_threads = inference_threads;
+    backend_options.inter_op_threads = ctx.config.inter_op_threads;
+    backend_options.graph_optimization = ctx.config.graph_optimization;
+    ctx.detector->setBackendOptions(backend_options);
+    ctx.logger->info("Inference backend: " + DetectionModelFactory::backendToString(backend_options.backend) +
+                     (DetectionModelFactory::isBackendAvailable(backend_options.backend) ? "" : " (not available in this build)"));
+
     if (!ctx.detector->initialize()) {
         ctx.logger->error("Failed to initialize object detector");
         return false;
@@ -106,11 +264,77 @@ bool initializeComponents(ApplicationContext& ctx) {
     ctx.logger->info("Performance warning threshold: " + std::to_string(ctx.config.min_fps_warning_threshold) + " fps");
     ctx.logger->info("Detection photos will be saved to: " + ctx.config.output_dir);
 
+    // Several cameras share one model: a single scheduler with a fair queue per camera
+    bool multi_camera = ctx.config.camera_ids.size() > 1;
+    std::string primary_output_dir = ctx.config.output_dir;
+    if (multi_camera) {
+        ctx.logger->info("Multi-camera mode: " + std::to_string(ctx.config.camera_ids.size()) +
+                         " cameras sharing one model, photos in per-camera subdirectories");
+        mkdir(ctx.config.output_dir.c_str(), 0755);  // Parent of the per-camera directories
+        primary_output_dir = cameraOutputDir(ctx.config.output_dir, ctx.config.camera_id);
+        ctx.inference_scheduler = std::make_shared<InferenceScheduler>(
+            ctx.detector, ctx.logger, effective_threads, static_cast<size_t>(ctx.config.max_frame_queue_size));
+        ctx.inference_scheduler->setBatching(static_cast<size_t>(ctx.config.inference_batch_size),
+                                             ctx.config.batch_timeout_ms);
+    }
+
     // Initialize parallel frame processor
-    int effective_threads = ctx.config.enable_parallel_processing ? ctx.config.processing_threads : 1;
     ctx.frame_processor = std::make_shared<ParallelFrameProcessor>(
         ctx.detector, ctx.logger, ctx.perf_monitor, effective_threads, ctx.config.max_frame_queue_size, 
-        ctx.config.output_dir, ctx.config.enable_brightness_filter, ctx.config.stationary_timeout_seconds);
+        primary_output_dir, ctx.config.enable_brightness_filter, ctx.config.stationary_timeout_seconds);
+    ctx.frame_processor->setBatching(static_cast<size_t>(ctx.config.inference_batch_size), ctx.config.batch_timeout_ms);
+    ctx.frame_processor->setInferenceInterval(ctx.config.inference_interval);
+    if (ctx.config.enable_optical_flow) {
+        ctx.frame_processor->setFlowTracker(std::make_shared<FlowTracker>(ctx.logger));
+    }
+    if (ctx.config.inference_interval > 1) {
+        ctx.logger->info("Inference on 1 of every " + std::to_string(ctx.config.inference_interval) +
+                         " analyzed frames, tracks " +
+                         (ctx.config.enable_optical_flow ? "followed by optical flow" : "predicted") + " in between");
+    }
+    if (ctx.config.enable_motion_gate) {
+        ctx.frame_processor->setMotionGate(std::make_shared<MotionGate>(ctx.logger, ctx.config.motion_threshold));
+        ctx.logger->info("Motion gate enabled: inference skipped on static frames (threshold " +
+                         std::to_string(ctx.config.motion_threshold * 100.0) + "% changed pixels)");
+    }
+    if (ctx.config.enable_motion_roi) {
+        ctx.frame_processor->setMotionRoiExtractor(
+            std::make_shared<MotionRoiExtractor>(ctx.logger, ctx.config.max_motion_rois));
+        ctx.logger->info("Motion ROI inference enabled: up to " + std::to_string(ctx.config.max_motion_rois) +
+                         " native-resolution crops per frame");
+    }
+    if (!ctx.config.include_zones.empty() || !ctx.config.exclude_zones.empty()) {
+        // Already validated by ConfigManager
+        std::vector<DetectionZones::Polygon> include_zones, exclude_zones;
+        for (const auto& zone : ctx.config.include_zones) {
+            include_zones.emplace_back();
+            DetectionZones::parsePolygon(zone, include_zones.back());
+        }
+        for (const auto& zone : ctx.config.exclude_zones) {
+            exclude_zones.emplace_back();
+            DetectionZones::parsePolygon(zone, exclude_zones.back());
+        }
+        ctx.frame_processor->setDetectionZones(
+            std::make_shared<DetectionZones>(std::move(include_zones), std::move(exclude_zones)));
+        ctx.logger->info("Detection zones: " + std::to_string(ctx.config.include_zones.size()) + " include, " +
+                         std::to_string(ctx.config.exclude_zones.size()) + " exclude");
+    }
+    if (ctx.config.enable_tiling) {
+        TiledInference::Options tiling;
+        tiling.columns = ctx.config.tile_columns;
+        tiling.rows = ctx.config.tile_rows;
+        tiling.overlap = ctx.config.tile_overlap;
+        tiling.tile_interval = ctx.config.tile_interval;
+        tiling.every_frame_tiles = ctx.config.tile_every_frame;
+        ctx.frame_processor->setTiledInference(std::make_shared<TiledInference>(ctx.detector, ctx.logger, tiling));
+        ctx.logger->info("Tiled inference enabled: " + std::to_string(static_cast<int>(ctx.config.tile_overlap * 100)) +
+                         "% tile overlap, tiles outside the every-frame set run every " +
+                         std::to_string(ctx.config.tile_interval) + " frames");
+    }
+    if (multi_camera) {
+        ctx.frame_processor->setInferenceScheduler(
+            ctx.inference_scheduler, ctx.inference_scheduler->registerStream("camera" + std::to_string(ctx.config.camera_id)));
+    }
 
     if (!ctx.frame_processor->initialize()) {
         ctx.logger->error("Failed to initialize parallel frame processor");
@@ -122,6 +346,9 @@ bool initializeComponents(ApplicationContext& ctx) {
     } else {
         ctx.logger->info("Sequential processing enabled (single-threaded)");
     }
+    if (ctx.config.inference_batch_size > 1 && !ctx.frame_processor->isParallelEnabled()) {
+        ctx.logger->warning("Batched inference only applies to parallel processing - frames are forwarded one at a time");
+    }
     
     if (ctx.config.enable_brightness_filter) {
         ctx.logger->info("High brightness filter enabled - will reduce glass reflections in bright conditions");
@@ -192,6 +419,17 @@ bool initializeComponents(ApplicationContext& ctx) {
         ctx.logger->info("Notification system initialized");
     }
 
+    // Remaining cameras join once the shared model and integrations are ready
+    if (multi_camera) {
+        if (!initializeAdditionalCameras(ctx, source_options, effective_threads)) {
+            return false;
+        }
+        if (!ctx.inference_scheduler->initialize()) {
+            ctx.logger->error("Failed to start shared inference scheduler");
+            return false;
+        }
+    }
+
     // Initialize timing variables
     ctx.last_heartbeat = std::chrono::steady_clock::now();
     ctx.start_time = std::chrono::steady_clock::now();
@@ -206,6 +444,114 @@ bool initializeComponents(ApplicationContext& ctx) {
     return true;
 }
 
+// Feed the freshest frame of every additional camera to its processor and
+// collect finished results. Tracking, detection logging and photos already
+// happened on each camera's processor; only the futures are retired here.
+static void serviceAdditionalCameras(ApplicationContext& ctx) {
+    auto now = std::chrono::steady_clock::now();
+    for (auto& camera : ctx.additional_cameras) {
+        if (now - camera.last_frame_time >= ctx.frame_interval &&
+            camera.capture_thread->tryGetLatest(camera.latest_capture)) {
+            const ParallelFrameProcessor::FullResolutionSource* full_source = nullptr;
+            if (camera.latest_capture.decode_scale > 1) {
+                camera.full_source.jpeg = camera.latest_capture.jpeg;
+                camera.full_source.decode_scale = camera.latest_capture.decode_scale;
+                full_source = &camera.full_source;
+            }
+            camera.pending_frames.push(camera.frame_processor->submitFrame(camera.latest_capture.frame, full_source,
+                                                                            camera.latest_capture.capture_time));
+            camera.last_frame_time = now;
+        }
+
+        while (!camera.pending_frames.empty() &&
+               camera.pending_frames.front().wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+            try {
+                camera.pending_frames.front().get();
+            } catch (const std::exception& e) {
+                ctx.logger->error("Error processing frame from " + camera.name + ": " + std::string(e.what()));
+            }
+            camera.pending_frames.pop();
+        }
+    }
+}
+
+// Full-resolution frame for preview, stream and notifications. Detections are in
+// camera coordinates, so a reduced-scale inference frame is swapped for a full
+// decode of its JPEG, made at most once per frame and only when something draws.
+static const cv::Mat& getDisplayFrame(ApplicationContext& ctx) {
+    if (ctx.latest_capture.decode_scale <= 1) {
+        return ctx.frame;
+    }
+    if (!ctx.display_frame_ready) {
+        if (!IFrameSource::decodeFrame(ctx.latest_capture.jpeg, ctx.display_frame)) {
+            // Keep boxes aligned even if the full decode fails
+            cv::resize(ctx.frame, ctx.display_frame, cv::Size(),
+                       ctx.latest_capture.decode_scale, ctx.latest_capture.decode_scale, cv::INTER_LINEAR);
+        }
+        ctx.display_frame_ready = true;
+    }
+    return ctx.display_frame;
+}
+
+// Burst mode logic: detect new object types and activate/deactivate burst mode.
+// Called once per processed frame, in capture order, with the tracker snapshot for that frame.
+static void updateBurstMode(ApplicationContext& ctx, const std::vector<ObjectDetector::ObjectTracker>& tracked) {
+    // Get current object types from tracked objects
+    std::set<std::string> current_object_types;
+    
+    bool has_new_object_type = false;
+    bool all_objects_stationary = true;
+    
+    for (const auto& obj : tracked) {
+        // Only consider objects present in current frame
+        if (obj.was_present_last_frame && obj.frames_since_detection == 0) {
+            const std::string& object_type = ClassRegistry::name(obj.class_id);
+            current_object_types.insert(object_type);
+            
+            // Check if this is a new object type not seen in previous frame
+            if (ctx.previous_object_types.find(object_type) == ctx.previous_object_types.end()) {
+                has_new_object_type = true;
+            }
+            
+            // Check if this object is newly entered (not just a new type)
+            if (obj.is_new) {
+                has_new_object_type = true;
+            }
+            
+            // Check if any object is not stationary
+            if (!obj.is_stationary) {
+                all_objects_stationary = false;
+            }
+        }
+    }
+    
+    // Update burst mode state
+    bool previous_burst_state = ctx.burst_mode_active;
+    
+    if (has_new_object_type) {
+        // Activate burst mode when new object type enters
+        ctx.burst_mode_active = true;
+        if (!previous_burst_state) {
+            ctx.logger->info("Burst mode ACTIVATED - new object type detected");
+        }
+    } else if (all_objects_stationary && !current_object_types.empty()) {
+        // Deactivate burst mode when all objects are stationary
+        if (ctx.burst_mode_active) {
+            ctx.burst_mode_active = false;
+            ctx.logger->info("Burst mode DEACTIVATED - all objects stationary");
+        }
+    } else if (current_object_types.empty()) {
+        // Deactivate burst mode when no objects are present
+        if (ctx.burst_mode_active) {
+            ctx.burst_mode_active = false;
+            ctx.logger->info("Burst mode DEACTIVATED - no objects detected");
+        }
+    }
+    
+    // Update previous object types for next iteration
+    ctx.previous_object_types = current_object_types;
+}
+
 void runMainProcessingLoop(ApplicationContext& ctx) {
     ctx.logger->info("Starting main processing loop...");
     ctx.logger->info("Analysis rate limit: " + std::to_string(ctx.config.analysis_rate_limit) + " images/second");
@@ -226,8 +572,23 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
         // Periodic camera health check
         auto health_check_elapsed = std::chrono::duration_cast<std::chrono::seconds>(
             loop_start - last_health_check);
-        if (health_check_elapsed.count() >= HEALTH_CHECK_INTERVAL_SECONDS) {
-            if (!ctx.webcam->healthCheck()) {
+        if (ctx.capture_thread && !ctx.capture_thread->isHealthy()) {
+            // The capture thread runs camera recovery itself and only stops if it failed
+            ctx.logger->error("Camera capture failed - stopping application");
+            running = false;
+            break;
+        }
+        for (const auto& camera : ctx.additional_cameras) {
+            if (!camera.capture_thread->isHealthy()) {
+                ctx.logger->error(camera.name + " capture failed - stopping application");
+                running = false;
+            }
+        }
+        if (!running) {
+            break;
+        }
+        if (!ctx.capture_thread && health_check_elapsed.count() >= HEALTH_CHECK_INTERVAL_SECONDS) {
+            if (!ctx.frame_source->healthCheck()) {
                 ctx.logger->error("Camera health check failed - stopping application");
                 running = false;
                 break;
@@ -236,23 +597,82 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
         }
 
         // Check if enough time has passed for next frame
-        if (loop_start - ctx.last_frame_time < ctx.frame_interval) {
+        // Other cameras keep their own frame schedule, independent of the primary camera
+        serviceAdditionalCameras(ctx);
+
+        if (!ctx.unthrottled && loop_start - ctx.last_frame_time < ctx.frame_interval) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
             continue;
         }
 
-        // Capture frame from webcam
-        if (!ctx.webcam->captureFrame(ctx.frame)) {
-            ctx.logger->warning("Failed to capture frame from webcam");
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            continue;
+        if (ctx.capture_thread) {
+            // Take the freshest frame without waiting on the camera
+            bool source_finished = ctx.capture_thread->isFinished();  // Checked first so no final frame is missed
+            if (!ctx.capture_thread->tryGetLatest(ctx.latest_capture)) {
+                if (source_finished) {
+                    ctx.logger->info("Frame source finished - stopping application");
+                    ctx.perf_monitor->logPerformanceReport();
+                    running = false;
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                continue;
+            }
+            ctx.frame = ctx.latest_capture.frame;
+            auto frame_age = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - ctx.latest_capture.capture_time);
+            ctx.logger->debug("Analyzing frame #" + std::to_string(ctx.latest_capture.sequence) +
+                              " captured " + std::to_string(frame_age.count()) + " ms ago");
+        } else {
+            // Capture inline; JPEG sources are decoded once for analysis
+            bool captured;
+            if (ctx.frame_source->providesEncodedFrames()) {
+                captured = ctx.frame_source->captureEncodedFrame(ctx.latest_capture.jpeg) &&
+                           IFrameSource::decodeFrame(ctx.latest_capture.jpeg, ctx.frame, ctx.decode_scale);
+                ctx.latest_capture.decode_scale = ctx.decode_scale;
+            } else {
+                ctx.latest_capture.jpeg.clear();
+                ctx.latest_capture.decode_scale = 1;
+                captured = ctx.frame_source->captureFrame(ctx.frame);
+            }
+            if (!captured) {
+                if (ctx.frame_source->isExhausted()) {
+                    ctx.logger->info("Frame source finished - stopping application");
+                    ctx.perf_monitor->logPerformanceReport();
+                    running = false;
+                    break;
+                }
+                ctx.logger->warning("Failed to capture frame from frame source");
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+            ctx.latest_capture.capture_time = std::chrono::steady_clock::now();
+        }
+        ctx.display_frame_ready = false;
+
+        // Forward the camera's own JPEG to stream clients without re-encoding it
+        bool streamed_passthrough = false;
+        if (ctx.config.stream_passthrough && ctx.network_streamer && !ctx.latest_capture.jpeg.empty()) {
+            ctx.network_streamer->updateEncodedFrame(ctx.latest_capture.jpeg);
+            streamed_passthrough = true;
         }
 
         // Start performance monitoring
         ctx.perf_monitor->startFrameProcessing();
 
         // Submit frame for processing (parallel or sequential)
-        auto future = ctx.frame_processor->submitFrame(ctx.frame);
+        const ParallelFrameProcessor::FullResolutionSource* full_source = nullptr;
+        if (ctx.latest_capture.decode_scale > 1) {
+            ctx.full_source.jpeg = ctx.latest_capture.jpeg;
+            ctx.full_source.decode_scale = ctx.latest_capture.decode_scale;
+            full_source = &ctx.full_source;
+        }
+        if (ctx.unthrottled && ctx.frame_processor->isParallelEnabled() &&
+            ctx.pending_frames.size() >= static_cast<size_t>(ctx.config.max_frame_queue_size)) {
+            // Benchmark sources never drop frames: wait for the oldest result instead of overflowing the queue
+            ctx.pending_frames.front().wait();
+        }
+        auto future = ctx.frame_processor->submitFrame(ctx.frame, full_source, ctx.latest_capture.capture_time);
         ctx.pending_frames.push(std::move(future));
 
         // Process completed frames
@@ -293,7 +713,7 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
                         }
                         
                         ctx.viewfinder->showFrameWithStats(
-                            ctx.frame, 
+                            getDisplayFrame(ctx), 
                             result.detections,
                             stats.current_fps,
                             stats.avg_processing_time_ms,
@@ -321,8 +741,8 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
                         }
                     }
                     
-                    // Update network streamer if enabled
-                    if (ctx.config.enable_streaming && ctx.network_streamer) {
+                    // Update network streamer if enabled (annotated stream unless passing camera JPEGs through)
+                    if (ctx.config.enable_streaming && ctx.network_streamer && !streamed_passthrough) {
                         // Get statistics for display (same as viewfinder)
                         auto stats = gatherSystemStats(ctx);
                         std::string camera_name = "";
@@ -339,7 +759,7 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
                         }
                         
                         ctx.network_streamer->updateFrameWithStats(
-                            ctx.frame,
+                            getDisplayFrame(ctx),
                             result.detections,
                             stats.current_fps,
                             stats.avg_processing_time_ms,
@@ -361,20 +781,21 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
                         );
                     }
                     
-                    // Send notifications for newly detected objects
-                    if (ctx.config.enable_notifications && ctx.notification_manager) {
-                        const auto& tracked = ctx.detector->getTrackedObjects();
+                    // Send notifications for newly detected objects (predicted frames carry no new ones)
+                    if (ctx.config.enable_notifications && ctx.notification_manager && !result.inference_skipped &&
+                        result.tracked_objects) {
+                        const auto& tracked = *result.tracked_objects;
                         
                         for (const auto& obj : tracked) {
                             // Only notify for newly entered objects in current frame
                             if (obj.is_new && obj.was_present_last_frame && obj.frames_since_detection == 0) {
                                 // Create frame with bounding boxes for notification
-                                cv::Mat frame_with_boxes = ctx.frame.clone();
+                                cv::Mat frame_with_boxes = getDisplayFrame(ctx).clone();
                                 
                                 // Draw all current detections on the frame
                                 for (const auto& det : result.detections) {
                                     cv::rectangle(frame_with_boxes, det.bbox, cv::Scalar(0, 255, 0), 2);
-                                    std::string label = det.class_name + " " + 
+                                    std::string label = ClassRegistry::name(det.class_id) + " " + 
                                         std::to_string(static_cast<int>(det.confidence * 100)) + "%";
                                     cv::putText(frame_with_boxes, label, 
                                         cv::Point(det.bbox.x, det.bbox.y - 10),
@@ -386,14 +807,14 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
                                 
                                 // Create notification data
                                 NotificationManager::NotificationData notif_data;
-                                notif_data.object_type = obj.object_type;
+                                notif_data.object_type = ClassRegistry::name(obj.class_id);
                                 notif_data.x = obj.center.x;
                                 notif_data.y = obj.center.y;
                                 notif_data.confidence = 0.0;  // Will be set from detection if available
                                 
                                 // Find corresponding detection to get confidence
                                 for (const auto& det : result.detections) {
-                                    if (det.class_name == obj.object_type) {
+                                    if (det.class_id == obj.class_id) {
                                         notif_data.confidence = det.confidence;
                                         break;
                                     }
@@ -416,6 +837,11 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
                             }
                         }
                     }
+                    
+                    // Results arrive in capture order, so burst decisions follow the scene timeline
+                    if (ctx.config.enable_burst_mode && result.tracked_objects) {
+                        updateBurstMode(ctx, *result.tracked_objects);
+                    }
                 }
             } catch (const std::exception& e) {
                 ctx.logger->error("Error processing frame result: " + std::string(e.what()));
@@ -437,6 +863,10 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
         if (now - ctx.last_heartbeat >= ctx.heartbeat_interval) {
             ctx.logger->logHeartbeat();
             ctx.perf_monitor->logPerformanceReport();
+            ctx.frame_processor->logInferenceStats();
+            if (ctx.inference_scheduler) {
+                ctx.inference_scheduler->logStreamStats();
+            }
             ctx.last_heartbeat = now;
         }
         
@@ -448,64 +878,6 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
             ctx.system_monitor->performPeriodicCheck();
         }
 
-        // Burst mode logic: detect new object types and activate/deactivate burst mode
-        if (ctx.config.enable_burst_mode) {
-            // Get current object types from tracked objects
-            std::set<std::string> current_object_types;
-            const auto& tracked = ctx.detector->getTrackedObjects();
-            
-            bool has_new_object_type = false;
-            bool all_objects_stationary = true;
-            
-            for (const auto& obj : tracked) {
-                // Only consider objects present in current frame
-                if (obj.was_present_last_frame && obj.frames_since_detection == 0) {
-                    current_object_types.insert(obj.object_type);
-                    
-                    // Check if this is a new object type not seen in previous frame
-                    if (ctx.previous_object_types.find(obj.object_type) == ctx.previous_object_types.end()) {
-                        has_new_object_type = true;
-                    }
-                    
-                    // Check if this object is newly entered (not just a new type)
-                    if (obj.is_new) {
-                        has_new_object_type = true;
-                    }
-                    
-                    // Check if any object is not stationary
-                    if (!obj.is_stationary) {
-                        all_objects_stationary = false;
-                    }
-                }
-            }
-            
-            // Update burst mode state
-            bool previous_burst_state = ctx.burst_mode_active;
-            
-            if (has_new_object_type) {
-                // Activate burst mode when new object type enters
-                ctx.burst_mode_active = true;
-                if (!previous_burst_state) {
-                    ctx.logger->info("Burst mode ACTIVATED - new object type detected");
-                }
-            } else if (all_objects_stationary && !current_object_types.empty()) {
-                // Deactivate burst mode when all objects are stationary
-                if (ctx.burst_mode_active) {
-                    ctx.burst_mode_active = false;
-                    ctx.logger->info("Burst mode DEACTIVATED - all objects stationary");
-                }
-            } else if (current_object_types.empty()) {
-                // Deactivate burst mode when no objects are present
-                if (ctx.burst_mode_active) {
-                    ctx.burst_mode_active = false;
-                    ctx.logger->info("Burst mode DEACTIVATED - no objects detected");
-                }
-            }
-            
-            // Update previous object types for next iteration
-            ctx.previous_object_types = current_object_types;
-        }
-
         // Apply rate limiting with evenly distributed sleep time
         // Calculate required sleep time based on analysis rate limit and actual processing time
         double target_interval_ms = 1000.0 / ctx.config.analysis_rate_limit;
@@ -518,6 +890,8 @@ void runMainProcessingLoop(ApplicationContext& ctx) {
             // Only add minimal delay to prevent excessive CPU usage
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
             ctx.logger->debug("Burst mode active: skipping normal rate limiting (minimal 1ms delay)");
+        } else if (ctx.unthrottled) {
+            // Benchmark run: no rate limiting at all
         } else if (sleep_time_ms > 0) {
             auto sleep_duration = std::chrono::milliseconds(static_cast<long>(sleep_time_ms));
             ctx.logger->debug("Rate limiting: sleeping for " + std::to_string(sleep_time_ms) + " ms (processing took " + std::to_string(actual_processing_time_ms) + " ms, target interval: " + std::to_string(target_interval_ms) + " ms)");
@@ -534,6 +908,7 @@ void performGracefulShutdown(ApplicationContext& ctx) {
     
     // Shutdown frame processor first
     ctx.frame_processor->shutdown();
+    ctx.frame_processor->logInferenceStats();
     
     // Process any remaining frames
     while (!ctx.pending_frames.empty()) {
@@ -546,6 +921,26 @@ void performGracefulShutdown(ApplicationContext& ctx) {
         ctx.pending_frames.pop();
     }
     
+    // Then every other camera; each drains its own frames from the shared scheduler
+    for (auto& camera : ctx.additional_cameras) {
+        camera.frame_processor->shutdown();
+        camera.frame_processor->logInferenceStats();
+        while (!camera.pending_frames.empty()) {
+            try {
+                camera.pending_frames.front().get();
+            } catch (...) {
+                // Ignore errors during shutdown
+            }
+            camera.pending_frames.pop();
+        }
+        camera.capture_thread->stop();
+        camera.source->release();
+    }
+    if (ctx.inference_scheduler) {
+        ctx.inference_scheduler->logStreamStats();
+        ctx.inference_scheduler->shutdown();
+    }
+    
     // Close viewfinder if it was open
     if (ctx.viewfinder) {
         ctx.viewfinder->close();
@@ -556,7 +951,11 @@ void performGracefulShutdown(ApplicationContext& ctx) {
         ctx.network_streamer->stop();
     }
     
-    ctx.webcam->release();
+    // Stop reading frames before the camera is released
+    if (ctx.capture_thread) {
+        ctx.capture_thread->stop();
+    }
+    ctx.frame_source->release();
     
     // Print final summary covering entire program runtime
     ctx.logger->printFinalSummary();
@@ -0,0 +1,76 @@
+#include "box_kalman_filter.hpp"
+#include <algorithm>
+#include <cmath>
+
+BoxKalmanFilter::BoxKalmanFilter() = default;
+
+BoxKalmanFilter::BoxKalmanFilter(const cv::Rect& box) {
+    const float reference = std::max(1.0f, static_cast<float>(box.height));
+    const float position_var = std::pow(MEASUREMENT_NOISE * reference, 2.0f);
+    const float velocity_var = std::pow(INITIAL_VELOCITY_STD * reference, 2.0f);
+    auto measured = measure(box);
+    for (size_t i = 0; i < axes_.size(); ++i) {
+        axes_[i].position = measured[i];
+        axes_[i].var_pp = position_var;
+        axes_[i].var_vv = velocity_var;
+    }
+}
+
+std::array<float, 4> BoxKalmanFilter::measure(const cv::Rect& box) {
+    return {box.x + box.width / 2.0f, box.y + box.height / 2.0f,
+            static_cast<float>(box.width), static_cast<float>(box.height)};
+}
+
+void BoxKalmanFilter::Axis::predict(float dt, float accel_var) {
+    // x' = F x, P' = F P F^T + Q for F = [1 dt; 0 1] and piecewise-constant white acceleration
+    const float dt2 = dt * dt;
+    position += velocity * dt;
+    var_pp += 2.0f * dt * var_pv + dt2 * var_vv + accel_var * dt2 * dt2 / 4.0f;
+    var_pv += dt * var_vv + accel_var * dt2 * dt / 2.0f;
+    var_vv += accel_var * dt2;
+}
+
+void BoxKalmanFilter::Axis::correct(float measured, float measurement_var) {
+    const float innovation_var = var_pp + measurement_var;
+    if (innovation_var <= 0.0f) {
+        return;
+    }
+    const float gain_p = var_pp / innovation_var;
+    const float gain_v = var_pv / innovation_var;
+    const float residual = measured - position;
+    position += gain_p * residual;
+    velocity += gain_v * residual;
+
+    const float pp = var_pp;
+    const float pv = var_pv;
+    var_pp = (1.0f - gain_p) * pp;
+    var_pv = (1.0f - gain_p) * pv;
+    var_vv -= gain_v * pv;
+}
+
+void BoxKalmanFilter::update(const cv::Rect& box, double dt_seconds) {
+    const float dt = static_cast<float>(std::max(0.0, dt_seconds));
+    const float reference = std::max(1.0f, static_cast<float>(box.height));
+    const float accel_var = std::pow(ACCELERATION_NOISE * reference, 2.0f);
+    const float measurement_var = std::pow(MEASUREMENT_NOISE * reference, 2.0f);
+    auto measured = measure(box);
+    for (size_t i = 0; i < axes_.size(); ++i) {
+        axes_[i].predict(dt, accel_var);
+        axes_[i].correct(measured[i], measurement_var);
+    }
+}
+
+cv::Rect BoxKalmanFilter::predict(double dt_seconds) const {
+    const float dt = static_cast<float>(std::max(0.0, dt_seconds));
+    const float center_x = axes_[0].position + axes_[0].velocity * dt;
+    const float center_y = axes_[1].position + axes_[1].velocity * dt;
+    const float width = std::max(1.0f, axes_[2].position + axes_[2].velocity * dt);
+    const float height = std::max(1.0f, axes_[3].position + axes_[3].velocity * dt);
+    return cv::Rect(static_cast<int>(std::lround(center_x - width / 2.0f)),
+                    static_cast<int>(std::lround(center_y - height / 2.0f)),
+                    static_cast<int>(std::lround(width)), static_cast<int>(std::lround(height)));
+}
+
+cv::Point2f BoxKalmanFilter::getVelocity() const {
+    return cv::Point2f(axes_[0].velocity, axes_[1].velocity);
+}
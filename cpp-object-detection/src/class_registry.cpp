@@ -0,0 +1,109 @@
+#include "class_registry.hpp"
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+// Colors of the classes the application targets (BGR); everything else is drawn white
+cv::Scalar paletteColor(const std::string& name) {
+    if (name == "person") {
+        return cv::Scalar(0, 255, 0);  // Green
+    } else if (name == "cat") {
+        return cv::Scalar(0, 0, 255);  // Red
+    } else if (name == "dog") {
+        return cv::Scalar(255, 0, 0);  // Blue
+    } else if (name == "bird") {
+        return cv::Scalar(255, 255, 0);  // Cyan
+    } else if (name == "bear") {
+        return cv::Scalar(0, 128, 128);  // Dark cyan/teal
+    } else if (name == "car" || name == "truck" || name == "bus") {
+        return cv::Scalar(0, 255, 255);  // Yellow
+    } else if (name == "motorcycle" || name == "bicycle") {
+        return cv::Scalar(255, 0, 255);  // Magenta
+    } else if (name == "chair") {
+        return cv::Scalar(128, 0, 128);  // Purple
+    } else if (name == "book") {
+        return cv::Scalar(255, 128, 0);  // Orange
+    }
+    return cv::Scalar(255, 255, 255);  // White for unknown
+}
+
+struct Registry {
+    std::mutex mutex;                                  // Serializes registration
+    std::unordered_map<std::string, int> ids;          // Guarded by mutex
+    std::array<std::string, ClassRegistry::MAX_CLASSES> names;
+    std::array<cv::Scalar, ClassRegistry::MAX_CLASSES> colors;
+    std::atomic<int> count{0};                         // Entries below count are complete and never change
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+}  // namespace
+
+int ClassRegistry::intern(const std::string& name) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    auto it = r.ids.find(name);
+    if (it != r.ids.end()) {
+        return it->second;
+    }
+    const int class_id = r.count.load(std::memory_order_relaxed);
+    if (class_id >= MAX_CLASSES) {
+        return -1;
+    }
+    r.names[class_id] = name;
+    r.colors[class_id] = paletteColor(name);
+    r.ids.emplace(name, class_id);
+    r.count.store(class_id + 1, std::memory_order_release);
+    return class_id;
+}
+
+std::vector<int> ClassRegistry::internAll(const std::vector<std::string>& names) {
+    std::vector<int> class_ids;
+    class_ids.reserve(names.size());
+    for (const auto& name : names) {
+        class_ids.push_back(intern(name));
+    }
+    return class_ids;
+}
+
+int ClassRegistry::find(const std::string& name) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    auto it = r.ids.find(name);
+    return it == r.ids.end() ? -1 : it->second;
+}
+
+const std::string& ClassRegistry::name(int class_id) {
+    static const std::string unknown;
+    Registry& r = registry();
+    if (class_id < 0 || class_id >= r.count.load(std::memory_order_acquire)) {
+        return unknown;
+    }
+    return r.names[class_id];
+}
+
+const cv::Scalar& ClassRegistry::color(int class_id) {
+    static const cv::Scalar white(255, 255, 255);
+    Registry& r = registry();
+    if (class_id < 0 || class_id >= r.count.load(std::memory_order_acquire)) {
+        return white;
+    }
+    return r.colors[class_id];
+}
+
+ClassRegistry::ClassSet ClassRegistry::makeSet(const std::vector<std::string>& names) {
+    ClassSet set;
+    for (const auto& name : names) {
+        int class_id = intern(name);
+        if (class_id >= 0) {
+            set.set(static_cast<size_t>(class_id));
+        }
+    }
+    return set;
+}
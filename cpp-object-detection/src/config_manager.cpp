@@ -1,4 +1,5 @@
 #include "config_manager.hpp"
+#include "detection_zones.hpp"
 #include "webcam_interface.hpp"
 #include <iostream>
 #include <sstream>
@@ -42,10 +43,26 @@ ConfigManager::ParseResult ConfigManager::parseArgs(int argc, char* argv[]) {
             config_->enable_parallel_processing = true;
         } else if (arg == "--no-headless") {
             config_->headless = false;
+        } else if (arg == "--no-capture-thread") {
+            config_->enable_capture_thread = false;
         } else if (arg == "--show-preview") {
             config_->show_preview = true;
         } else if (arg == "--enable-streaming") {
             config_->enable_streaming = true;
+        } else if (arg == "--stream-passthrough") {
+            config_->stream_passthrough = true;
+        } else if (arg == "--reduced-decode") {
+            config_->reduced_decode = true;
+        } else if (arg == "--source-loop") {
+            config_->source_loop = true;
+        } else if (arg == "--motion-gate") {
+            config_->enable_motion_gate = true;
+        } else if (arg == "--motion-roi") {
+            config_->enable_motion_roi = true;
+        } else if (arg == "--optical-flow") {
+            config_->enable_optical_flow = true;
+        } else if (arg == "--tiles") {
+            config_->enable_tiling = true;
         } else if (arg == "--enable-brightness-filter") {
             config_->enable_brightness_filter = true;
         } else if (arg == "--enable-burst-mode") {
@@ -91,11 +108,32 @@ bool ConfigManager::parseArgument(const std::string& arg, const std::string& val
         } else if (arg == "--summary-interval") {
             config_->summary_interval_minutes = std::stoi(value);
         } else if (arg == "--camera-id") {
-            config_->camera_id = std::stoi(value);
+            // Repeatable and comma separated: --camera-id 0 --camera-id 2, or --camera-id 0,2
+            std::stringstream ids(value);
+            std::string id;
+            while (std::getline(ids, id, ',')) {
+                config_->camera_ids.push_back(std::stoi(id));
+            }
+            if (config_->camera_ids.empty()) {
+                throw std::invalid_argument(value);
+            }
+            config_->camera_id = config_->camera_ids.front();
         } else if (arg == "--frame-width") {
             config_->frame_width = std::stoi(value);
         } else if (arg == "--frame-height") {
             config_->frame_height = std::stoi(value);
+        } else if (arg == "--capture-backend") {
+            config_->capture_backend = value;
+        } else if (arg == "--source") {
+            config_->frame_source = value;
+        } else if (arg == "--source-path") {
+            config_->source_path = value;
+        } else if (arg == "--source-fps") {
+            config_->source_fps = std::stod(value);
+        } else if (arg == "--source-pacing") {
+            config_->source_pacing = value;
+        } else if (arg == "--source-frames") {
+            config_->source_frame_limit = std::stoi(value);
         } else if (arg == "--model-path") {
             config_->model_path = value;
         } else if (arg == "--config-path") {
@@ -110,10 +148,53 @@ bool ConfigManager::parseArgument(const std::string& arg, const std::string& val
             config_->processing_threads = std::stoi(value);
         } else if (arg == "--max-frame-queue") {
             config_->max_frame_queue_size = std::stoi(value);
+        } else if (arg == "--inference-replicas") {
+            config_->inference_replicas = std::stoi(value);
+        } else if (arg == "--inference-threads") {
+            config_->inference_threads = std::stoi(value);
+        } else if (arg == "--backend") {
+            config_->inference_backend = value;
+        } else if (arg == "--inter-op-threads") {
+            config_->inter_op_threads = std::stoi(value);
+        } else if (arg == "--graph-optimization") {
+            config_->graph_optimization = value;
+        } else if (arg == "--inference-batch-size") {
+            config_->inference_batch_size = std::stoi(value);
+        } else if (arg == "--batch-timeout-ms") {
+            config_->batch_timeout_ms = std::stoi(value);
         } else if (arg == "--output-dir") {
             config_->output_dir = value;
         } else if (arg == "--analysis-rate-limit") {
             config_->analysis_rate_limit = std::stod(value);
+        } else if (arg == "--inference-interval") {
+            config_->inference_interval = std::stoi(value);
+        } else if (arg == "--motion-threshold") {
+            config_->motion_threshold = std::stod(value);
+        } else if (arg == "--max-motion-rois") {
+            config_->max_motion_rois = std::stoi(value);
+        } else if (arg == "--tile-grid") {
+            // COLUMNSxROWS, e.g. 3x2
+            size_t separator = value.find('x');
+            if (separator == std::string::npos) {
+                throw std::invalid_argument(value);
+            }
+            config_->tile_columns = std::stoi(value.substr(0, separator));
+            config_->tile_rows = std::stoi(value.substr(separator + 1));
+        } else if (arg == "--tile-overlap") {
+            config_->tile_overlap = std::stod(value);
+        } else if (arg == "--tile-interval") {
+            config_->tile_interval = std::stoi(value);
+        } else if (arg == "--include-zone") {
+            config_->include_zones.push_back(value);
+        } else if (arg == "--exclude-zone") {
+            config_->exclude_zones.push_back(value);
+        } else if (arg == "--tile-every-frame") {
+            std::stringstream indices(value);
+            std::string index;
+            config_->tile_every_frame.clear();
+            while (std::getline(indices, index, ',')) {
+                config_->tile_every_frame.push_back(std::stoi(index));
+            }
         } else if (arg == "--streaming-port") {
             config_->streaming_port = std::stoi(value);
         } else if (arg == "--stationary-timeout") {
@@ -160,9 +241,20 @@ void ConfigManager::printUsage(const std::string& program_name) const {
               << "  --log-file FILE                Log file path (default: object_detection.log)\n"
               << "  --heartbeat-interval N         Heartbeat log interval in minutes (default: 10)\n"
               << "  --summary-interval N           Detection summary interval in minutes (default: 60)\n"
-              << "  --camera-id N                  Camera device ID (default: 0)\n"
+              << "  --camera-id N[,N...]           Camera device ID; repeat or list IDs to run several cameras (default: 0)\n"
               << "  --frame-width N                Frame width in pixels (default: 1280)\n"
               << "  --frame-height N               Frame height in pixels (default: 720)\n"
+              << "  --no-capture-thread            Read the camera inline in the processing loop instead of on a capture thread\n"
+              << "  --capture-backend NAME         Camera capture backend: opencv, v4l2 (default: opencv)\n"
+              << "                                 v4l2 reads MJPEG from mmap'd driver buffers and decodes only analyzed frames (Linux)\n"
+              << "  --reduced-decode               Decode camera JPEGs for inference at 1/2, 1/4 or 1/8 scale to match --detection-scale\n"
+              << "                                 Full resolution is decoded only for saved photos, preview and stream (needs v4l2)\n"
+              << "  --source TYPE                  Frame source: webcam, video, images, synthetic (default: webcam)\n"
+              << "  --source-path PATH             Video file (--source video) or image directory (--source images)\n"
+              << "  --source-fps N                 Frame rate for video/images/synthetic (default: video's own rate, else 30)\n"
+              << "  --source-pacing MODE           realtime, or fast to process every frame without waiting (default: realtime)\n"
+              << "  --source-loop                  Restart video/image sources when they end\n"
+              << "  --source-frames N              Stop the synthetic source after N frames (default: 0 = endless)\n"
               << "  --model-path FILE              Path to ONNX model file (default: models/yolov5s.onnx)\n"
               << "  --config-path FILE             Path to model config file (default: models/yolov5s.yaml)\n"
               << "  --classes-path FILE            Path to class names file (default: models/coco.names)\n"
@@ -170,13 +262,36 @@ void ConfigManager::printUsage(const std::string& program_name) const {
               << "                                 Available: yolov5s (fast), yolov5l (accurate), yolov8n, yolov8m\n"
               << "  --detection-scale N            Scale factor for detection (0.1-1.0, default: 0.5)\n"
               << "                                 Lower values = faster but may reduce accuracy\n"
-              << "                                 0.5 = 50% reduction (1280x720 -> 640x360, 75% fewer pixels)\n"
+              << "                                 Picks a stride-aligned network input (1280x720 @ 0.25 -> 320x320)\n"
               << "  --output-dir DIR               Directory to save detection photos (default: detections)\n"
               << "  --processing-threads N         Number of processing threads (default: 1)\n"
               << "  --enable-parallel              Enable parallel frame processing\n"
               << "  --max-frame-queue N            Maximum frames in processing queue (default: 10)\n"
+              << "  --inference-replicas N         Model instances for concurrent inference (0-16, default: 0 = one per thread)\n"
+              << "  --inference-threads N          Intra-op threads per inference (0-64, default: 0 = cores / replicas)\n"
+              << "                                 Example for a 4-core Pi: --processing-threads 2 --inference-replicas 2 --inference-threads 2\n"
+              << "  --backend NAME                 Inference backend: opencv, onnxruntime (default: opencv)\n"
+              << "                                 onnxruntime requires a build with ONNX Runtime, otherwise falls back to opencv\n"
+              << "  --inter-op-threads N           ONNX Runtime threads across independent graph nodes (0-64, default: 0 = sequential)\n"
+              << "  --graph-optimization LEVEL     ONNX Runtime graph optimization: disable, basic, extended, all (default: all)\n"
+              << "  --inference-batch-size N       Queued frames per forward pass in parallel mode (1-16, default: 1 = no batching)\n"
+              << "                                 Needs a model exported with a dynamic batch axis, otherwise runs frames one at a time\n"
+              << "  --batch-timeout-ms MS          Longest wait for a batch to fill (0-1000, default: 10)\n"
               << "  --analysis-rate-limit N        Maximum images to analyze per second (default: 1.0)\n"
               << "                                 Lower values reduce CPU usage by adding sleep between analyses\n"
+              << "  --inference-interval N         Run the detector on every Nth analyzed image, predict tracks in between (default: 1)\n"
+              << "  --optical-flow                 Follow tracks with optical flow between inferences (needs --inference-interval 2+)\n"
+              << "  --motion-gate                  Skip inference on static frames while no moving object is in view\n"
+              << "  --motion-threshold F           Fraction of changed pixels that counts as motion (0-1, default: 0.005)\n"
+              << "  --motion-roi                   Detect on native-resolution crops of moving regions instead of the full frame\n"
+              << "  --max-motion-rois N            Most motion regions inferred per frame (1-16, default: 4)\n"
+              << "  --tiles                        Also detect on overlapping native-resolution tiles (for 1080p/4K scenes)\n"
+              << "  --tile-grid CxR                Tile columns x rows (default: fewest tiles no larger than the network input)\n"
+              << "  --tile-overlap F               Fraction of a tile shared with its neighbour (0-0.5, default: 0.2)\n"
+              << "  --tile-interval N              Run tiles not in --tile-every-frame only every N frames (default: 1)\n"
+              << "  --tile-every-frame I[,I...]    Row-major tile indices to run on every frame (default: all)\n"
+              << "  --include-zone X,Y;X,Y;...     Only detect inside this polygon (0-1 frame coordinates, repeatable)\n"
+              << "  --exclude-zone X,Y;X,Y;...     Ignore this polygon, e.g. a busy street (0-1 frame coordinates, repeatable)\n"
               << "  --enable-gpu                   Enable GPU acceleration (default: disabled)\n"
               << "                                 Linux: Uses CUDA backend if available\n"
               << "                                 macOS: Uses OpenCL backend for Intel integrated/discrete GPUs\n"
@@ -184,6 +299,7 @@ void ConfigManager::printUsage(const std::string& program_name) const {
               << "  --show-preview                 Show real-time viewfinder with detection bounding boxes\n"
               << "  --enable-streaming             Enable MJPEG HTTP streaming over network (default: disabled)\n"
               << "  --streaming-port N             Port for HTTP streaming server (default: 8080)\n"
+              << "  --stream-passthrough           Stream the camera's own JPEGs without re-encoding or overlays (needs --capture-backend v4l2)\n"
               << "  --enable-brightness-filter     Enable high brightness filter to reduce glass reflections (default: disabled)\n"
               << "  --stationary-timeout N         Seconds before stopping photos of stationary objects (default: 120)\n"
               << "  --enable-burst-mode            Enable burst mode to max out FPS when new objects enter (default: disabled)\n"
@@ -210,6 +326,7 @@ void ConfigManager::printUsage(const std::string& program_name) const {
               << "  " << program_name << " --camera-id 1 --verbose --log-file /tmp/detection.log\n"
               << "  " << program_name << " --model-type yolov5l --max-fps 2  # High accuracy mode\n"
               << "  " << program_name << " --model-type yolov5s --processing-threads 4  # Fast parallel mode\n"
+              << "  " << program_name << " --backend onnxruntime --inference-threads 4  # ONNX Runtime inference\n"
               << "  " << program_name << " --show-preview  # Development mode with real-time viewfinder\n"
               << "  " << program_name << " --max-fps 1 --frame-width 640 --frame-height 480  # Low-resource mode (32-bit)\n"
               << "  " << program_name << " --enable-streaming --streaming-port 8080  # Network streaming mode\n"
@@ -268,11 +385,62 @@ bool ConfigManager::validateConfig() const {
         return false;
     }
     
+    for (size_t i = 0; i < config_->camera_ids.size(); ++i) {
+        int id = config_->camera_ids[i];
+        if (id < 0) {
+            std::cerr << "Invalid camera_id: " << id << std::endl;
+            return false;
+        }
+        if (std::find(config_->camera_ids.begin(), config_->camera_ids.begin() + i, id) !=
+            config_->camera_ids.begin() + i) {
+            std::cerr << "Camera " << id << " given more than once" << std::endl;
+            return false;
+        }
+    }
+    
+    if (config_->camera_ids.size() > 1 && config_->frame_source != "webcam") {
+        std::cerr << "Multiple --camera-id values require --source webcam" << std::endl;
+        return false;
+    }
+    
     if (config_->frame_width <= 0 || config_->frame_height <= 0) {
         std::cerr << "Invalid frame dimensions: " << config_->frame_width << "x" << config_->frame_height << std::endl;
         return false;
     }
     
+    if (config_->capture_backend != "opencv" && config_->capture_backend != "v4l2") {
+        std::cerr << "Invalid capture_backend: " << config_->capture_backend
+                  << " (must be opencv or v4l2)" << std::endl;
+        return false;
+    }
+    
+    if (config_->frame_source != "webcam" && config_->frame_source != "video" &&
+        config_->frame_source != "images" && config_->frame_source != "synthetic") {
+        std::cerr << "Invalid frame_source: " << config_->frame_source
+                  << " (must be webcam, video, images or synthetic)" << std::endl;
+        return false;
+    }
+    
+    if ((config_->frame_source == "video" || config_->frame_source == "images") && config_->source_path.empty()) {
+        std::cerr << "Frame source " << config_->frame_source << " needs a path. Use --source-path" << std::endl;
+        return false;
+    }
+    
+    if (config_->source_pacing != "realtime" && config_->source_pacing != "fast") {
+        std::cerr << "Invalid source_pacing: " << config_->source_pacing << " (must be realtime or fast)" << std::endl;
+        return false;
+    }
+    
+    if (config_->source_fps < 0.0 || config_->source_fps > 1000.0) {
+        std::cerr << "Invalid source_fps: " << config_->source_fps << " (must be 0-1000)" << std::endl;
+        return false;
+    }
+    
+    if (config_->source_frame_limit < 0) {
+        std::cerr << "Invalid source_frame_limit: " << config_->source_frame_limit << " (must be >= 0)" << std::endl;
+        return false;
+    }
+    
     if (config_->processing_threads <= 0 || config_->processing_threads > 16) {
         std::cerr << "Invalid processing_threads: " << config_->processing_threads << " (must be 1-16)" << std::endl;
         return false;
@@ -283,11 +451,114 @@ bool ConfigManager::validateConfig() const {
         return false;
     }
     
+    if (config_->inference_replicas < 0 || config_->inference_replicas > 16) {
+        std::cerr << "Invalid inference_replicas: " << config_->inference_replicas << " (must be 0-16)" << std::endl;
+        return false;
+    }
+    
+    if (config_->inference_threads < 0 || config_->inference_threads > 64) {
+        std::cerr << "Invalid inference_threads: " << config_->inference_threads << " (must be 0-64)" << std::endl;
+        return false;
+    }
+    
+    if (config_->inter_op_threads < 0 || config_->inter_op_threads > 64) {
+        std::cerr << "Invalid inter_op_threads: " << config_->inter_op_threads << " (must be 0-64)" << std::endl;
+        return false;
+    }
+    
+    if (config_->graph_optimization != "disable" && config_->graph_optimization != "basic" &&
+        config_->graph_optimization != "extended" && config_->graph_optimization != "all") {
+        std::cerr << "Invalid graph_optimization: " << config_->graph_optimization
+                  << " (must be disable, basic, extended or all)" << std::endl;
+        return false;
+    }
+    
+    if (config_->inference_batch_size < 1 || config_->inference_batch_size > 16) {
+        std::cerr << "Invalid inference_batch_size: " << config_->inference_batch_size << " (must be 1-16)" << std::endl;
+        return false;
+    }
+    
+    if (config_->inference_batch_size > config_->max_frame_queue_size) {
+        std::cerr << "Invalid inference_batch_size: " << config_->inference_batch_size
+                  << " (must not exceed max_frame_queue_size " << config_->max_frame_queue_size << ")" << std::endl;
+        return false;
+    }
+    
+    if (config_->batch_timeout_ms < 0 || config_->batch_timeout_ms > 1000) {
+        std::cerr << "Invalid batch_timeout_ms: " << config_->batch_timeout_ms << " (must be 0-1000)" << std::endl;
+        return false;
+    }
+    
     if (config_->analysis_rate_limit <= 0.0 || config_->analysis_rate_limit > 100.0) {
         std::cerr << "Invalid analysis_rate_limit: " << config_->analysis_rate_limit << " (must be 0.01-100)" << std::endl;
         return false;
     }
     
+    if (config_->inference_interval < 1) {
+        std::cerr << "Invalid inference_interval: " << config_->inference_interval << " (must be at least 1)" << std::endl;
+        return false;
+    }
+    
+    if (config_->enable_optical_flow && config_->inference_interval < 2) {
+        std::cerr << "Optical flow tracking needs --inference-interval of at least 2" << std::endl;
+        return false;
+    }
+    
+    if (config_->motion_threshold <= 0.0 || config_->motion_threshold >= 1.0) {
+        std::cerr << "Invalid motion_threshold: " << config_->motion_threshold << " (must be between 0 and 1)" << std::endl;
+        return false;
+    }
+    
+    if (config_->max_motion_rois < 1 || config_->max_motion_rois > 16) {
+        std::cerr << "Invalid max_motion_rois: " << config_->max_motion_rois << " (must be between 1 and 16)" << std::endl;
+        return false;
+    }
+    
+    if (config_->tile_columns < 0 || config_->tile_rows < 0 ||
+        (config_->tile_columns == 0) != (config_->tile_rows == 0)) {
+        std::cerr << "Invalid tile grid: " << config_->tile_columns << "x" << config_->tile_rows
+                  << " (give both columns and rows)" << std::endl;
+        return false;
+    }
+    
+    if (config_->tile_overlap < 0.0 || config_->tile_overlap > 0.5) {
+        std::cerr << "Invalid tile_overlap: " << config_->tile_overlap << " (must be between 0 and 0.5)" << std::endl;
+        return false;
+    }
+    
+    if (config_->tile_interval < 1) {
+        std::cerr << "Invalid tile_interval: " << config_->tile_interval << " (must be at least 1)" << std::endl;
+        return false;
+    }
+    
+    for (int index : config_->tile_every_frame) {
+        if (index < 0) {
+            std::cerr << "Invalid tile index: " << index << std::endl;
+            return false;
+        }
+    }
+    
+    DetectionZones::Polygon polygon;
+    for (const auto* zones : {&config_->include_zones, &config_->exclude_zones}) {
+        for (const auto& zone : *zones) {
+            if (!DetectionZones::parsePolygon(zone, polygon)) {
+                std::cerr << "Invalid zone: " << zone << " (need at least 3 points x,y;x,y;x,y with 0-1 coordinates)"
+                          << std::endl;
+                return false;
+            }
+        }
+    }
+    
+    if ((!config_->include_zones.empty() || !config_->exclude_zones.empty()) && config_->camera_ids.size() > 1) {
+        std::cerr << "Detection zones are not supported with multiple cameras" << std::endl;
+        return false;
+    }
+    
+    if (config_->enable_tiling && config_->camera_ids.size() > 1) {
+        std::cerr << "--tiles is not supported with multiple cameras" << std::endl;
+        return false;
+    }
+    
     if (config_->streaming_port <= 0 || config_->streaming_port > 65535) {
         std::cerr << "Invalid streaming_port: " << config_->streaming_port << " (must be 1-65535)" << std::endl;
         return false;
@@ -0,0 +1,77 @@
+#include "detection_agreement.hpp"
+#include "class_registry.hpp"
+#include "nms_engine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+DetectionAgreement::DetectionAgreement(double iou_threshold)
+    : iou_threshold_(iou_threshold), frames_(0), iou_sum_(0.0), confidence_delta_sum_(0.0) {
+}
+
+void DetectionAgreement::addFrame(const std::vector<Detection>& reference,
+                                  const std::vector<Detection>& candidate) {
+    frames_++;
+    totals_.reference += reference.size();
+    totals_.candidate += candidate.size();
+    for (const auto& det : reference) {
+        per_class_[ClassRegistry::name(det.class_id)].reference++;
+    }
+    for (const auto& det : candidate) {
+        per_class_[ClassRegistry::name(det.class_id)].candidate++;
+    }
+
+    // Highest-confidence reference detections claim their match first
+    std::vector<size_t> order(reference.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&reference](size_t a, size_t b) {
+        return reference[a].confidence > reference[b].confidence;
+    });
+
+    std::vector<bool> taken(candidate.size(), false);
+    for (size_t r : order) {
+        const Detection& ref = reference[r];
+        int best = -1;
+        float best_iou = 0.0f;
+        for (size_t c = 0; c < candidate.size(); ++c) {
+            if (taken[c] || candidate[c].class_id != ref.class_id) {
+                continue;
+            }
+            float iou = NmsEngine::iou(ref.bbox, candidate[c].bbox);
+            if (iou >= iou_threshold_ && iou > best_iou) {
+                best = static_cast<int>(c);
+                best_iou = iou;
+            }
+        }
+        if (best < 0) {
+            continue;
+        }
+        taken[best] = true;
+        totals_.matched++;
+        per_class_[ClassRegistry::name(ref.class_id)].matched++;
+        iou_sum_ += best_iou;
+        confidence_delta_sum_ += std::abs(ref.confidence - candidate[best].confidence);
+    }
+}
+
+double DetectionAgreement::recall() const {
+    return totals_.reference > 0 ? static_cast<double>(totals_.matched) / totals_.reference : 1.0;
+}
+
+double DetectionAgreement::precision() const {
+    return totals_.candidate > 0 ? static_cast<double>(totals_.matched) / totals_.candidate : 1.0;
+}
+
+double DetectionAgreement::f1() const {
+    double p = precision();
+    double r = recall();
+    return p + r > 0.0 ? 2.0 * p * r / (p + r) : 0.0;
+}
+
+double DetectionAgreement::meanIou() const {
+    return totals_.matched > 0 ? iou_sum_ / totals_.matched : 0.0;
+}
+
+double DetectionAgreement::meanConfidenceDelta() const {
+    return totals_.matched > 0 ? confidence_delta_sum_ / totals_.matched : 0.0;
+}
@@ -0,0 +1,101 @@
+#include "detection_zones.hpp"
+#include <cmath>
+#include <sstream>
+
+DetectionZones::DetectionZones(std::vector<Polygon> include_zones, std::vector<Polygon> exclude_zones)
+    : include_zones_(std::move(include_zones)), exclude_zones_(std::move(exclude_zones)), filtered_count_(0) {
+}
+
+bool DetectionZones::parsePolygon(const std::string& text, Polygon& polygon) {
+    polygon.clear();
+    std::stringstream points(text);
+    std::string point;
+    while (std::getline(points, point, ';')) {
+        size_t comma = point.find(',');
+        if (comma == std::string::npos) {
+            return false;
+        }
+        try {
+            size_t used_x = 0;
+            size_t used_y = 0;
+            std::string y_text = point.substr(comma + 1);
+            float x = std::stof(point.substr(0, comma), &used_x);
+            float y = std::stof(y_text, &used_y);
+            if (used_x != comma || used_y != y_text.size() || x < 0.0f || x > 1.0f || y < 0.0f || y > 1.0f) {
+                return false;
+            }
+            polygon.emplace_back(x, y);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return polygon.size() >= 3;
+}
+
+cv::Mat DetectionZones::rasterize(const cv::Size& frame_size) const {
+    auto toPixels = [&frame_size](const std::vector<Polygon>& zones) {
+        std::vector<std::vector<cv::Point>> polygons;
+        for (const auto& zone : zones) {
+            std::vector<cv::Point> points;
+            for (const auto& p : zone) {
+                points.emplace_back(static_cast<int>(std::lround(p.x * (frame_size.width - 1))),
+                                    static_cast<int>(std::lround(p.y * (frame_size.height - 1))));
+            }
+            polygons.push_back(std::move(points));
+        }
+        return polygons;
+    };
+
+    cv::Mat mask(frame_size, CV_8UC1, cv::Scalar(include_zones_.empty() ? 255 : 0));
+    if (!include_zones_.empty()) {
+        cv::fillPoly(mask, toPixels(include_zones_), cv::Scalar(255));
+    }
+    if (!exclude_zones_.empty()) {
+        cv::fillPoly(mask, toPixels(exclude_zones_), cv::Scalar(0));
+    }
+    return mask;
+}
+
+cv::Mat DetectionZones::getMask(const cv::Size& frame_size, int channels) {
+    std::lock_guard<std::mutex> lock(mask_mutex_);
+    auto& mask = masks_[std::make_tuple(frame_size.width, frame_size.height, channels)];
+    if (mask.empty()) {
+        mask = rasterize(frame_size);
+        if (channels > 1) {
+            cv::merge(std::vector<cv::Mat>(static_cast<size_t>(channels), mask), mask);
+        }
+    }
+    return mask;
+}
+
+cv::Mat DetectionZones::applyMask(const cv::Mat& frame) {
+    cv::Mat masked;
+    applyMask(frame, masked);
+    return masked;
+}
+
+void DetectionZones::applyMask(const cv::Mat& frame, cv::Mat& masked) {
+    cv::bitwise_and(frame, getMask(frame.size(), frame.channels()), masked);
+}
+
+std::vector<Detection> DetectionZones::filter(const std::vector<Detection>& detections, const cv::Size& frame_size,
+                                              double min_overlap) {
+    if (detections.empty()) {
+        return {};
+    }
+    cv::Mat mask = getMask(frame_size);
+    const cv::Rect bounds(0, 0, frame_size.width, frame_size.height);
+
+    std::vector<Detection> kept;
+    kept.reserve(detections.size());
+    for (const auto& detection : detections) {
+        cv::Rect box = detection.bbox & bounds;
+        double inside = box.empty() ? 0.0 : cv::countNonZero(mask(box));
+        if (detection.bbox.area() > 0 && inside / detection.bbox.area() >= min_overlap) {
+            kept.push_back(detection);
+        } else {
+            filtered_count_++;
+        }
+    }
+    return kept;
+}
@@ -0,0 +1,276 @@
+#include "file_frame_sources.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+// Check if filesystem is available
+#if __has_include(<filesystem>)
+    #include <filesystem>
+    namespace fs = std::filesystem;
+    #define HAVE_STD_FILESYSTEM 1
+#else
+    #include <dirent.h>
+    #define HAVE_STD_FILESYSTEM 0
+#endif
+
+namespace {
+
+std::string lowercaseExtension(const std::string& path) {
+    size_t dot = path.find_last_of('.');
+    size_t slash = path.find_last_of('/');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return "";
+    }
+    std::string extension = path.substr(dot);
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension;
+}
+
+bool isJpegExtension(const std::string& extension) {
+    return extension == ".jpg" || extension == ".jpeg";
+}
+
+bool isImageExtension(const std::string& extension) {
+    return isJpegExtension(extension) || extension == ".png" || extension == ".bmp";
+}
+
+std::vector<std::string> listDirectory(const std::string& directory) {
+    std::vector<std::string> paths;
+#if HAVE_STD_FILESYSTEM
+    std::error_code error;
+    for (const auto& entry : fs::directory_iterator(directory, error)) {
+        if (entry.is_regular_file(error)) {
+            paths.push_back(entry.path().string());
+        }
+    }
+#else
+    if (DIR* dir = opendir(directory.c_str())) {
+        while (dirent* entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (name != "." && name != "..") {
+                paths.push_back(directory + "/" + name);
+            }
+        }
+        closedir(dir);
+    }
+#endif
+    return paths;
+}
+
+}  // namespace
+
+// ============================================================================
+// VideoFileSource Implementation
+// ============================================================================
+
+VideoFileSource::VideoFileSource(const std::string& path, FramePacing pacing, double fps, bool loop,
+                                 std::shared_ptr<Logger> logger)
+    : path_(path), pacing_(pacing), requested_fps_(fps), fps_(DEFAULT_FPS), loop_(loop),
+      logger_(logger), exhausted_(false), frames_read_(0) {
+}
+
+VideoFileSource::~VideoFileSource() {
+    release();
+}
+
+bool VideoFileSource::initialize() {
+    if (capture_.isOpened()) {
+        return true;
+    }
+
+    logger_->info("Opening video file: " + path_);
+    if (!capture_.open(path_)) {
+        logger_->error("Failed to open video file: " + path_);
+        return false;
+    }
+
+    double file_fps = capture_.get(cv::CAP_PROP_FPS);
+    fps_ = requested_fps_ > 0.0 ? requested_fps_ : (file_fps > 0.0 ? file_fps : DEFAULT_FPS);
+    pacer_.configure(pacing_, fps_);
+    exhausted_ = false;
+    frames_read_ = 0;
+    return true;
+}
+
+bool VideoFileSource::captureFrame(cv::Mat& frame) {
+    if (!capture_.isOpened() || exhausted_) {
+        return false;
+    }
+
+    pacer_.wait();
+    if (capture_.read(frame) && !frame.empty()) {
+        frames_read_++;
+        return true;
+    }
+
+    if (loop_ && frames_read_ > 0) {
+        logger_->debug("Video file ended after " + std::to_string(frames_read_) + " frames - restarting");
+        capture_.set(cv::CAP_PROP_POS_FRAMES, 0);
+        frames_read_ = 0;
+        if (capture_.read(frame) && !frame.empty()) {
+            frames_read_++;
+            return true;
+        }
+    }
+
+    logger_->info("Video file ended: " + path_);
+    exhausted_ = true;
+    return false;
+}
+
+bool VideoFileSource::isReady() const {
+    return capture_.isOpened() && !exhausted_;
+}
+
+std::string VideoFileSource::getSourceInfo() const {
+    if (!capture_.isOpened()) {
+        return "Video file not opened";
+    }
+
+    std::stringstream ss;
+    ss << "Video file " << path_ << ": "
+       << static_cast<int>(capture_.get(cv::CAP_PROP_FRAME_WIDTH)) << "x"
+       << static_cast<int>(capture_.get(cv::CAP_PROP_FRAME_HEIGHT));
+    int frame_count = static_cast<int>(capture_.get(cv::CAP_PROP_FRAME_COUNT));
+    if (frame_count > 0) {
+        ss << ", " << frame_count << " frames";
+    }
+    if (pacing_ == FramePacing::REAL_TIME) {
+        ss << " @ " << fps_ << " fps";
+    } else {
+        ss << ", unpaced";
+    }
+    if (loop_) {
+        ss << ", looping";
+    }
+    return ss.str();
+}
+
+void VideoFileSource::release() {
+    if (capture_.isOpened()) {
+        capture_.release();
+        logger_->info("Video file released");
+    }
+}
+
+// ============================================================================
+// ImageDirectorySource Implementation
+// ============================================================================
+
+ImageDirectorySource::ImageDirectorySource(const std::string& directory, FramePacing pacing, double fps, bool loop,
+                                           std::shared_ptr<Logger> logger)
+    : directory_(directory), pacing_(pacing), fps_(fps > 0.0 ? fps : DEFAULT_FPS), loop_(loop),
+      logger_(logger), next_index_(0), all_jpeg_(false), initialized_(false), exhausted_(false) {
+}
+
+bool ImageDirectorySource::initialize() {
+    if (initialized_) {
+        return true;
+    }
+
+    logger_->info("Scanning image directory: " + directory_);
+    image_paths_.clear();
+    all_jpeg_ = true;
+    for (const auto& path : listDirectory(directory_)) {
+        std::string extension = lowercaseExtension(path);
+        if (isImageExtension(extension)) {
+            image_paths_.push_back(path);
+            all_jpeg_ = all_jpeg_ && isJpegExtension(extension);
+        }
+    }
+    std::sort(image_paths_.begin(), image_paths_.end());
+
+    if (image_paths_.empty()) {
+        logger_->error("No images (.jpg, .jpeg, .png, .bmp) found in " + directory_);
+        return false;
+    }
+
+    pacer_.configure(pacing_, fps_);
+    next_index_ = 0;
+    exhausted_ = false;
+    initialized_ = true;
+    return true;
+}
+
+std::string ImageDirectorySource::nextPath() {
+    if (next_index_ >= image_paths_.size()) {
+        if (!loop_) {
+            if (!exhausted_) {
+                logger_->info("Image directory exhausted after " + std::to_string(image_paths_.size()) + " images");
+            }
+            exhausted_ = true;
+            return "";
+        }
+        next_index_ = 0;
+    }
+    return image_paths_[next_index_++];
+}
+
+bool ImageDirectorySource::captureFrame(cv::Mat& frame) {
+    if (!initialized_) {
+        return false;
+    }
+
+    std::string path = nextPath();
+    if (path.empty()) {
+        return false;
+    }
+
+    pacer_.wait();
+    frame = cv::imread(path, cv::IMREAD_COLOR);
+    if (frame.empty()) {
+        logger_->warning("Failed to read image: " + path);
+        return false;
+    }
+    return true;
+}
+
+bool ImageDirectorySource::captureEncodedFrame(std::vector<uchar>& jpeg) {
+    if (!providesEncodedFrames()) {
+        return false;
+    }
+
+    std::string path = nextPath();
+    if (path.empty()) {
+        return false;
+    }
+
+    pacer_.wait();
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        logger_->warning("Failed to read image: " + path);
+        return false;
+    }
+    std::streamsize size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    jpeg.resize(static_cast<size_t>(std::max<std::streamsize>(size, 0)));
+    if (size <= 0 || !file.read(reinterpret_cast<char*>(jpeg.data()), size)) {
+        logger_->warning("Failed to read image: " + path);
+        return false;
+    }
+    return true;
+}
+
+std::string ImageDirectorySource::getSourceInfo() const {
+    if (!initialized_) {
+        return "Image directory not opened";
+    }
+
+    std::stringstream ss;
+    ss << "Image directory " << directory_ << ": " << image_paths_.size() << " images"
+       << (all_jpeg_ ? " (JPEG passthrough)" : "");
+    if (pacing_ == FramePacing::REAL_TIME) {
+        ss << " @ " << fps_ << " fps";
+    } else {
+        ss << ", unpaced";
+    }
+    if (loop_) {
+        ss << ", looping";
+    }
+    return ss.str();
+}
+
+void ImageDirectorySource::release() {
+    initialized_ = false;
+}
@@ -0,0 +1,212 @@
+#include "flow_tracker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+float median(std::vector<float>& values) {
+    auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+    std::nth_element(values.begin(), middle, values.end());
+    return *middle;
+}
+
+}  // namespace
+
+FlowTracker::FlowTracker(std::shared_ptr<Logger> logger)
+    : logger_(logger), scale_(1.0), track_count_(0), keyframe_size_(0), frames_propagated_(0), low_confidence_fallbacks_(0), new_motion_fallbacks_(0),
+      keyframe_boxes_(0), keyframe_points_(0) {
+}
+
+cv::Mat FlowTracker::prepareImage(const cv::Mat& frame) {
+    if (frame.empty()) {
+        return cv::Mat();
+    }
+    const int width = std::min(FLOW_WIDTH, frame.cols);
+    const int height = std::max(1, static_cast<int>(std::lround(static_cast<double>(frame.rows) * width / frame.cols)));
+    cv::Mat small;
+    cv::resize(frame, small, cv::Size(width, height), 0, 0, cv::INTER_AREA);
+    if (small.channels() == 1) {
+        return small;
+    }
+    cv::Mat gray;
+    cv::cvtColor(small, gray, cv::COLOR_BGR2GRAY);
+    return gray;
+}
+
+void FlowTracker::setKeyframe(const cv::Mat& image, const std::vector<cv::Rect>& boxes,
+                              const cv::Size& frame_size) {
+    track_count_ = 0;
+    keyframe_size_ = boxes.size();
+    previous_ = image;
+    if (image.empty() || frame_size.width <= 0) {
+        previous_.release();
+        return;
+    }
+    scale_ = static_cast<double>(image.cols) / frame_size.width;
+
+    const cv::Rect bounds(0, 0, image.cols, image.rows);
+    for (size_t index = 0; index < boxes.size(); ++index) {
+        const cv::Rect& box = boxes[index];
+        if (box.empty()) {
+            continue;
+        }
+        // Tracks are reused, so their point buffers survive from one keyframe to the next
+        if (track_count_ == tracks_.size()) {
+            tracks_.emplace_back();
+        }
+        Track& track = tracks_[track_count_++];
+        track.index = index;
+        track.points.clear();
+        track.box = cv::Rect2f(static_cast<float>(box.x * scale_), static_cast<float>(box.y * scale_),
+                               static_cast<float>(box.width * scale_), static_cast<float>(box.height * scale_));
+
+        // Features from the middle of the box, which is the object rather than the background
+        cv::Rect inner(static_cast<int>(std::lround(track.box.x + track.box.width * 0.15f)),
+                       static_cast<int>(std::lround(track.box.y + track.box.height * 0.15f)),
+                       static_cast<int>(std::lround(track.box.width * 0.7f)),
+                       static_cast<int>(std::lround(track.box.height * 0.7f)));
+        inner &= bounds;
+        if (inner.width >= 8 && inner.height >= 8) {
+            cv::goodFeaturesToTrack(image(inner), track.points, MAX_POINTS_PER_BOX, 0.01, 2.0);
+            for (auto& point : track.points) {
+                point.x += inner.x;
+                point.y += inner.y;
+            }
+        }
+        if (track.points.size() < static_cast<size_t>(MIN_POINTS_PER_BOX)) {
+            track.points.clear();
+        }
+        keyframe_boxes_++;
+        keyframe_points_ += track.points.size();
+    }
+}
+
+bool FlowTracker::propagate(const cv::Mat& image, std::vector<cv::Rect>& boxes) {
+    boxes.clear();
+    if (previous_.empty() || image.size() != previous_.size()) {
+        return false;
+    }
+    if (newMotionOutsideTracks(image)) {
+        new_motion_fallbacks_++;
+        previous_.release();
+        return false;
+    }
+
+    points_.clear();
+    for (size_t t = 0; t < track_count_; ++t) {
+        const Track& track = tracks_[t];
+        points_.insert(points_.end(), track.points.begin(), track.points.end());
+    }
+    if (!points_.empty()) {
+        // Forward, then back again: a point that does not return to its start was lost
+        const cv::Size window(15, 15);
+        cv::calcOpticalFlowPyrLK(previous_, image, points_, next_points_, status_, errors_, window, PYRAMID_LEVELS);
+        cv::calcOpticalFlowPyrLK(image, previous_, next_points_, back_points_, back_status_, errors_, window,
+                                 PYRAMID_LEVELS);
+    }
+
+    size_t offset = 0;
+    for (size_t t = 0; t < track_count_; ++t) {
+        Track& track = tracks_[t];
+        const size_t count = track.points.size();
+        if (count == 0) {
+            continue;
+        }
+        before_.clear();
+        after_.clear();
+        for (size_t i = offset; i < offset + count; ++i) {
+            if (status_[i] && back_status_[i] && cv::norm(back_points_[i] - points_[i]) <= MAX_ROUND_TRIP_ERROR) {
+                before_.push_back(points_[i]);
+                after_.push_back(next_points_[i]);
+            }
+        }
+        offset += count;
+        if (after_.size() < static_cast<size_t>(MIN_POINTS_PER_BOX) || after_.size() < count * MIN_POINTS_KEPT) {
+            low_confidence_fallbacks_++;
+            previous_.release();
+            return false;
+        }
+
+        shift_x_.clear();
+        shift_y_.clear();
+        spread_.clear();
+        for (size_t i = 0; i < after_.size(); ++i) {
+            shift_x_.push_back(after_[i].x - before_[i].x);
+            shift_y_.push_back(after_[i].y - before_[i].y);
+            for (size_t j = i + 1; j < after_.size(); ++j) {
+                double distance_before = cv::norm(before_[j] - before_[i]);
+                if (distance_before > 1.0) {
+                    spread_.push_back(static_cast<float>(cv::norm(after_[j] - after_[i]) / distance_before));
+                }
+            }
+        }
+        float scale = spread_.empty() ? 1.0f : std::max(0.8f, std::min(median(spread_), 1.25f));
+        float center_x = track.box.x + track.box.width / 2.0f + median(shift_x_);
+        float center_y = track.box.y + track.box.height / 2.0f + median(shift_y_);
+        float width = track.box.width * scale;
+        float height = track.box.height * scale;
+        track.box = cv::Rect2f(center_x - width / 2.0f, center_y - height / 2.0f, width, height);
+        track.points.assign(after_.begin(), after_.end());
+    }
+
+    previous_ = image;
+    frames_propagated_++;
+    boxes.assign(keyframe_size_, cv::Rect());
+    for (size_t t = 0; t < track_count_; ++t) {
+        const Track& track = tracks_[t];
+        if (track.points.empty()) {
+            continue;  // Nothing measured its movement
+        }
+        boxes[track.index] = cv::Rect(static_cast<int>(std::lround(track.box.x / scale_)),
+                                   static_cast<int>(std::lround(track.box.y / scale_)),
+                                   static_cast<int>(std::lround(track.box.width / scale_)),
+                                   static_cast<int>(std::lround(track.box.height / scale_)));
+    }
+    return true;
+}
+
+bool FlowTracker::newMotionOutsideTracks(const cv::Mat& image) {
+    cv::absdiff(previous_, image, difference_);
+    cv::threshold(difference_, difference_, DIFFERENCE_THRESHOLD, 255, cv::THRESH_BINARY);
+
+    // Changes on and around the tracked objects are their own movement
+    const cv::Rect bounds(0, 0, image.cols, image.rows);
+    for (size_t t = 0; t < track_count_; ++t) {
+        const Track& track = tracks_[t];
+        float margin_x = track.box.width * BOX_MARGIN;
+        float margin_y = track.box.height * BOX_MARGIN;
+        cv::Rect around(static_cast<int>(std::floor(track.box.x - margin_x)),
+                        static_cast<int>(std::floor(track.box.y - margin_y)),
+                        static_cast<int>(std::ceil(track.box.width + 2 * margin_x)),
+                        static_cast<int>(std::ceil(track.box.height + 2 * margin_y)));
+        around &= bounds;
+        if (!around.empty()) {
+            difference_(around).setTo(cv::Scalar(0));
+        }
+    }
+    return cv::countNonZero(difference_) > NEW_MOTION_FRACTION * difference_.total();
+}
+
+FlowTracker::Stats FlowTracker::getStats() const {
+    Stats stats;
+    stats.frames_propagated = frames_propagated_.load();
+    stats.low_confidence_fallbacks = low_confidence_fallbacks_.load();
+    stats.new_motion_fallbacks = new_motion_fallbacks_.load();
+    uint64_t boxes = keyframe_boxes_.load();
+    if (boxes > 0) {
+        stats.avg_points_per_box = static_cast<double>(keyframe_points_.load()) / boxes;
+    }
+    return stats;
+}
+
+void FlowTracker::logStats() const {
+    Stats stats = getStats();
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1)
+         << "Optical flow: " << stats.frames_propagated << " frames tracked between detections (avg "
+         << stats.avg_points_per_box << " points per box), detection forced " << stats.low_confidence_fallbacks
+         << " times by lost points and " << stats.new_motion_fallbacks << " times by new motion";
+    logger_->info(line.str());
+}
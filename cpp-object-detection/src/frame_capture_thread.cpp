@@ -0,0 +1,111 @@
+#include "frame_capture_thread.hpp"
+
+FrameCaptureThread::FrameCaptureThread(std::shared_ptr<IFrameSource> source, std::shared_ptr<Logger> logger)
+    : source_(source), logger_(logger), running_(false), healthy_(true), finished_(false),
+      frames_captured_(0), frames_dropped_(0), decode_scale_(1) {
+}
+
+FrameCaptureThread::~FrameCaptureThread() {
+    stop();
+}
+
+void FrameCaptureThread::setDecodeScale(int scale) {
+    if (running_.load()) {
+        logger_->warning("Decode scale must be set before the capture thread starts");
+        return;
+    }
+    decode_scale_ = scale;
+}
+
+bool FrameCaptureThread::start() {
+    if (running_.load()) {
+        return true;
+    }
+    if (!source_ || !source_->isReady()) {
+        logger_->error("Cannot start capture thread - frame source not initialized");
+        return false;
+    }
+
+    running_ = true;
+    healthy_ = true;
+    finished_ = false;
+    thread_ = std::thread(&FrameCaptureThread::captureLoop, this);
+    logger_->info("Capture thread started");
+    return true;
+}
+
+void FrameCaptureThread::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    logger_->info("Capture thread stopped (" + std::to_string(frames_captured_.load()) + " frames captured, " +
+                 std::to_string(frames_dropped_.load()) + " superseded before analysis)");
+}
+
+bool FrameCaptureThread::tryGetLatest(CapturedFrame& captured) {
+    const CapturedFrame* latest = slot_.consume();
+    if (!latest) {
+        return false;
+    }
+    if (!latest->jpeg.empty()) {
+        captured.jpeg = latest->jpeg;
+        if (!IFrameSource::decodeFrame(captured.jpeg, captured.frame, decode_scale_)) {
+            logger_->warning("Failed to decode captured MJPEG frame");
+            return false;
+        }
+        captured.decode_scale = decode_scale_;
+    } else {
+        latest->frame.copyTo(captured.frame);
+        captured.jpeg.clear();
+        captured.decode_scale = 1;
+    }
+    captured.sequence = latest->sequence;
+    captured.capture_time = latest->capture_time;
+    return true;
+}
+
+void FrameCaptureThread::captureLoop() {
+    logger_->debug("Capture thread running");
+
+    uint64_t sequence = 0;
+    while (running_.load()) {
+        CapturedFrame& target = slot_.writeBuffer();
+
+        // Blocks until the camera delivers the next frame; the read fills the
+        // recycled buffer, so steady state capture does not allocate
+        bool captured;
+        if (source_->providesEncodedFrames()) {
+            captured = source_->captureEncodedFrame(target.jpeg);
+        } else {
+            target.jpeg.clear();
+            captured = source_->captureFrame(target.frame);
+        }
+        if (!captured) {
+            if (source_->isExhausted()) {
+                logger_->info("Frame source reached its end - capture thread stopping");
+                finished_ = true;
+                break;
+            }
+            // Reconnects once failures persist; gives up only if recovery fails
+            if (!source_->healthCheck()) {
+                logger_->error("Frame source recovery failed - capture thread stopping");
+                healthy_ = false;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(CAPTURE_RETRY_DELAY_MS));
+            continue;
+        }
+
+        target.sequence = sequence++;
+        target.capture_time = std::chrono::steady_clock::now();
+        if (slot_.publish()) {
+            frames_dropped_++;
+        }
+        frames_captured_++;
+    }
+
+    logger_->debug("Capture thread exiting");
+}
@@ -0,0 +1,104 @@
+#include "frame_source_interface.hpp"
+#include "webcam_interface.hpp"
+#include "file_frame_sources.hpp"
+#include "synthetic_frame_source.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+bool IFrameSource::decodeFrame(const std::vector<uchar>& jpeg, cv::Mat& frame, int scale) {
+    if (jpeg.empty()) {
+        return false;
+    }
+
+    int flags = cv::IMREAD_COLOR;
+    switch (scale) {
+        case 2: flags = cv::IMREAD_REDUCED_COLOR_2; break;
+        case 4: flags = cv::IMREAD_REDUCED_COLOR_4; break;
+        case 8: flags = cv::IMREAD_REDUCED_COLOR_8; break;
+        default: break;
+    }
+
+    try {
+        cv::imdecode(jpeg, flags, &frame);
+    } catch (const cv::Exception&) {
+        return false;
+    }
+    return !frame.empty();
+}
+
+int IFrameSource::selectDecodeScale(double detection_scale_factor) {
+    // Never decode below the detection resolution, the network input would be upscaled
+    int scale = 1;
+    for (int candidate : {2, 4, 8}) {
+        if (1.0 / candidate + 1e-6 >= detection_scale_factor) {
+            scale = candidate;
+        }
+    }
+    return scale;
+}
+
+std::unique_ptr<IFrameSource> FrameSourceFactory::createSource(const SourceOptions& options,
+                                                               std::shared_ptr<Logger> logger) {
+    switch (options.type) {
+        case SourceType::WEBCAM: {
+            auto webcam = std::make_unique<WebcamInterface>(options.camera_id, options.width, options.height, logger);
+            webcam->setCaptureBackend(options.capture_backend);
+            return webcam;
+        }
+        case SourceType::VIDEO_FILE:
+            return std::make_unique<VideoFileSource>(options.path, options.pacing, options.fps, options.loop, logger);
+        case SourceType::IMAGE_DIRECTORY:
+            return std::make_unique<ImageDirectorySource>(options.path, options.pacing, options.fps, options.loop, logger);
+        case SourceType::SYNTHETIC:
+            return std::make_unique<SyntheticFrameSource>(options.width, options.height, options.pacing, options.fps,
+                                                          options.frame_limit, logger);
+        default:
+            throw std::invalid_argument("Unknown frame source type");
+    }
+}
+
+FrameSourceFactory::SourceType FrameSourceFactory::parseSourceType(const std::string& source_name) {
+    std::string lower_name = source_name;
+    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
+    
+    if (lower_name == "webcam" || lower_name == "camera") {
+        return SourceType::WEBCAM;
+    } else if (lower_name == "video" || lower_name == "file") {
+        return SourceType::VIDEO_FILE;
+    } else if (lower_name == "images" || lower_name == "directory") {
+        return SourceType::IMAGE_DIRECTORY;
+    } else if (lower_name == "synthetic") {
+        return SourceType::SYNTHETIC;
+    } else {
+        throw std::invalid_argument("Unknown frame source: " + source_name);
+    }
+}
+
+std::string FrameSourceFactory::sourceTypeToString(SourceType type) {
+    switch (type) {
+        case SourceType::WEBCAM:
+            return "webcam";
+        case SourceType::VIDEO_FILE:
+            return "video";
+        case SourceType::IMAGE_DIRECTORY:
+            return "images";
+        case SourceType::SYNTHETIC:
+            return "synthetic";
+        default:
+            return "unknown";
+    }
+}
+
+FramePacing FrameSourceFactory::parsePacing(const std::string& pacing_name) {
+    std::string lower_name = pacing_name;
+    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
+    
+    if (lower_name == "realtime" || lower_name == "real-time") {
+        return FramePacing::REAL_TIME;
+    } else if (lower_name == "fast" || lower_name == "asap") {
+        return FramePacing::AS_FAST_AS_POSSIBLE;
+    } else {
+        throw std::invalid_argument("Unknown frame pacing: " + pacing_name);
+    }
+}
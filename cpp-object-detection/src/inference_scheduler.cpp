@@ -0,0 +1,268 @@
+#include "inference_scheduler.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+InferenceScheduler::InferenceScheduler(std::shared_ptr<ObjectDetector> detector,
+                                       std::shared_ptr<Logger> logger,
+                                       int num_workers,
+                                       size_t max_queue_per_stream)
+    : detector_(detector), logger_(logger), num_workers_(std::max(1, num_workers)),
+      max_queue_per_stream_(std::max<size_t>(1, max_queue_per_stream)),
+      max_batch_size_(1), batch_timeout_(0), next_stream_(0), total_queued_(0),
+      shutdown_requested_(false) {
+}
+
+InferenceScheduler::~InferenceScheduler() {
+    shutdown();
+}
+
+void InferenceScheduler::setBatching(size_t max_batch_size, int batch_timeout_ms) {
+    if (!worker_threads_.empty()) {
+        logger_->warning("Batching must be configured before initialization - ignoring");
+        return;
+    }
+    max_batch_size_ = std::max<size_t>(1, max_batch_size);
+    batch_timeout_ = std::chrono::milliseconds(std::max(0, batch_timeout_ms));
+}
+
+int InferenceScheduler::registerStream(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_.emplace_back();
+    streams_.back().name = name;
+    return static_cast<int>(streams_.size() - 1);
+}
+
+bool InferenceScheduler::initialize() {
+    logger_->info("Starting shared inference scheduler: " + std::to_string(num_workers_) + " workers, " +
+                  std::to_string(streams_.size()) + " camera streams");
+    if (max_batch_size_ > 1) {
+        logger_->info("Batched inference: up to " + std::to_string(max_batch_size_) + " frames per forward pass, " +
+                      std::to_string(batch_timeout_.count()) + "ms batch window");
+    }
+
+    worker_threads_.reserve(num_workers_);
+    for (int i = 0; i < num_workers_; ++i) {
+        worker_threads_.emplace_back(&InferenceScheduler::workerThread, this);
+    }
+    return true;
+}
+
+bool InferenceScheduler::submit(int stream_id, const cv::Mat& frame, Completion done,
+                                std::vector<cv::Rect> regions, std::vector<cv::Point> origins) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_requested_.load() || stream_id < 0 || stream_id >= static_cast<int>(streams_.size())) {
+            return false;
+        }
+        Stream& stream = streams_[stream_id];
+        if (stream.queue.size() >= max_queue_per_stream_) {
+            stream.dropped++;
+            return false;
+        }
+        stream.queue.push_back(Job{stream_id, frame, std::move(done), std::move(regions), std::move(origins)});
+        stream.submitted++;
+        total_queued_++;
+    }
+
+    if (max_batch_size_ > 1) {
+        // A worker may be waiting for its batch to fill rather than for work
+        work_condition_.notify_all();
+    } else {
+        work_condition_.notify_one();
+    }
+    return true;
+}
+
+void InferenceScheduler::drainStream(int stream_id) {
+    std::deque<Job> cancelled;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stream_id < 0 || stream_id >= static_cast<int>(streams_.size())) {
+            return;
+        }
+        Stream& stream = streams_[stream_id];
+        cancelled.swap(stream.queue);
+        total_queued_ -= cancelled.size();
+        idle_condition_.wait(lock, [&stream] { return stream.in_flight == 0; });
+    }
+
+    std::vector<Detection> no_detections;
+    for (auto& job : cancelled) {
+        job.done(false, no_detections);
+    }
+}
+
+void InferenceScheduler::shutdown() {
+    if (shutdown_requested_.exchange(true)) {
+        return;
+    }
+
+    work_condition_.notify_all();
+    for (auto& thread : worker_threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    worker_threads_.clear();
+
+    // Resolve anything still queued so no stream waits on a frame forever
+    std::vector<Job> remaining;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& stream : streams_) {
+            for (auto& job : stream.queue) {
+                remaining.push_back(std::move(job));
+            }
+            stream.queue.clear();
+        }
+        total_queued_ = 0;
+    }
+    std::vector<Detection> no_detections;
+    for (auto& job : remaining) {
+        job.done(false, no_detections);
+    }
+
+    logger_->info("Shared inference scheduler stopped");
+}
+
+size_t InferenceScheduler::getQueueSize(int stream_id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stream_id < 0 || stream_id >= static_cast<int>(streams_.size())) {
+        return 0;
+    }
+    return streams_[stream_id].queue.size();
+}
+
+std::vector<InferenceScheduler::StreamStats> InferenceScheduler::getStreamStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<StreamStats> stats;
+    stats.reserve(streams_.size());
+    for (const auto& stream : streams_) {
+        StreamStats entry;
+        entry.name = stream.name;
+        entry.submitted = stream.submitted;
+        entry.inferred = stream.inferred;
+        entry.dropped = stream.dropped;
+        entry.queued = stream.queue.size();
+        entry.avg_inference_ms = stream.inferred > 0 ? stream.total_inference_ms / stream.inferred : 0.0;
+        stats.push_back(entry);
+    }
+    return stats;
+}
+
+void InferenceScheduler::logStreamStats() const {
+    for (const auto& stats : getStreamStats()) {
+        std::ostringstream line;
+        line << stats.name << ": " << stats.inferred << "/" << stats.submitted << " frames inferred, "
+             << stats.dropped << " dropped, " << stats.queued << " queued, "
+             << std::fixed << std::setprecision(1) << stats.avg_inference_ms << "ms avg inference";
+        logger_->info(line.str());
+    }
+}
+
+void InferenceScheduler::workerThread() {
+    logger_->debug("Inference scheduler worker started");
+
+    while (true) {
+        std::vector<Job> jobs;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_condition_.wait(lock, [this] {
+                return total_queued_ > 0 || shutdown_requested_.load();
+            });
+            if (shutdown_requested_.load()) {
+                break;  // Queued frames are failed by shutdown()
+            }
+
+            if (max_batch_size_ > 1 && total_queued_ < max_batch_size_) {
+                // Give a burst a short window to fill the batch before dispatching
+                work_condition_.wait_for(lock, batch_timeout_, [this] {
+                    return total_queued_ >= max_batch_size_ || shutdown_requested_.load();
+                });
+                if (total_queued_ == 0 || shutdown_requested_.load()) {
+                    continue;  // Another worker took the frames
+                }
+            }
+
+            jobs = takeFairBatch();
+        }
+
+        runJobs(jobs);
+    }
+
+    logger_->debug("Inference scheduler worker exiting");
+}
+
+std::vector<InferenceScheduler::Job> InferenceScheduler::takeFairBatch() {
+    std::vector<Job> jobs;
+    size_t idle_streams = 0;
+    while (jobs.size() < max_batch_size_ && total_queued_ > 0 && idle_streams < streams_.size()) {
+        Stream& stream = streams_[next_stream_];
+        next_stream_ = (next_stream_ + 1) % streams_.size();
+        if (stream.queue.empty()) {
+            idle_streams++;
+            continue;
+        }
+        idle_streams = 0;
+        jobs.push_back(std::move(stream.queue.front()));
+        stream.queue.pop_front();
+        stream.in_flight++;
+        total_queued_--;
+    }
+    return jobs;
+}
+
+void InferenceScheduler::runJobs(std::vector<Job>& jobs) {
+    std::vector<std::vector<Detection>> detections(jobs.size());
+    std::vector<uint8_t> inference_ok(jobs.size(), 0);  // Per job, so one failure does not void the batch
+    auto start = std::chrono::steady_clock::now();
+    try {
+        // Region crops differ in size, so only full frames share a forward pass
+        std::vector<cv::Mat> images;
+        std::vector<size_t> full_frame_jobs;
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            if (!jobs[i].regions.empty()) {
+                detections[i] = detector_->detectObjectsInRegions(jobs[i].frame, jobs[i].regions, jobs[i].origins);
+                inference_ok[i] = 1;
+            } else {
+                images.push_back(jobs[i].frame);
+                full_frame_jobs.push_back(i);
+            }
+        }
+        if (images.size() == 1) {
+            detections[full_frame_jobs[0]] = detector_->detectObjects(images[0]);
+            inference_ok[full_frame_jobs[0]] = 1;
+        } else if (!images.empty()) {
+            auto batch = detector_->detectObjectsBatch(images);
+            if (batch.size() == images.size()) {
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    detections[full_frame_jobs[i]] = std::move(batch[i]);
+                    inference_ok[full_frame_jobs[i]] = 1;
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        logger_->error("Error during shared inference: " + std::string(e.what()));
+    }
+    double per_frame_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count() / jobs.size();
+    detections.resize(jobs.size());
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        try {
+            jobs[i].done(inference_ok[i] != 0, detections[i]);
+        } catch (const std::exception& e) {
+            logger_->error("Error delivering inference result: " + std::string(e.what()));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stream& stream = streams_[jobs[i].stream_id];
+        stream.in_flight--;
+        if (inference_ok[i]) {
+            stream.inferred++;
+            stream.total_inference_ms += per_frame_ms;
+        }
+    }
+    idle_condition_.notify_all();
+}
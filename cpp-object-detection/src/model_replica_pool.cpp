@@ -0,0 +1,58 @@
+#include "model_replica_pool.hpp"
+
+ModelReplicaPool::ModelReplicaPool(const std::vector<IDetectionModel*>& replicas)
+    : replicas_(replicas) {
+    // Free list is used as a stack so the most recently released replica
+    // (whose weights are still warm in cache) is handed out first
+    free_replicas_.reserve(replicas_.size());
+    for (auto it = replicas_.rbegin(); it != replicas_.rend(); ++it) {
+        if (*it) {
+            free_replicas_.push_back(*it);
+        }
+    }
+}
+
+ModelReplicaPool::Lease ModelReplicaPool::acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (replicas_.empty()) {
+        return Lease();
+    }
+
+    available_condition_.wait(lock, [this] { return !free_replicas_.empty(); });
+
+    IDetectionModel* model = free_replicas_.back();
+    free_replicas_.pop_back();
+    return Lease(this, model);
+}
+
+ModelReplicaPool::Lease ModelReplicaPool::tryAcquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_replicas_.empty()) {
+        return Lease();
+    }
+
+    IDetectionModel* model = free_replicas_.back();
+    free_replicas_.pop_back();
+    return Lease(this, model);
+}
+
+size_t ModelReplicaPool::available() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return free_replicas_.size();
+}
+
+void ModelReplicaPool::release(IDetectionModel* model) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_replicas_.push_back(model);
+    }
+    available_condition_.notify_one();
+}
+
+void ModelReplicaPool::Lease::reset() {
+    if (pool_ && model_) {
+        pool_->release(model_);
+    }
+    pool_ = nullptr;
+    model_ = nullptr;
+}
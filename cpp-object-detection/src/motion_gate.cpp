@@ -0,0 +1,123 @@
+#include "motion_gate.hpp"
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+MotionGate::MotionGate(std::shared_ptr<Logger> logger, double changed_fraction, int pixel_threshold,
+                       int refresh_seconds)
+    : logger_(logger), changed_fraction_(changed_fraction), pixel_threshold_(pixel_threshold),
+      refresh_interval_(refresh_seconds), frames_checked_(0), frames_skipped_(0), forced_refreshes_(0),
+      total_gate_ms_(0.0), last_changed_fraction_(0.0) {
+}
+
+int MotionGate::countChangedPixels(const uchar* a, const uchar* b, int count, int threshold) {
+    int changed = 0;
+    int i = 0;
+#if CV_SIMD128
+    // 16 pixels per iteration: |a - b| > threshold gives a 0xFF/0x00 mask, reduced to 0/1 and summed
+    const cv::v_uint8x16 limit = cv::v_setall_u8(static_cast<uchar>(std::min(threshold, 255)));
+    const cv::v_uint8x16 one = cv::v_setall_u8(1);
+    while (i <= count - 16) {
+        // 16-bit lanes gain at most 2 per iteration; flush well before they overflow
+        cv::v_uint16x8 sum = cv::v_setzero_u16();
+        for (int block = 0; block < 16384 && i <= count - 16; ++block, i += 16) {
+            cv::v_uint8x16 diff = cv::v_absdiff(cv::v_load(a + i), cv::v_load(b + i));
+            cv::v_uint16x8 low, high;
+            cv::v_expand((diff > limit) & one, low, high);
+            sum = sum + low + high;
+        }
+        cv::v_uint32x4 low, high;
+        cv::v_expand(sum, low, high);
+        changed += static_cast<int>(cv::v_reduce_sum(low + high));
+    }
+#endif
+    for (; i < count; ++i) {
+        if (std::abs(a[i] - b[i]) > threshold) {
+            changed++;
+        }
+    }
+    return changed;
+}
+
+bool MotionGate::shouldRunInference(const cv::Mat& frame, bool objects_active, const cv::Mat& mask) {
+    auto start = std::chrono::steady_clock::now();
+    frames_checked_++;
+
+    // INTER_AREA averages whole blocks, which also suppresses sensor noise
+    cv::resize(frame, small_color_, cv::Size(GATE_WIDTH, GATE_HEIGHT), 0, 0, cv::INTER_AREA);
+    if (small_color_.channels() == 3) {
+        cv::cvtColor(small_color_, small_gray_, cv::COLOR_BGR2GRAY);
+    } else {
+        small_color_.copyTo(small_gray_);
+    }
+    if (!mask.empty()) {
+        cv::bitwise_and(small_gray_, mask, small_gray_);
+    }
+
+    if (background_.empty()) {
+        small_gray_.convertTo(background_, CV_32F);
+        small_gray_.copyTo(background_gray_);
+        last_inference_ = start;
+        total_gate_ms_ = total_gate_ms_ + std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        return true;
+    }
+
+    const int pixel_count = GATE_WIDTH * GATE_HEIGHT;
+    int changed = countChangedPixels(small_gray_.ptr<uchar>(), background_gray_.ptr<uchar>(), pixel_count,
+                                     pixel_threshold_);
+    double fraction = static_cast<double>(changed) / pixel_count;
+    last_changed_fraction_ = fraction;
+
+    cv::accumulateWeighted(small_gray_, background_, BACKGROUND_LEARNING_RATE);
+    background_.convertTo(background_gray_, CV_8U);
+
+    bool motion = fraction >= changed_fraction_;
+    bool refresh_due = start - last_inference_ >= refresh_interval_;
+    bool run = motion || objects_active || refresh_due;
+    if (run) {
+        if (!motion && !objects_active) {
+            forced_refreshes_++;
+        }
+        last_inference_ = start;
+    } else {
+        frames_skipped_++;
+    }
+
+    total_gate_ms_ = total_gate_ms_ + std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    return run;
+}
+
+void MotionGate::reset() {
+    background_.release();
+    background_gray_.release();
+}
+
+MotionGate::Stats MotionGate::getStats() const {
+    Stats stats;
+    stats.frames_checked = frames_checked_.load();
+    stats.frames_skipped = frames_skipped_.load();
+    stats.forced_refreshes = forced_refreshes_.load();
+    if (stats.frames_checked > 0) {
+        stats.skip_rate = static_cast<double>(stats.frames_skipped) / stats.frames_checked;
+        stats.avg_gate_ms = total_gate_ms_.load() / stats.frames_checked;
+    }
+    stats.last_changed_fraction = last_changed_fraction_.load();
+    return stats;
+}
+
+void MotionGate::logStats(double avg_inference_ms) const {
+    Stats stats = getStats();
+    double saved_seconds = stats.frames_skipped * std::max(0.0, avg_inference_ms - stats.avg_gate_ms) / 1000.0;
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1)
+         << "Motion gate: " << stats.frames_skipped << "/" << stats.frames_checked << " frames skipped ("
+         << stats.skip_rate * 100.0 << "%), " << stats.forced_refreshes << " forced refreshes, ~"
+         << saved_seconds << " s of inference saved (gate " << std::setprecision(2) << stats.avg_gate_ms
+         << " ms/frame vs " << std::setprecision(1) << avg_inference_ms << " ms inference)";
+    logger_->info(line.str());
+}
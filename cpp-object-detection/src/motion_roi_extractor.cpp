@@ -0,0 +1,182 @@
+#include "motion_roi_extractor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+MotionRoiExtractor::MotionRoiExtractor(std::shared_ptr<Logger> logger, int max_regions, int min_region_size,
+                                       double max_coverage)
+    : logger_(logger), max_regions_(std::max(1, max_regions)), min_region_size_(std::max(1, min_region_size)),
+      max_coverage_(max_coverage), frames_checked_(0), region_frames_(0), total_regions_(0),
+      total_coverage_(0.0) {
+    subtractor_ = cv::createBackgroundSubtractorMOG2(MOG2_HISTORY, MOG2_VAR_THRESHOLD, true);
+    kernel_ = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
+}
+
+std::vector<cv::Rect> MotionRoiExtractor::extract(const cv::Mat& frame, const std::vector<cv::Rect>& track_boxes,
+                                                  const cv::Mat& mask) {
+    frames_checked_++;
+    if (frame.empty()) {
+        return {};
+    }
+
+    // Model the background at low resolution; blobs only need to be located, not detected
+    const double scale = static_cast<double>(ANALYSIS_WIDTH) / frame.cols;
+    const cv::Size analysis_size = analysisSize(frame.size());
+    const int analysis_height = analysis_size.height;
+    cv::resize(frame, small_, analysis_size, 0, 0, cv::INTER_AREA);
+    subtractor_->apply(small_, foreground_);
+
+    cv::threshold(foreground_, foreground_, FOREGROUND_THRESHOLD, 255, cv::THRESH_BINARY);
+    if (!mask.empty()) {
+        cv::bitwise_and(foreground_, mask, foreground_);
+    }
+    cv::morphologyEx(foreground_, foreground_, cv::MORPH_OPEN, kernel_);
+    cv::dilate(foreground_, foreground_, kernel_, cv::Point(-1, -1), 2);
+
+    contours_.clear();
+    cv::findContours(foreground_, contours_, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+
+    const cv::Rect bounds(0, 0, frame.cols, frame.rows);
+    const double min_blob_area = MIN_BLOB_FRACTION * ANALYSIS_WIDTH * analysis_height;
+    std::vector<cv::Rect> boxes;
+    for (const auto& contour : contours_) {
+        cv::Rect blob = cv::boundingRect(contour);
+        if (blob.area() < min_blob_area) {
+            continue;
+        }
+        // Back to frame coordinates, with some context around the moving part
+        double pad_x = blob.width * REGION_PADDING;
+        double pad_y = blob.height * REGION_PADDING;
+        cv::Rect box(static_cast<int>((blob.x - pad_x) / scale), static_cast<int>((blob.y - pad_y) / scale),
+                     static_cast<int>(std::ceil((blob.width + 2 * pad_x) / scale)),
+                     static_cast<int>(std::ceil((blob.height + 2 * pad_y) / scale)));
+        box &= bounds;
+        if (!box.empty()) {
+            boxes.push_back(box);
+        }
+    }
+    // Tracked objects that stopped moving are part of the background by now
+    for (const auto& track_box : track_boxes) {
+        cv::Rect box = padRegion(track_box, REGION_PADDING, bounds);
+        if (!box.empty()) {
+            boxes.push_back(box);
+        }
+    }
+    if (boxes.empty()) {
+        return {};
+    }
+
+    // Nearby blobs (e.g. the legs and torso of one person) become one region
+    auto regions = mergeRegions(std::move(boxes), min_region_size_ / 8, max_regions_);
+    for (auto& region : regions) {
+        region = expandRegion(region, min_region_size_, frame.size());
+    }
+    regions = mergeRegions(std::move(regions), 0, max_regions_);  // Growing may have made them overlap
+
+    double area = 0.0;
+    for (const auto& region : regions) {
+        area += region.area();
+    }
+    double coverage = area / bounds.area();
+    if (coverage > max_coverage_) {
+        return {};  // Lighting change or a scene-wide event: one full-frame pass is cheaper
+    }
+
+    region_frames_++;
+    total_regions_ += regions.size();
+    total_coverage_ = total_coverage_ + coverage;
+    return regions;
+}
+
+std::vector<cv::Rect> MotionRoiExtractor::mergeRegions(std::vector<cv::Rect> boxes, int gap, size_t max_regions) {
+    max_regions = std::max<size_t>(1, max_regions);
+    while (boxes.size() > 1) {
+        size_t merge_a = 0;
+        size_t merge_b = 0;
+        bool found = false;
+
+        // First anything within gap of another box
+        for (size_t i = 0; i < boxes.size() && !found; ++i) {
+            cv::Rect grown(boxes[i].x - gap, boxes[i].y - gap, boxes[i].width + 2 * gap, boxes[i].height + 2 * gap);
+            for (size_t j = i + 1; j < boxes.size(); ++j) {
+                if ((grown & boxes[j]).area() > 0) {
+                    merge_a = i;
+                    merge_b = j;
+                    found = true;
+                    break;
+                }
+            }
+        }
+
+        // Then, while over budget, the pair whose union wastes the least area
+        if (!found && boxes.size() > max_regions) {
+            double smallest = std::numeric_limits<double>::max();
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                for (size_t j = i + 1; j < boxes.size(); ++j) {
+                    double area = static_cast<double>((boxes[i] | boxes[j]).area());
+                    if (area < smallest) {
+                        smallest = area;
+                        merge_a = i;
+                        merge_b = j;
+                    }
+                }
+            }
+            found = true;
+        }
+
+        if (!found) {
+            break;
+        }
+        boxes[merge_a] |= boxes[merge_b];
+        boxes.erase(boxes.begin() + static_cast<std::ptrdiff_t>(merge_b));
+    }
+    return boxes;
+}
+
+cv::Size MotionRoiExtractor::analysisSize(const cv::Size& frame_size) {
+    const double scale = static_cast<double>(ANALYSIS_WIDTH) / std::max(1, frame_size.width);
+    return cv::Size(ANALYSIS_WIDTH, std::max(1, static_cast<int>(std::lround(frame_size.height * scale))));
+}
+
+cv::Rect MotionRoiExtractor::padRegion(const cv::Rect& box, double padding, const cv::Rect& bounds) {
+    double pad_x = box.width * padding;
+    double pad_y = box.height * padding;
+    cv::Rect padded(static_cast<int>(std::floor(box.x - pad_x)), static_cast<int>(std::floor(box.y - pad_y)),
+                    static_cast<int>(std::ceil(box.width + 2 * pad_x)),
+                    static_cast<int>(std::ceil(box.height + 2 * pad_y)));
+    return padded & bounds;
+}
+
+cv::Rect MotionRoiExtractor::expandRegion(const cv::Rect& box, int min_size, const cv::Size& frame_size) {
+    int width = std::min(std::max(box.width, min_size), frame_size.width);
+    int height = std::min(std::max(box.height, min_size), frame_size.height);
+    int center_x = box.x + box.width / 2;
+    int center_y = box.y + box.height / 2;
+    int x = std::max(0, std::min(center_x - width / 2, frame_size.width - width));
+    int y = std::max(0, std::min(center_y - height / 2, frame_size.height - height));
+    return cv::Rect(x, y, width, height);
+}
+
+MotionRoiExtractor::Stats MotionRoiExtractor::getStats() const {
+    Stats stats;
+    stats.frames_checked = frames_checked_.load();
+    stats.region_frames = region_frames_.load();
+    if (stats.region_frames > 0) {
+        stats.avg_regions = static_cast<double>(total_regions_.load()) / stats.region_frames;
+        stats.avg_coverage = total_coverage_.load() / stats.region_frames;
+    }
+    return stats;
+}
+
+void MotionRoiExtractor::logStats() const {
+    Stats stats = getStats();
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1)
+         << "Motion ROI: " << stats.region_frames << "/" << stats.frames_checked
+         << " frames inferred as crops (avg " << stats.avg_regions << " regions covering "
+         << stats.avg_coverage * 100.0 << "% of the frame), "
+         << (stats.frames_checked - stats.region_frames) << " full-frame passes";
+    logger_->info(line.str());
+}
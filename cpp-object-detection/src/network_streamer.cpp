@@ -1,4 +1,5 @@
 #include "network_streamer.hpp"
+#include "class_registry.hpp"
 #include "drawing_utils.hpp"
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -113,6 +114,16 @@ void NetworkStreamer::stop() {
     logger_->info("Network streamer stopped");
 }
 
+void NetworkStreamer::updateEncodedFrame(const std::vector<uchar>& jpeg) {
+    if (jpeg.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(frame_mutex_);
+    current_jpeg_ = jpeg;
+    current_frame_.release();
+}
+
 void NetworkStreamer::updateFrame(const cv::Mat& frame, const std::vector<Detection>& detections) {
     if (frame.empty()) {
         return;
@@ -124,6 +135,7 @@ void NetworkStreamer::updateFrame(const cv::Mat& frame, const std::vector<Detect
     // Update current frame (thread-safe)
     std::lock_guard<std::mutex> lock(frame_mutex_);
     current_frame_ = annotated_frame.clone();
+    current_jpeg_.clear();
 }
 
 void NetworkStreamer::updateFrameWithStats(const cv::Mat& frame, 
@@ -162,6 +174,7 @@ void NetworkStreamer::updateFrameWithStats(const cv::Mat& frame,
     // Update current frame (thread-safe)
     std::lock_guard<std::mutex> lock(frame_mutex_);
     current_frame_ = annotated_frame.clone();
+    current_jpeg_.clear();
 }
 
 std::string NetworkStreamer::getStreamingUrl() const {
@@ -218,23 +231,31 @@ void NetworkStreamer::handleClient(int client_socket) {
     // Stream frames
     while (running_) {
         cv::Mat frame_to_send;
+        std::vector<uchar> jpeg_data;
         
         // Get current frame (thread-safe)
         {
             std::lock_guard<std::mutex> lock(frame_mutex_);
-            if (current_frame_.empty()) {
+            if (current_frame_.empty() && current_jpeg_.empty()) {
                 // No frame available yet, wait a bit
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
                 continue;
             }
-            frame_to_send = current_frame_.clone();
+            if (!current_jpeg_.empty()) {
+                // Passthrough frame is already a camera JPEG
+                jpeg_data = current_jpeg_;
+            } else {
+                frame_to_send = current_frame_.clone();
+            }
         }
 
         // Encode frame as JPEG
-        std::vector<uchar> jpeg_data = encodeFrameAsJpeg(frame_to_send);
         if (jpeg_data.empty()) {
-            logger_->warning("Failed to encode frame as JPEG");
-            continue;
+            jpeg_data = encodeFrameAsJpeg(frame_to_send);
+            if (jpeg_data.empty()) {
+                logger_->warning("Failed to encode frame as JPEG");
+                continue;
+            }
         }
 
         // Send frame
@@ -291,13 +312,13 @@ cv::Mat NetworkStreamer::drawBoundingBoxes(const cv::Mat& frame,
     
     // Draw bounding boxes for each detection
     for (const auto& detection : detections) {
-        cv::Scalar color = getColorForClass(detection.class_name);
+        const cv::Scalar& color = ClassRegistry::color(detection.class_id);
         
         // Draw rectangle around the object
         cv::rectangle(annotated_frame, detection.bbox, color, 2);
         
         // Draw label with class name and confidence
-        std::string label = detection.class_name + " (" + 
+        std::string label = ClassRegistry::name(detection.class_id) + " (" + 
                            std::to_string(static_cast<int>(detection.confidence * 100)) + "%)";
         
         // Add stationary indicator if object is stationary
@@ -465,23 +486,6 @@ void NetworkStreamer::drawDebugInfo(cv::Mat& frame,
     }
 }
 
-cv::Scalar NetworkStreamer::getColorForClass(const std::string& class_name) const {
-    // Define colors for different object types (BGR format)
-    if (class_name == "person") {
-        return cv::Scalar(0, 255, 0);  // Green
-    } else if (class_name == "cat") {
-        return cv::Scalar(0, 0, 255);  // Red
-    } else if (class_name == "dog") {
-        return cv::Scalar(255, 0, 0);  // Blue
-    } else if (class_name == "car" || class_name == "truck" || class_name == "bus") {
-        return cv::Scalar(0, 255, 255);  // Yellow
-    } else if (class_name == "motorcycle" || class_name == "bicycle") {
-        return cv::Scalar(255, 0, 255);  // Magenta
-    } else {
-        return cv::Scalar(255, 255, 255);  // White for unknown
-    }
-}
-
 std::string NetworkStreamer::getLocalIpAddress() const {
     struct ifaddrs *ifaddr, *ifa;
     std::string ip_address = "127.0.0.1";  // Default to localhost
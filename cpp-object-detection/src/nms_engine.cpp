@@ -0,0 +1,167 @@
+#include "nms_engine.hpp"
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+
+namespace {
+
+/**
+ * For boxes [0, count) compute how far each one's overlap with the reference
+ * box exceeds the threshold: inter * (1 + t) - t * (area_ref + area_j).
+ * A positive value means IoU > t; this avoids a division per box.
+ */
+void overlapExcess(float ref_x1, float ref_y1, float ref_x2, float ref_y2, float ref_area,
+                   const float* x1, const float* y1, const float* x2, const float* y2,
+                   const float* area, int count, float iou_threshold, float* excess) {
+    const float inter_weight = 1.0f + iou_threshold;
+    int j = 0;
+#if CV_SIMD128
+    const cv::v_float32x4 rx1 = cv::v_setall_f32(ref_x1);
+    const cv::v_float32x4 ry1 = cv::v_setall_f32(ref_y1);
+    const cv::v_float32x4 rx2 = cv::v_setall_f32(ref_x2);
+    const cv::v_float32x4 ry2 = cv::v_setall_f32(ref_y2);
+    const cv::v_float32x4 rarea = cv::v_setall_f32(ref_area);
+    const cv::v_float32x4 zero = cv::v_setzero_f32();
+    const cv::v_float32x4 weight = cv::v_setall_f32(inter_weight);
+    const cv::v_float32x4 threshold = cv::v_setall_f32(iou_threshold);
+    for (; j <= count - 4; j += 4) {
+        cv::v_float32x4 w = cv::v_max(zero, cv::v_min(rx2, cv::v_load(x2 + j)) - cv::v_max(rx1, cv::v_load(x1 + j)));
+        cv::v_float32x4 h = cv::v_max(zero, cv::v_min(ry2, cv::v_load(y2 + j)) - cv::v_max(ry1, cv::v_load(y1 + j)));
+        cv::v_float32x4 inter = w * h;
+        cv::v_store(excess + j, inter * weight - threshold * (rarea + cv::v_load(area + j)));
+    }
+#endif
+    for (; j < count; ++j) {
+        float w = std::max(0.0f, std::min(ref_x2, x2[j]) - std::max(ref_x1, x1[j]));
+        float h = std::max(0.0f, std::min(ref_y2, y2[j]) - std::max(ref_y1, y1[j]));
+        float inter = w * h;
+        excess[j] = inter * inter_weight - iou_threshold * (ref_area + area[j]);
+    }
+}
+
+}  // namespace
+
+void NmsEngine::clear() {
+    x1_.clear();
+    y1_.clear();
+    x2_.clear();
+    y2_.clear();
+    scores_.clear();
+    class_ids_.clear();
+    keep_.clear();
+}
+
+void NmsEngine::reserve(size_t count) {
+    for (auto* values : {&x1_, &y1_, &x2_, &y2_, &scores_, &bx1_, &by1_, &bx2_, &by2_, &barea_, &overlap_}) {
+        values->reserve(count);
+    }
+    class_ids_.reserve(count);
+    order_.reserve(count);
+    suppressed_.reserve(count);
+    keep_.reserve(count);
+}
+
+int NmsEngine::add(const cv::Rect& box, float score, int class_id) {
+    x1_.push_back(static_cast<float>(box.x));
+    y1_.push_back(static_cast<float>(box.y));
+    x2_.push_back(static_cast<float>(box.x + box.width));
+    y2_.push_back(static_cast<float>(box.y + box.height));
+    scores_.push_back(score);
+    class_ids_.push_back(class_id);
+    return static_cast<int>(scores_.size()) - 1;
+}
+
+const std::vector<int>& NmsEngine::suppress(float iou_threshold) {
+    keep_.clear();
+    const size_t count = scores_.size();
+    if (count == 0) {
+        return keep_;
+    }
+
+    // Bucket by class, highest score first within each bucket
+    order_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        order_[i] = static_cast<int>(i);
+    }
+    std::sort(order_.begin(), order_.end(), [this](int a, int b) {
+        if (class_ids_[a] != class_ids_[b]) {
+            return class_ids_[a] < class_ids_[b];
+        }
+        if (scores_[a] != scores_[b]) {
+            return scores_[a] > scores_[b];
+        }
+        return a < b;
+    });
+
+    size_t begin = 0;
+    while (begin < count) {
+        size_t end = begin + 1;
+        while (end < count && class_ids_[order_[end]] == class_ids_[order_[begin]]) {
+            ++end;
+        }
+        suppressBucket(begin, end, iou_threshold);
+        begin = end;
+    }
+
+    // Report survivors across all classes by descending score
+    std::sort(keep_.begin(), keep_.end(), [this](int a, int b) {
+        if (scores_[a] != scores_[b]) {
+            return scores_[a] > scores_[b];
+        }
+        return a < b;
+    });
+    return keep_;
+}
+
+void NmsEngine::suppressBucket(size_t begin, size_t end, float iou_threshold) {
+    const int bucket_size = static_cast<int>(end - begin);
+    if (bucket_size == 1) {
+        keep_.push_back(order_[begin]);
+        return;
+    }
+
+    // Gather the bucket into contiguous arrays in score order
+    bx1_.resize(bucket_size);
+    by1_.resize(bucket_size);
+    bx2_.resize(bucket_size);
+    by2_.resize(bucket_size);
+    barea_.resize(bucket_size);
+    overlap_.resize(bucket_size);
+    suppressed_.assign(bucket_size, 0);
+    for (int k = 0; k < bucket_size; ++k) {
+        int index = order_[begin + k];
+        bx1_[k] = x1_[index];
+        by1_[k] = y1_[index];
+        bx2_[k] = x2_[index];
+        by2_[k] = y2_[index];
+        barea_[k] = std::max(0.0f, bx2_[k] - bx1_[k]) * std::max(0.0f, by2_[k] - by1_[k]);
+    }
+
+    for (int i = 0; i < bucket_size; ++i) {
+        if (suppressed_[i]) {
+            continue;
+        }
+        keep_.push_back(order_[begin + i]);
+
+        int rest = bucket_size - i - 1;
+        if (rest == 0) {
+            break;
+        }
+        overlapExcess(bx1_[i], by1_[i], bx2_[i], by2_[i], barea_[i],
+                      bx1_.data() + i + 1, by1_.data() + i + 1,
+                      bx2_.data() + i + 1, by2_.data() + i + 1,
+                      barea_.data() + i + 1, rest, iou_threshold, overlap_.data());
+        for (int j = 0; j < rest; ++j) {
+            if (overlap_[j] > 0.0f) {
+                suppressed_[i + 1 + j] = 1;
+            }
+        }
+    }
+}
+
+float NmsEngine::iou(const cv::Rect& a, const cv::Rect& b) {
+    float w = static_cast<float>(std::max(0, std::min(a.x + a.width, b.x + b.width) - std::max(a.x, b.x)));
+    float h = static_cast<float>(std::max(0, std::min(a.y + a.height, b.y + b.height) - std::max(a.y, b.y)));
+    float inter = w * h;
+    float union_area = static_cast<float>(a.width) * a.height + static_cast<float>(b.width) * b.height - inter;
+    return union_area > 0.0f ? inter / union_area : 0.0f;
+}
@@ -1,4 +1,5 @@
 #include "notification_manager.hpp"
+#include "class_registry.hpp"
 #include <curl/curl.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -324,7 +325,7 @@ std::string NotificationManager::createNotificationJSON(const NotificationData&
     for (size_t i = 0; i < data.all_detections.size(); i++) {
         const auto& det = data.all_detections[i];
         ss << "{";
-        ss << "\"class\":\"" << det.class_name << "\",";
+        ss << "\"class\":\"" << ClassRegistry::name(det.class_id) << "\",";
         ss << "\"confidence\":" << std::fixed << std::setprecision(2) << det.confidence << ",";
         ss << "\"bbox\":{";
         ss << "\"x\":" << det.bbox.x << ",";
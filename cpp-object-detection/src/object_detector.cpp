@@ -1,19 +1,27 @@
 #include "object_detector.hpp"
 #include "google_sheets_client.hpp"
 #include "yolo_v5_model.hpp"
+#include "yolo_v8_model.hpp"
+#include "yolo_utils.hpp"
+#include "nms_engine.hpp"
+#include "track_assignment.hpp"
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <sstream>
+#include <atomic>
 #include <ctime>
-#include <set>
 
 // Maximum distance (in pixels) an object can move between frames to be considered the same object
 // This assumes objects don't teleport across large portions of the frame
 // For 720p video at typical frame rates (5 fps), this allows for reasonable movement
 constexpr float MAX_MOVEMENT_DISTANCE = 100.0f;
 
+// Share of the matching cost from box overlap (1 - IoU); the rest is center distance over MAX_MOVEMENT_DISTANCE
+constexpr double ASSIGNMENT_IOU_WEIGHT = 0.5;
+
 ObjectDetector::ObjectDetector(const std::string& model_path,
                               const std::string& config_path,
                               const std::string& classes_path,
@@ -25,51 +33,67 @@ ObjectDetector::ObjectDetector(const std::string& model_path,
     : model_path_(model_path), config_path_(config_path), classes_path_(classes_path),
       confidence_threshold_(confidence_threshold), detection_scale_factor_(detection_scale_factor),
       enable_gpu_(enable_gpu), logger_(logger), model_type_(model_type),
-      initialized_(false), total_objects_detected_(0) {
+      inference_replicas_(1), target_class_set_(ClassRegistry::makeSet(getTargetClasses())),
+      trackers_(MAX_TRACKED_OBJECTS), next_track_id_(1), current_snapshot_(0), snapshot_stale_(true),
+      match_grid_(MAX_MOVEMENT_DISTANCE), initialized_(false), total_objects_detected_(0) {
+    reserveTrackingBuffers();
+}
+
+ObjectDetector::ObjectDetector(std::shared_ptr<ObjectDetector> model_owner, std::shared_ptr<Logger> logger)
+    : model_path_(model_owner->model_path_), config_path_(model_owner->config_path_),
+      classes_path_(model_owner->classes_path_), confidence_threshold_(model_owner->confidence_threshold_),
+      detection_scale_factor_(model_owner->detection_scale_factor_), enable_gpu_(model_owner->enable_gpu_),
+      logger_(logger), model_type_(model_owner->model_type_), model_owner_(model_owner),
+      inference_replicas_(0), target_class_set_(ClassRegistry::makeSet(getTargetClasses())),
+      trackers_(MAX_TRACKED_OBJECTS), next_track_id_(1), current_snapshot_(0), snapshot_stale_(true),
+      match_grid_(MAX_MOVEMENT_DISTANCE), initialized_(false), total_objects_detected_(0) {
+    reserveTrackingBuffers();
 }
 
 ObjectDetector::~ObjectDetector() = default;
 
+void ObjectDetector::reserveTrackingBuffers() {
+    cleanup_order_.reserve(MAX_TRACKED_OBJECTS);
+}
+
 bool ObjectDetector::initialize() {
     if (initialized_) {
         return true;
     }
 
+    if (model_owner_) {
+        // Tracking only; the owner loads and serves the model
+        initialized_ = model_owner_->initialize();
+        return initialized_;
+    }
+
     logger_->info("Initializing object detector with model abstraction...");
     
     // Create the detection model using the factory
     try {
-        detection_model_ = DetectionModelFactory::createModel(model_type_, logger_);
+        detection_model_ = createInitializedModel(model_type_);
         if (!detection_model_) {
-            logger_->error("Failed to create detection model");
             return false;
         }
         
-        // Set GPU preference before initialization
-        // Cast to YoloV5 models to access setEnableGpu
-        if (model_type_ == DetectionModelFactory::ModelType::YOLO_V5_SMALL) {
-            auto* yolo_model = dynamic_cast<YoloV5SmallModel*>(detection_model_.get());
-            if (yolo_model) {
-                yolo_model->setEnableGpu(enable_gpu_);
-            }
-        } else if (model_type_ == DetectionModelFactory::ModelType::YOLO_V5_LARGE) {
-            auto* yolo_model = dynamic_cast<YoloV5LargeModel*>(detection_model_.get());
-            if (yolo_model) {
-                yolo_model->setEnableGpu(enable_gpu_);
+        // Create additional replicas so parallel workers don't share one network
+        model_replicas_.clear();
+        for (int i = 1; i < inference_replicas_; ++i) {
+            auto replica = createInitializedModel(model_type_);
+            if (!replica) {
+                logger_->error("Failed to create model replica " + std::to_string(i + 1) + 
+                              " of " + std::to_string(inference_replicas_));
+                return false;
             }
+            model_replicas_.push_back(std::move(replica));
         }
-        
-        // Initialize the model
-        if (!detection_model_->initialize(model_path_, config_path_, classes_path_, confidence_threshold_, detection_scale_factor_)) {
-            logger_->error("Failed to initialize detection model");
-            return false;
-        }
-        
-        // Warm up the model for accurate performance measurements
-        detection_model_->warmUp();
+        rebuildReplicaPool();
         
         initialized_ = true;
         logger_->info("Object detector initialized successfully with " + detection_model_->getModelName());
+        if (inference_replicas_ > 1) {
+            logger_->info("Model replicas for concurrent inference: " + std::to_string(inference_replicas_));
+        }
         
         // Log model performance characteristics
         auto metrics = detection_model_->getMetrics();
@@ -85,16 +109,135 @@ bool ObjectDetector::initialize() {
     }
 }
 
+std::unique_ptr<IDetectionModel> ObjectDetector::createInitializedModel(DetectionModelFactory::ModelType type) {
+    auto model = DetectionModelFactory::createModel(type, logger_, backend_options_);
+    if (!model) {
+        logger_->error("Failed to create detection model");
+        return nullptr;
+    }
+    
+    // Set GPU preference before initialization
+    // Cast to the YOLO models to access setEnableGpu
+    if (auto* small_model = dynamic_cast<YoloV5SmallModel*>(model.get())) {
+        small_model->setEnableGpu(enable_gpu_);
+    } else if (auto* large_model = dynamic_cast<YoloV5LargeModel*>(model.get())) {
+        large_model->setEnableGpu(enable_gpu_);
+    } else if (auto* v8_model = dynamic_cast<YoloV8Model*>(model.get())) {
+        v8_model->setEnableGpu(enable_gpu_);
+    }
+    
+    // Only target classes are kept downstream, so the model need not score the rest
+    model->setTargetClasses(getTargetClasses());
+    
+    // Initialize the model
+    if (!model->initialize(model_path_, config_path_, classes_path_, confidence_threshold_, detection_scale_factor_)) {
+        logger_->error("Failed to initialize detection model");
+        return nullptr;
+    }
+    
+    // Warm up the model for accurate performance measurements
+    model->warmUp();
+    
+    return model;
+}
+
+void ObjectDetector::rebuildReplicaPool() {
+    std::vector<IDetectionModel*> replicas;
+    replicas.push_back(detection_model_.get());
+    for (const auto& replica : model_replicas_) {
+        replicas.push_back(replica.get());
+    }
+    replica_pool_ = std::make_unique<ModelReplicaPool>(replicas);
+}
+
 std::vector<Detection> ObjectDetector::detectObjects(const cv::Mat& frame) {
-    if (!initialized_ || !detection_model_ || frame.empty()) {
+    if (model_owner_) {
+        return model_owner_->detectObjects(frame);
+    }
+    if (!initialized_ || !replica_pool_ || frame.empty()) {
+        return {};
+    }
+
+    auto replica = replica_pool_->acquire();
+    if (!replica) {
         return {};
     }
+    return replica->detect(frame);
+}
+
+std::vector<std::vector<Detection>> ObjectDetector::detectObjectsBatch(const std::vector<cv::Mat>& frames) {
+    if (model_owner_) {
+        return model_owner_->detectObjectsBatch(frames);
+    }
+    std::vector<std::vector<Detection>> results(frames.size());
+    if (!initialized_ || !replica_pool_ || frames.empty()) {
+        return results;
+    }
+
+    auto replica = replica_pool_->acquire();
+    if (!replica) {
+        return results;
+    }
+    return replica->detectBatch(frames);
+}
+
+std::vector<Detection> ObjectDetector::detectObjectsInRegions(const cv::Mat& frame,
+                                                              const std::vector<cv::Rect>& regions,
+                                                              const std::vector<cv::Point>& origins) {
+    if (model_owner_) {
+        return model_owner_->detectObjectsInRegions(frame, regions, origins);
+    }
+    std::vector<Detection> detections;
+    if (!initialized_ || !replica_pool_ || frame.empty()) {
+        return detections;
+    }
 
-    return detection_model_->detect(frame);
+    auto replica = replica_pool_->acquire();
+    if (!replica) {
+        return detections;
+    }
+    const cv::Rect bounds(0, 0, frame.cols, frame.rows);
+    for (size_t i = 0; i < regions.size(); ++i) {
+        cv::Rect crop = regions[i] & bounds;
+        if (crop.empty()) {
+            continue;
+        }
+        cv::Point origin = i < origins.size() ? origins[i] + (crop.tl() - regions[i].tl()) : crop.tl();
+        // The crop is a view into the frame; the model letterboxes it without a copy
+        for (auto& detection : replica->detectRegion(frame(crop))) {
+            detection.bbox.x += origin.x;
+            detection.bbox.y += origin.y;
+            detections.push_back(std::move(detection));
+        }
+    }
+    return detections;
+}
+
+void ObjectDetector::setInferenceReplicas(int replicas) {
+    if (initialized_) {
+        logger_->warning("Inference replica count must be set before initialization - ignoring");
+        return;
+    }
+    inference_replicas_ = std::max(1, replicas);
+}
+
+void ObjectDetector::setBackendOptions(const DetectionModelFactory::BackendOptions& options) {
+    if (initialized_) {
+        logger_->warning("Inference backend must be set before initialization - ignoring");
+        return;
+    }
+    backend_options_ = options;
+}
+
+size_t ObjectDetector::getInferenceReplicaCount() const {
+    if (model_owner_) {
+        return model_owner_->getInferenceReplicaCount();
+    }
+    return replica_pool_ ? replica_pool_->size() : 0;
 }
 
 void ObjectDetector::processFrame(const cv::Mat& frame) {
-    if (!initialized_ || !detection_model_) {
+    if (!initialized_ || (!detection_model_ && !model_owner_)) {
         return;
     }
 
@@ -104,13 +247,13 @@ void ObjectDetector::processFrame(const cv::Mat& frame) {
     // Filter for target classes only
     std::vector<Detection> target_detections;
     for (const auto& detection : detections) {
-        if (isTargetClass(detection.class_name)) {
+        if (isTargetClass(detection)) {
             target_detections.push_back(detection);
         }
     }
 
     // Update tracking and log events
-    updateTrackedObjects(target_detections);
+    updateTrackedObjects(target_detections, std::chrono::steady_clock::now());
     logObjectEvents(target_detections);
 }
 
@@ -134,39 +277,67 @@ std::vector<std::string> ObjectDetector::getTargetClasses() {
 }
 
 bool ObjectDetector::isTargetClass(const std::string& class_name) const {
-    auto target_classes = getTargetClasses();
-    return std::find(target_classes.begin(), target_classes.end(), class_name) != target_classes.end();
+    return ClassRegistry::contains(target_class_set_, ClassRegistry::find(class_name));
 }
 
 ModelMetrics ObjectDetector::getModelMetrics() const {
+    if (model_owner_) {
+        return model_owner_->getModelMetrics();
+    }
     if (!detection_model_) {
         return {"Unknown", "Unknown", 0.0, 0, 0, "Model not initialized"};
     }
     return detection_model_->getMetrics();
 }
 
+cv::Size ObjectDetector::getDetectionResolution(const cv::Size& frame_size) const {
+    if (model_owner_) {
+        return model_owner_->getDetectionResolution(frame_size);
+    }
+    int longest_side = std::max(frame_size.width, frame_size.height);
+    int input_size = detection_model_ ? detection_model_->getInputSize() : 0;
+    if (input_size <= 0 || longest_side <= 0) {
+        return frame_size;
+    }
+    int target = YoloUtils::computeInputSize(frame_size, detection_scale_factor_, input_size);
+    if (target >= longest_side) {
+        return frame_size;
+    }
+    double scale = static_cast<double>(target) / longest_side;
+    return cv::Size(std::max(1, static_cast<int>(std::lround(frame_size.width * scale))),
+                    std::max(1, static_cast<int>(std::lround(frame_size.height * scale))));
+}
+
 bool ObjectDetector::switchModel(DetectionModelFactory::ModelType new_model_type) {
+    if (model_owner_) {
+        logger_->error("Cannot switch a shared model from a tracking-only detector - switch it on the owner");
+        return false;
+    }
+
     logger_->info("Switching to model type: " + DetectionModelFactory::modelTypeToString(new_model_type));
     
     try {
-        // Create new model
-        auto new_model = DetectionModelFactory::createModel(new_model_type, logger_);
+        // Create and warm up the new model and its replicas before replacing anything
+        auto new_model = createInitializedModel(new_model_type);
         if (!new_model) {
             logger_->error("Failed to create new detection model");
             return false;
         }
         
-        // Initialize new model
-        if (!new_model->initialize(model_path_, config_path_, classes_path_, confidence_threshold_, detection_scale_factor_)) {
-            logger_->error("Failed to initialize new detection model");
-            return false;
+        std::vector<std::unique_ptr<IDetectionModel>> new_replicas;
+        for (int i = 1; i < inference_replicas_; ++i) {
+            auto replica = createInitializedModel(new_model_type);
+            if (!replica) {
+                logger_->error("Failed to create new model replica");
+                return false;
+            }
+            new_replicas.push_back(std::move(replica));
         }
         
-        // Warm up new model
-        new_model->warmUp();
-        
-        // Replace old model
+        // Replace old model (callers must not have inference in flight during a switch)
         detection_model_ = std::move(new_model);
+        model_replicas_ = std::move(new_replicas);
+        rebuildReplicaPool();
         model_type_ = new_model_type;
         
         logger_->info("Successfully switched to " + detection_model_->getModelName());
@@ -188,162 +359,348 @@ std::vector<ModelMetrics> ObjectDetector::getAvailableModels() {
     return DetectionModelFactory::getAvailableModels();
 }
 
-void ObjectDetector::updateTrackedObjects(const std::vector<Detection>& detections) {
+void ObjectDetector::updateTrackedObjects(const std::vector<Detection>& detections,
+                                          std::chrono::steady_clock::time_point timestamp) {
     // Object tracking and permanence model:
     // - Track objects frame-to-frame based on (x, y) position and object type
     // - Determine if detected object is "new" (entered frame) or "moved" (was near this position before)
     // - Use MAX_MOVEMENT_DISTANCE threshold to decide: if distance > threshold, consider it a new object
+    // - Each track takes at most one detection, chosen for the lowest total distance/overlap cost
     // - Maintain position history for better movement analysis
+    // - Match against where each object's Kalman state expects it now, so a low
+    //   inference rate does not turn a walking person into a "new" object
+    snapshot_stale_ = true;
     
     // Mark all current objects as not seen this frame
-    for (auto& tracked : tracked_objects_) {
-        tracked.was_present_last_frame = false;
-        tracked.frames_since_detection++;
+    for (int slot : trackers_.slots()) {
+        trackers_.set(slot, TrackerTable::PRESENT, false);
+        trackers_.frames_since_detection[slot]++;
+        trackers_.boxes[slot] = predictBox(slot, timestamp);
     }
     
-    // Update with current detections
-    for (const auto& detection : detections) {
-        bool found_existing = false;
-        
+    // Candidate pairs come from a grid as coarse as the matching gate, so each
+    // detection is only compared with the tracks around it. A track is indexed
+    // at its predicted position and at its last detection, for sudden jumps
+    // that have left the filter behind.
+    match_grid_.clear();
+    for (int slot : trackers_.slots()) {
+        const cv::Rect& box = trackers_.boxes[slot];
+        match_grid_.insert(cv::Point2f(box.x + box.width / 2.0f, box.y + box.height / 2.0f), slot);
+        match_grid_.insert(trackers_.centers[slot], slot);
+    }
+    
+    // Debug messages are only built when they will be written, so matching allocates nothing
+    const bool debug = logger_->isDebugEnabled();
+    detection_centers_.clear();
+    detection_class_ids_.clear();
+    match_edges_.clear();
+    for (size_t d = 0; d < detections.size(); ++d) {
+        const auto& detection = detections[d];
         cv::Point2f detection_center(
             detection.bbox.x + detection.bbox.width / 2.0f,
             detection.bbox.y + detection.bbox.height / 2.0f
         );
+        detection_centers_.push_back(detection_center);
+        const int class_id = detection.class_id;
+        detection_class_ids_.push_back(class_id);
         
-        logger_->debug("Processing detection: " + detection.class_name + 
-                      " at (" + std::to_string(detection_center.x) + ", " + 
-                      std::to_string(detection_center.y) + ")");
-        
-        // Try to match with existing tracked objects of the same type
-        float min_distance = MAX_MOVEMENT_DISTANCE;
-        ObjectTracker* best_match = nullptr;
-        
-        for (auto& tracked : tracked_objects_) {
-            if (tracked.object_type == detection.class_name) {
-                // Calculate distance from previously tracked position
-                float distance = cv::norm(tracked.center - detection_center);
-                
-                logger_->debug("  Distance to existing " + tracked.object_type + 
-                              " at (" + std::to_string(tracked.center.x) + ", " + 
-                              std::to_string(tracked.center.y) + "): " + 
-                              std::to_string(distance) + " pixels");
-                
-                // Find the closest matching object within threshold
-                if (distance < min_distance) {
-                    min_distance = distance;
-                    best_match = &tracked;
-                }
-            }
+        if (debug) {
+            logger_->debug("Processing detection: " + ClassRegistry::name(class_id) +
+                          " at (" + std::to_string(detection_center.x) + ", " +
+                          std::to_string(detection_center.y) + ")");
         }
         
-        // Check if we found a match within threshold
-        if (best_match != nullptr) {
-            logger_->debug("  Matched to existing " + best_match->object_type + 
-                          " (distance: " + std::to_string(min_distance) + " pixels)");
-            
-            // Store previous position before updating (for movement logging)
-            best_match->previous_center = best_match->center;
-            
-            // Add current position to history before updating
-            best_match->position_history.push_back(best_match->center);
-            if (best_match->position_history.size() > ObjectTracker::MAX_POSITION_HISTORY) {
-                best_match->position_history.pop_front();
+        match_grid_.query(detection_center, match_candidates_);
+        for (int slot : match_candidates_) {
+            if (trackers_.class_ids[slot] != class_id) {
+                continue;
             }
+            const cv::Rect& box = trackers_.boxes[slot];
+            cv::Point2f expected(box.x + box.width / 2.0f, box.y + box.height / 2.0f);
+            float distance = std::min(static_cast<float>(cv::norm(expected - detection_center)),
+                                      static_cast<float>(cv::norm(trackers_.centers[slot] - detection_center)));
             
-            // Update position
-            best_match->center = detection_center;
-            best_match->was_present_last_frame = true;
-            best_match->frames_since_detection = 0;
-            best_match->is_new = false;  // Not new, it's been tracked
-            found_existing = true;
-            
-            // Update stationary status based on movement
-            updateStationaryStatus(*best_match);
+            if (debug) {
+                logger_->debug("  Distance to existing " + ClassRegistry::name(class_id) +
+                              " expected at (" + std::to_string(expected.x) + ", " +
+                              std::to_string(expected.y) + "): " +
+                              std::to_string(distance) + " pixels");
+            }
             
-            // Log movement pattern if we have enough history
-            if (best_match->position_history.size() >= 3) {
-                float total_path_length = 0.0f;
-                for (size_t i = 1; i < best_match->position_history.size(); ++i) {
-                    total_path_length += cv::norm(best_match->position_history[i] - 
-                                                  best_match->position_history[i-1]);
-                }
-                logger_->debug("  Movement pattern: " + std::to_string(best_match->position_history.size()) + 
-                              " positions tracked, total path length: " + 
-                              std::to_string(total_path_length) + " pixels");
+            if (distance < MAX_MOVEMENT_DISTANCE) {
+                // Overlap tells neighbours apart when centers alone are ambiguous
+                double overlap = NmsEngine::iou(box, detection.bbox);
+                double cost = ASSIGNMENT_IOU_WEIGHT * (1.0 - overlap) +
+                              (1.0 - ASSIGNMENT_IOU_WEIGHT) * distance / MAX_MOVEMENT_DISTANCE;
+                match_edges_.push_back({static_cast<int>(d), slot, cost});
             }
         }
+    }
+    
+    // Each track takes at most one detection: the set of pairs with the lowest total cost
+    TrackAssignment::solve(static_cast<int>(detections.size()), static_cast<int>(trackers_.capacity()),
+                           match_edges_, match_workspace_, match_assignment_);
+    
+    // Update matched tracks first; the cleanup below may hand their slots to new tracks
+    for (size_t d = 0; d < detections.size(); ++d) {
+        const int slot = match_assignment_[d];
+        if (slot < 0) {
+            continue;
+        }
+        const auto& detection = detections[d];
+        const cv::Point2f& detection_center = detection_centers_[d];
+        if (debug) {
+            const std::string& class_name = ClassRegistry::name(detection.class_id);
+            logger_->debug("  Matched " + class_name + " at (" + std::to_string(detection_center.x) +
+                          ", " + std::to_string(detection_center.y) + ") to existing " + class_name +
+                          " (" + std::to_string(cv::norm(trackers_.centers[slot] - detection_center)) +
+                          " pixels from its last position)");
+        }
+        
+        // Store previous position before updating (for movement logging)
+        trackers_.previous_centers[slot] = trackers_.centers[slot];
         
-        // Add new object if not found within threshold distance
-        // This means either:
-        // 1. First time seeing this object type, OR
-        // 2. Object of this type is too far from any previously tracked position (likely a different object)
-        if (!found_existing) {
-            // Check if we're at the tracking limit
-            if (tracked_objects_.size() >= MAX_TRACKED_OBJECTS) {
-                logger_->warning("Maximum tracked objects limit (" + std::to_string(MAX_TRACKED_OBJECTS) + 
-                                ") reached. Cleaning up oldest objects.");
-                cleanupOldTrackedObjects();
+        // Add current position to history before updating; a full history drops its oldest point
+        PositionHistory& history = trackers_.histories[slot];
+        history.push_back(trackers_.centers[slot]);
+        
+        // Update position
+        trackers_.centers[slot] = detection_center;
+        trackers_.boxes[slot] = detection.bbox;
+        trackers_.confidences[slot] = static_cast<float>(detection.confidence);
+        trackers_.motions[slot].update(detection.bbox, std::chrono::duration<double>(
+            timestamp - trackers_.last_detection_times[slot]).count());
+        trackers_.last_detection_times[slot] = timestamp;
+        trackers_.set(slot, TrackerTable::PRESENT, true);
+        trackers_.frames_since_detection[slot] = 0;
+        trackers_.set(slot, TrackerTable::NEW, false);  // Not new, it's been tracked
+        
+        // Update stationary status based on movement
+        updateStationaryStatus(slot);
+        
+        // Log movement pattern if we have enough history
+        if (debug && history.size() >= 3) {
+            float total_path_length = 0.0f;
+            for (size_t i = 1; i < history.size(); ++i) {
+                total_path_length += cv::norm(history[i] - history[i-1]);
             }
+            logger_->debug("  Movement pattern: " + std::to_string(history.size()) + 
+                          " positions tracked, total path length: " + 
+                          std::to_string(total_path_length) + " pixels");
+        }
+    }
+    
+    // Add new object if not matched to a track
+    // This means either:
+    // 1. First time seeing this object type, OR
+    // 2. Object of this type is too far from any previously tracked position (likely a different object), OR
+    // 3. Every nearby track of this type is taken by a detection that fits it better
+    for (size_t d = 0; d < detections.size(); ++d) {
+        if (match_assignment_[d] >= 0) {
+            continue;
+        }
+        const auto& detection = detections[d];
+        const cv::Point2f& detection_center = detection_centers_[d];
+        
+        // Check if we're at the tracking limit
+        if (trackers_.full()) {
+            logger_->warning("Maximum tracked objects limit (" + std::to_string(MAX_TRACKED_OBJECTS) + 
+                            ") reached. Cleaning up oldest objects.");
+            cleanupOldTrackedObjects();
+        }
 
-            logger_->debug("  Creating new tracker for " + detection.class_name + 
-                          " (no existing object within " + std::to_string(MAX_MOVEMENT_DISTANCE) + 
+        if (debug) {
+            logger_->debug("  Creating new tracker for " + ClassRegistry::name(detection.class_id) + " at (" +
+                          std::to_string(detection_center.x) + ", " + std::to_string(detection_center.y) +
+                          ") (no free existing object within " + std::to_string(MAX_MOVEMENT_DISTANCE) +
                           " pixel threshold)");
-            
-            ObjectTracker new_tracker;
-            new_tracker.object_type = detection.class_name;
-            new_tracker.center = detection_center;
-            new_tracker.previous_center = detection_center;  // Same as current for new object
-            new_tracker.position_history.push_back(detection_center);  // Initialize history
-            new_tracker.was_present_last_frame = true;
-            new_tracker.frames_since_detection = 0;
-            new_tracker.is_new = true;  // Mark as newly entered
-            new_tracker.is_stationary = false;  // New objects are not yet stationary
-            new_tracker.stationary_since = std::chrono::steady_clock::now();
-            tracked_objects_.push_back(new_tracker);
-            
-            // Update statistics with bounded growth protection
-            total_objects_detected_++;
-            object_type_counts_[detection.class_name]++;
-            
-            // Limit object type counts map size
-            if (object_type_counts_.size() > MAX_OBJECT_TYPE_ENTRIES) {
-                limitObjectTypeCounts();
-            }
+        }
+        
+        const int slot = trackers_.acquire();
+        if (slot < 0) {
+            continue;  // The cleanup above always frees slots; this only guards the table
+        }
+        trackers_.ids[slot] = next_track_id_++;
+        trackers_.class_ids[slot] = detection_class_ids_[d];
+        trackers_.centers[slot] = detection_center;
+        trackers_.boxes[slot] = detection.bbox;
+        trackers_.confidences[slot] = static_cast<float>(detection.confidence);
+        trackers_.motions[slot] = BoxKalmanFilter(detection.bbox);
+        trackers_.last_detection_times[slot] = timestamp;
+        trackers_.previous_centers[slot] = detection_center;  // Same as current for new object
+        trackers_.histories[slot].push_back(detection_center);  // Initialize history
+        trackers_.set(slot, TrackerTable::PRESENT, true);
+        trackers_.set(slot, TrackerTable::NEW, true);  // Mark as newly entered; not yet stationary
+        trackers_.stationary_since[slot] = std::chrono::steady_clock::now();
+        
+        // Update statistics with bounded growth protection
+        // (statistics are read from the main thread while tracking runs on the tracking thread)
+        std::lock_guard<std::mutex> stats_lock(stats_mutex_);
+        total_objects_detected_++;
+        object_type_counts_[ClassRegistry::name(detection.class_id)]++;
+        
+        // Limit object type counts map size
+        if (object_type_counts_.size() > MAX_OBJECT_TYPE_ENTRIES) {
+            limitObjectTypeCounts();
         }
     }
     
     // Remove objects that haven't been seen for too long
+    removeExitedTrackers(timestamp, cv::Size());
+}
+
+cv::Rect ObjectDetector::predictBox(int slot, std::chrono::steady_clock::time_point timestamp) const {
+    double elapsed = std::chrono::duration<double>(timestamp - trackers_.last_detection_times[slot]).count();
+    return trackers_.motions[slot].predict(std::min(elapsed, MAX_PREDICTION_SECONDS));
+}
+
+void ObjectDetector::predictTracks(std::chrono::steady_clock::time_point timestamp, const cv::Size& frame_size,
+                                   std::vector<Detection>& present) {
+    snapshot_stale_ = true;
+    for (int slot : trackers_.slots()) {
+        trackers_.boxes[slot] = predictBox(slot, timestamp);
+    }
+    removeExitedTrackers(timestamp, frame_size);
+    
+    // Same objects the last inferred frame showed, at their predicted positions
+    presentTrackDetections(present);
+}
+
+void ObjectDetector::presentTrackBoxes(std::vector<cv::Rect>& boxes) const {
+    boxes.assign(trackers_.capacity(), cv::Rect());
+    for (int slot : trackers_.slots()) {
+        if (trackers_.has(slot, TrackerTable::PRESENT)) {
+            boxes[slot] = trackers_.boxes[slot];
+        }
+    }
+}
+
+void ObjectDetector::moveTracks(const std::vector<cv::Rect>& boxes, std::chrono::steady_clock::time_point timestamp,
+                                std::vector<Detection>& present) {
+    snapshot_stale_ = true;
+    for (int slot : trackers_.slots()) {
+        const bool measured = static_cast<size_t>(slot) < boxes.size() && !boxes[slot].empty();
+        trackers_.boxes[slot] = measured ? boxes[slot] : predictBox(slot, timestamp);
+    }
+    presentTrackDetections(present);
+}
+
+void ObjectDetector::presentTrackDetections(std::vector<Detection>& present) const {
+    present.clear();
+    auto now = std::chrono::steady_clock::now();
+    for (int slot : trackers_.slots()) {
+        if (!trackers_.has(slot, TrackerTable::PRESENT)) {
+            continue;
+        }
+        Detection detection;
+        detection.class_id = trackers_.class_ids[slot];
+        detection.confidence = trackers_.confidences[slot];
+        detection.bbox = trackers_.boxes[slot];
+        detection.is_stationary = trackers_.has(slot, TrackerTable::STATIONARY);
+        if (detection.is_stationary) {
+            detection.stationary_duration_seconds = static_cast<int>(
+                std::chrono::duration_cast<std::chrono::seconds>(now - trackers_.stationary_since[slot]).count());
+        }
+        present.push_back(std::move(detection));
+    }
+}
+
+const std::vector<ObjectDetector::ObjectTracker>& ObjectDetector::getTrackedObjects() const {
+    if (snapshot_stale_) {
+        refreshSnapshot();
+    }
+    return *snapshots_[current_snapshot_];
+}
+
+std::shared_ptr<const std::vector<ObjectDetector::ObjectTracker>> ObjectDetector::shareTrackedObjects() const {
+    if (snapshot_stale_) {
+        refreshSnapshot();
+    }
+    return snapshots_[current_snapshot_];
+}
+
+void ObjectDetector::refreshSnapshot() const {
+    // Refill a buffer only this detector holds; one still shared with another thread
+    // is left alone, and a new buffer is added only when all of them are
+    size_t buffer = 0;
+    while (buffer < snapshots_.size() && snapshots_[buffer].use_count() > 1) {
+        buffer++;
+    }
+    if (buffer == snapshots_.size()) {
+        snapshots_.push_back(std::make_shared<std::vector<ObjectTracker>>());
+        snapshots_.back()->reserve(MAX_TRACKED_OBJECTS);
+    } else {
+        // Pairs with the release of the last other holder, whose reads are now done
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    current_snapshot_ = buffer;
+    
+    // Records hold no strings and are overwritten in place, so refilling a buffer allocates nothing
+    std::vector<ObjectTracker>& snapshot = *snapshots_[buffer];
+    snapshot.resize(trackers_.size());
+    for (size_t i = 0; i < trackers_.size(); ++i) {
+        const int slot = trackers_.slots()[i];
+        ObjectTracker& tracker = snapshot[i];
+        tracker.id = trackers_.ids[slot];
+        tracker.class_id = trackers_.class_ids[slot];
+        tracker.center = trackers_.centers[slot];
+        tracker.bbox = trackers_.boxes[slot];
+        tracker.confidence = trackers_.confidences[slot];
+        tracker.motion = trackers_.motions[slot];
+        tracker.last_detection_time = trackers_.last_detection_times[slot];
+        tracker.previous_center = trackers_.previous_centers[slot];
+        tracker.position_history = trackers_.histories[slot];
+        tracker.was_present_last_frame = trackers_.has(slot, TrackerTable::PRESENT);
+        tracker.frames_since_detection = trackers_.frames_since_detection[slot];
+        tracker.is_new = trackers_.has(slot, TrackerTable::NEW);
+        tracker.is_stationary = trackers_.has(slot, TrackerTable::STATIONARY);
+        tracker.stationary_since = trackers_.stationary_since[slot];
+    }
+    snapshot_stale_ = false;
+}
+
+void ObjectDetector::removeExitedTrackers(std::chrono::steady_clock::time_point timestamp, const cv::Size& frame_size) {
+    const cv::Rect frame_bounds(0, 0, frame_size.width, frame_size.height);
+    auto hasExited = [&](int slot) {
+        // At a low inference rate MAX_MISSED_FRAMES takes too long, so a few misses
+        // spanning MAX_MISSING_SECONDS are enough; frames the motion gate skipped are
+        // not misses, so a parked car survives a long static stretch
+        const int frames_since_detection = trackers_.frames_since_detection[slot];
+        double missing_seconds = std::chrono::duration<double>(timestamp - trackers_.last_detection_times[slot]).count();
+        if (frames_since_detection > MAX_MISSED_FRAMES ||
+            (frames_since_detection >= MIN_MISSES_FOR_TIMEOUT && missing_seconds > MAX_MISSING_SECONDS)) {
+            return true;
+        }
+        // An undetected object whose predicted box lies entirely outside the frame has walked out
+        return frames_since_detection > 0 && !frame_bounds.empty() && (trackers_.boxes[slot] & frame_bounds).empty();
+    };
+    
     // First, log the objects that will be removed and record exit events
     // Track which object types we've already recorded exits for to avoid duplicates
-    std::set<std::string> exit_recorded;
-    for (const auto& tracker : tracked_objects_) {
-        if (tracker.frames_since_detection > 30) {
-            logger_->debug("Removing " + tracker.object_type + 
+    ClassRegistry::ClassSet exit_recorded;
+    size_t removed_count = 0;
+    for (int slot : trackers_.slots()) {
+        if (hasExited(slot)) {
+            removed_count++;
+            const std::string& object_type = ClassRegistry::name(trackers_.class_ids[slot]);
+            logger_->debug("Removing " + object_type + 
                           " tracker (not seen for " + 
-                          std::to_string(tracker.frames_since_detection) + " frames)");
+                          std::to_string(trackers_.frames_since_detection[slot]) + " frames)");
             // Record exit event for timeline (once per object type)
-            if (exit_recorded.find(tracker.object_type) == exit_recorded.end()) {
-                logger_->recordDetection(tracker.object_type, false, true);
-                exit_recorded.insert(tracker.object_type);
+            const int class_id = trackers_.class_ids[slot];
+            if (!ClassRegistry::contains(exit_recorded, class_id)) {
+                if (class_id >= 0) {
+                    exit_recorded.set(static_cast<size_t>(class_id));
+                }
+                logger_->recordDetection(object_type, false, true);
             }
         }
     }
     
-    // Count how many will be removed before erasing
-    auto removed_count = std::count_if(tracked_objects_.begin(), tracked_objects_.end(),
-                                       [](const ObjectTracker& tracker) {
-                                           return tracker.frames_since_detection > 30; // 30 frames threshold
-                                       });
-    
-    // Now remove them
-    tracked_objects_.erase(
-        std::remove_if(tracked_objects_.begin(), tracked_objects_.end(),
-                      [](const ObjectTracker& tracker) {
-                          return tracker.frames_since_detection > 30; // 30 frames threshold
-                      }),
-        tracked_objects_.end());
-    
+    // Now give their slots back
     if (removed_count > 0) {
+        snapshot_stale_ = true;
+        trackers_.releaseIf(hasExited);
         logger_->debug("Removed " + std::to_string(removed_count) + " stale tracker(s)");
     }
 }
@@ -371,32 +728,38 @@ void ObjectDetector::logObjectEvents(const std::vector<Detection>& current_detec
     };
     
     // Log enter/movement events based on tracking
-    for (const auto& tracked : tracked_objects_) {
+    for (int slot : trackers_.slots()) {
+        const int class_id = trackers_.class_ids[slot];
+        const std::string& object_type = ClassRegistry::name(class_id);
+        const cv::Point2f& center = trackers_.centers[slot];
+        const cv::Point2f& previous_center = trackers_.previous_centers[slot];
+        const PositionHistory& position_history = trackers_.histories[slot];
+        
         // Find the current detection for this tracked object
         auto detection_it = std::find_if(current_detections.begin(), current_detections.end(),
-                                        [&tracked](const Detection& det) {
-                                            return det.class_name == tracked.object_type;
+                                        [class_id](const Detection& det) {
+                                            return det.class_id == class_id;
                                         });
         
         // Check if object is currently present in this frame
         bool currently_present = (detection_it != current_detections.end());
         
-        if (currently_present && tracked.frames_since_detection == 0) {
+        if (currently_present && trackers_.frames_since_detection[slot] == 0) {
             // Object is present in this frame and was just updated
             
-            if (tracked.is_new) {
+            if (trackers_.has(slot, TrackerTable::NEW)) {
                 // New object entered the frame
-                logger_->debug("New object entered: " + tracked.object_type + 
-                             " at (" + std::to_string(tracked.center.x) + ", " + 
-                             std::to_string(tracked.center.y) + ")");
+                logger_->debug("New object entered: " + object_type + 
+                             " at (" + std::to_string(center.x) + ", " + 
+                             std::to_string(center.y) + ")");
                 logger_->logObjectEntry(
-                    tracked.object_type,
-                    tracked.center.x,
-                    tracked.center.y,
+                    object_type,
+                    center.x,
+                    center.y,
                     detection_it->confidence
                 );
                 // Record for hourly summary (new objects are typically moving/dynamic)
-                logger_->recordDetection(tracked.object_type, false);
+                logger_->recordDetection(object_type, false);
                 
                 // Log to Google Sheets if enabled
                 if (google_sheets_client_ && google_sheets_client_->isEnabled()) {
@@ -404,81 +767,81 @@ void ObjectDetector::logObjectEvents(const std::vector<Detection>& current_detec
                         std::to_string(static_cast<int>(detection_it->confidence * 100)) + "%";
                     google_sheets_client_->logDetection(
                         getTimestamp(),
-                        tracked.object_type,
+                        object_type,
                         "entry",
-                        tracked.center.x,
-                        tracked.center.y,
+                        center.x,
+                        center.y,
                         0.0f,
                         description
                     );
                 }
             } else {
                 // Object was seen before - check if it moved
-                float distance = cv::norm(tracked.center - tracked.previous_center);
+                float distance = cv::norm(center - previous_center);
                 
-                logger_->debug("Checking movement for " + tracked.object_type + 
+                logger_->debug("Checking movement for " + object_type + 
                              ": distance = " + std::to_string(distance) + " pixels, " +
-                             "from (" + std::to_string(tracked.previous_center.x) + ", " + 
-                             std::to_string(tracked.previous_center.y) + ") to (" +
-                             std::to_string(tracked.center.x) + ", " + 
-                             std::to_string(tracked.center.y) + ")");
+                             "from (" + std::to_string(previous_center.x) + ", " + 
+                             std::to_string(previous_center.y) + ") to (" +
+                             std::to_string(center.x) + ", " + 
+                             std::to_string(center.y) + ")");
                 
                 // Only log movement if the object actually moved a meaningful distance
                 // (avoid logging tiny movements due to detection jitter)
                 if (distance > 5.0f) {  // 5 pixel threshold to avoid logging noise
                     // Calculate movement characteristics from position history
                     std::string movement_info = "";
-                    if (tracked.position_history.size() >= 2) {
+                    if (position_history.size() >= 2) {
                         // Calculate average movement over recent history
                         float total_distance = 0.0f;
-                        for (size_t i = 1; i < tracked.position_history.size(); ++i) {
-                            total_distance += cv::norm(tracked.position_history[i] - 
-                                                      tracked.position_history[i-1]);
+                        for (size_t i = 1; i < position_history.size(); ++i) {
+                            total_distance += cv::norm(position_history[i] - 
+                                                      position_history[i-1]);
                         }
-                        float avg_distance = total_distance / (tracked.position_history.size() - 1);
+                        float avg_distance = total_distance / (position_history.size() - 1);
                         
                         // Determine movement direction from history
-                        cv::Point2f overall_direction = tracked.center - tracked.position_history.front();
+                        cv::Point2f overall_direction = center - position_history.front();
                         float overall_distance = cv::norm(overall_direction);
                         
                         movement_info = " [avg step: " + std::to_string(avg_distance) + 
                                       " px, overall path: " + std::to_string(overall_distance) + " px]";
                         
-                        logger_->debug("Movement analysis for " + tracked.object_type + 
-                                     ": " + std::to_string(tracked.position_history.size()) + 
+                        logger_->debug("Movement analysis for " + object_type + 
+                                     ": " + std::to_string(position_history.size()) + 
                                      " positions in history, average step size: " + 
                                      std::to_string(avg_distance) + " pixels, " +
                                      "overall displacement: " + std::to_string(overall_distance) + 
                                      " pixels");
                     }
                     
-                    logger_->debug("Logging movement: " + tracked.object_type + 
+                    logger_->debug("Logging movement: " + object_type + 
                                  " moved " + std::to_string(distance) + " pixels" + movement_info);
                     
                     logger_->logObjectMovement(
-                        tracked.object_type,
-                        tracked.previous_center.x,
-                        tracked.previous_center.y,
-                        tracked.center.x,
-                        tracked.center.y,
+                        object_type,
+                        previous_center.x,
+                        previous_center.y,
+                        center.x,
+                        center.y,
                         detection_it->confidence
                     );
                     // Record as dynamic object
-                    logger_->recordDetection(tracked.object_type, false);
+                    logger_->recordDetection(object_type, false);
                     
                     // Log to Google Sheets if enabled
                     if (google_sheets_client_ && google_sheets_client_->isEnabled()) {
                         std::string description = "From (" + 
-                            std::to_string(static_cast<int>(tracked.previous_center.x)) + "," + 
-                            std::to_string(static_cast<int>(tracked.previous_center.y)) + ") to (" +
-                            std::to_string(static_cast<int>(tracked.center.x)) + "," + 
-                            std::to_string(static_cast<int>(tracked.center.y)) + ")" + movement_info;
+                            std::to_string(static_cast<int>(previous_center.x)) + "," + 
+                            std::to_string(static_cast<int>(previous_center.y)) + ") to (" +
+                            std::to_string(static_cast<int>(center.x)) + "," + 
+                            std::to_string(static_cast<int>(center.y)) + ")" + movement_info;
                         google_sheets_client_->logDetection(
                             getTimestamp(),
-                            tracked.object_type,
+                            object_type,
                             "movement",
-                            tracked.center.x,
-                            tracked.center.y,
+                            center.x,
+                            center.y,
                             distance,
                             description
                         );
@@ -496,12 +859,17 @@ void ObjectDetector::logObjectEvents(const std::vector<Detection>& current_detec
 }
 
 int ObjectDetector::getTotalObjectsDetected() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
     return total_objects_detected_;
 }
 
 std::vector<std::pair<std::string, int>> ObjectDetector::getTopDetectedObjects(int top_n) const {
     // Convert map to vector for sorting
-    std::vector<std::pair<std::string, int>> sorted_objects(object_type_counts_.begin(), object_type_counts_.end());
+    std::vector<std::pair<std::string, int>> sorted_objects;
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        sorted_objects.assign(object_type_counts_.begin(), object_type_counts_.end());
+    }
     
     // Sort by count in descending order
     std::sort(sorted_objects.begin(), sorted_objects.end(),
@@ -520,25 +888,29 @@ std::vector<std::pair<std::string, int>> ObjectDetector::getTopDetectedObjects(i
 void ObjectDetector::cleanupOldTrackedObjects() {
     // Remove objects that haven't been seen recently, prioritizing older ones
     // This is called when we hit the MAX_TRACKED_OBJECTS limit
-    if (tracked_objects_.empty()) {
+    if (trackers_.empty()) {
         return;
     }
     
     // Sort by frames_since_detection (descending) to remove oldest first
-    std::sort(tracked_objects_.begin(), tracked_objects_.end(),
-              [](const ObjectTracker& a, const ObjectTracker& b) {
-                  return a.frames_since_detection > b.frames_since_detection;
+    cleanup_order_.assign(trackers_.slots().begin(), trackers_.slots().end());
+    std::sort(cleanup_order_.begin(), cleanup_order_.end(),
+              [this](int a, int b) {
+                  return trackers_.frames_since_detection[a] > trackers_.frames_since_detection[b];
               });
     
     // Remove the oldest 20% or at least 10 objects
-    size_t to_remove = std::max(static_cast<size_t>(10), tracked_objects_.size() / 5);
-    to_remove = std::min(to_remove, tracked_objects_.size());
+    size_t to_remove = std::max(static_cast<size_t>(10), trackers_.size() / 5);
+    to_remove = std::min(to_remove, trackers_.size());
     
     logger_->debug("Cleaning up " + std::to_string(to_remove) + " old tracked objects");
-    tracked_objects_.erase(tracked_objects_.begin(), tracked_objects_.begin() + to_remove);
+    for (size_t i = 0; i < to_remove; ++i) {
+        trackers_.release(cleanup_order_[i]);
+    }
 }
 
 void ObjectDetector::limitObjectTypeCounts() {
+    // Caller holds stats_mutex_
     // Keep only the most frequently detected object types
     // This prevents the map from growing unbounded with rare detections
     if (object_type_counts_.size() <= MAX_OBJECT_TYPE_ENTRIES) {
@@ -562,47 +934,54 @@ void ObjectDetector::limitObjectTypeCounts() {
     logger_->debug("Limited object type counts to top " + std::to_string(MAX_OBJECT_TYPE_ENTRIES) + " types");
 }
 
-void ObjectDetector::updateStationaryStatus(ObjectTracker& tracker) {
+void ObjectDetector::updateStationaryStatus(int slot) {
+    const PositionHistory& position_history = trackers_.histories[slot];
+    const std::string& object_type = ClassRegistry::name(trackers_.class_ids[slot]);
+    auto& stationary_since = trackers_.stationary_since[slot];
+    const bool was_stationary = trackers_.has(slot, TrackerTable::STATIONARY);
+    
     // Need at least 3 positions to determine if stationary
-    if (tracker.position_history.size() < 3) {
-        tracker.is_stationary = false;
-        tracker.stationary_since = std::chrono::steady_clock::now();
+    if (position_history.size() < 3) {
+        trackers_.set(slot, TrackerTable::STATIONARY, false);
+        stationary_since = std::chrono::steady_clock::now();
         return;
     }
     
     // Calculate average movement over recent history
     float total_distance = 0.0f;
-    for (size_t i = 1; i < tracker.position_history.size(); ++i) {
-        total_distance += cv::norm(tracker.position_history[i] - tracker.position_history[i-1]);
+    for (size_t i = 1; i < position_history.size(); ++i) {
+        total_distance += cv::norm(position_history[i] - position_history[i-1]);
     }
-    float avg_distance = total_distance / (tracker.position_history.size() - 1);
+    float avg_distance = total_distance / (position_history.size() - 1);
     
     // Check if object is stationary (avg movement below threshold)
     bool currently_stationary = avg_distance <= ObjectTracker::STATIONARY_MOVEMENT_THRESHOLD;
     
-    if (currently_stationary && !tracker.is_stationary) {
+    if (currently_stationary && !was_stationary) {
         // Object just became stationary
-        tracker.is_stationary = true;
-        tracker.stationary_since = std::chrono::steady_clock::now();
-        logger_->debug("Object " + tracker.object_type + " is now stationary (avg movement: " + 
+        trackers_.set(slot, TrackerTable::STATIONARY, true);
+        stationary_since = std::chrono::steady_clock::now();
+        logger_->debug("Object " + object_type + " is now stationary (avg movement: " + 
                       std::to_string(avg_distance) + " pixels)");
         // Record stationary detection for summary
-        logger_->recordDetection(tracker.object_type, true);
-    } else if (!currently_stationary && tracker.is_stationary) {
+        logger_->recordDetection(object_type, true);
+    } else if (!currently_stationary && was_stationary) {
         // Object started moving again
-        tracker.is_stationary = false;
-        logger_->debug("Object " + tracker.object_type + " started moving again (avg movement: " + 
+        trackers_.set(slot, TrackerTable::STATIONARY, false);
+        logger_->debug("Object " + object_type + " started moving again (avg movement: " + 
                       std::to_string(avg_distance) + " pixels)");
     } else if (currently_stationary) {
         // Still stationary
         auto now = std::chrono::steady_clock::now();
-        auto stationary_duration = std::chrono::duration_cast<std::chrono::seconds>(now - tracker.stationary_since);
-        logger_->debug("Object " + tracker.object_type + " stationary for " + 
-                      std::to_string(stationary_duration.count()) + " seconds (avg movement: " + 
-                      std::to_string(avg_distance) + " pixels)");
+        auto stationary_duration = std::chrono::duration_cast<std::chrono::seconds>(now - stationary_since);
+        if (logger_->isDebugEnabled()) {  // Runs every frame for every parked object
+            logger_->debug("Object " + object_type + " stationary for " +
+                          std::to_string(stationary_duration.count()) + " seconds (avg movement: " +
+                          std::to_string(avg_distance) + " pixels)");
+        }
         // Record periodic stationary detection (every 10 seconds) for timeline continuity
         if (stationary_duration.count() % 10 == 0 && stationary_duration.count() > 0) {
-            logger_->recordDetection(tracker.object_type, true);
+            logger_->recordDetection(object_type, true);
         }
     }
 }
@@ -621,6 +1000,8 @@ bool ObjectDetector::isStationaryPastTimeout(const ObjectTracker& tracker, int s
 void ObjectDetector::enrichDetectionsWithStationaryStatus(std::vector<Detection>& detections) {
     // For each detection, find the corresponding tracked object and set its stationary status
     for (auto& detection : detections) {
+        const int class_id = detection.class_id;
+
         // Calculate detection center
         cv::Point2f detection_center(
             detection.bbox.x + detection.bbox.width / 2.0f,
@@ -629,27 +1010,27 @@ void ObjectDetector::enrichDetectionsWithStationaryStatus(std::vector<Detection>
         
         // Find the matching tracked object (same logic as in updateTrackedObjects)
         float min_distance = MAX_MOVEMENT_DISTANCE;
-        const ObjectTracker* best_match = nullptr;
+        int best_match = -1;
         
-        for (const auto& tracked : tracked_objects_) {
-            if (tracked.object_type == detection.class_name && tracked.was_present_last_frame) {
-                float distance = cv::norm(tracked.center - detection_center);
+        for (int slot : trackers_.slots()) {
+            if (trackers_.class_ids[slot] == class_id && trackers_.has(slot, TrackerTable::PRESENT)) {
+                float distance = cv::norm(trackers_.centers[slot] - detection_center);
                 
                 if (distance < min_distance) {
                     min_distance = distance;
-                    best_match = &tracked;
+                    best_match = slot;
                 }
             }
         }
         
         // If we found a match, copy the stationary status and calculate duration
-        if (best_match != nullptr) {
-            detection.is_stationary = best_match->is_stationary;
+        if (best_match >= 0) {
+            detection.is_stationary = trackers_.has(best_match, TrackerTable::STATIONARY);
             
-            if (best_match->is_stationary) {
+            if (detection.is_stationary) {
                 // Calculate how long the object has been stationary
                 auto now = std::chrono::steady_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - best_match->stationary_since);
+                auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - trackers_.stationary_since[best_match]);
                 detection.stationary_duration_seconds = static_cast<int>(duration.count());
             } else {
                 detection.stationary_duration_seconds = 0;
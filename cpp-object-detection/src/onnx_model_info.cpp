@@ -0,0 +1,259 @@
+#include "onnx_model_info.hpp"
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace OnnxModelInfo {
+
+namespace {
+
+// Protobuf wire types
+constexpr uint32_t WIRE_VARINT = 0;
+constexpr uint32_t WIRE_FIXED64 = 1;
+constexpr uint32_t WIRE_LENGTH_DELIMITED = 2;
+constexpr uint32_t WIRE_FIXED32 = 5;
+
+// Field numbers from onnx.proto
+constexpr uint32_t MODEL_GRAPH = 7;
+constexpr uint32_t GRAPH_NODE = 1;
+constexpr uint32_t GRAPH_INITIALIZER = 5;
+constexpr uint32_t GRAPH_INPUT = 11;
+constexpr uint32_t NODE_OP_TYPE = 4;
+constexpr uint32_t TENSOR_DATA_TYPE = 2;
+constexpr uint32_t VALUE_INFO_TYPE = 2;
+constexpr uint32_t TYPE_TENSOR_TYPE = 1;
+constexpr uint32_t TENSOR_TYPE_ELEM_TYPE = 1;
+
+/**
+ * One protobuf message; iterates its fields without copying
+ */
+class MessageReader {
+public:
+    MessageReader(const uint8_t* data, size_t size) : pos_(data), end_(data + size), ok_(true) {}
+
+    struct Field {
+        uint32_t number;
+        uint32_t wire_type;
+        uint64_t varint;          // WIRE_VARINT
+        const uint8_t* data;      // WIRE_LENGTH_DELIMITED
+        size_t size;
+    };
+
+    /**
+     * Read the next field; false at the end of the message or on malformed input
+     */
+    bool next(Field& field) {
+        if (!ok_ || pos_ >= end_) {
+            return false;
+        }
+        uint64_t key = 0;
+        if (!readVarint(key)) {
+            return fail();
+        }
+        field.number = static_cast<uint32_t>(key >> 3);
+        field.wire_type = static_cast<uint32_t>(key & 0x7);
+        field.varint = 0;
+        field.data = nullptr;
+        field.size = 0;
+
+        switch (field.wire_type) {
+            case WIRE_VARINT:
+                return readVarint(field.varint) || fail();
+            case WIRE_FIXED64:
+                return skip(8);
+            case WIRE_FIXED32:
+                return skip(4);
+            case WIRE_LENGTH_DELIMITED: {
+                uint64_t length = 0;
+                if (!readVarint(length) || length > static_cast<uint64_t>(end_ - pos_)) {
+                    return fail();
+                }
+                field.data = pos_;
+                field.size = static_cast<size_t>(length);
+                pos_ += length;
+                return true;
+            }
+            default:
+                return fail();  // Groups are not used by ONNX
+        }
+    }
+
+    bool ok() const { return ok_; }
+
+private:
+    const uint8_t* pos_;
+    const uint8_t* end_;
+    bool ok_;
+
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && pos_ < end_; shift += 7) {
+            uint8_t byte = *pos_++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool skip(size_t bytes) {
+        if (bytes > static_cast<size_t>(end_ - pos_)) {
+            return fail();
+        }
+        pos_ += bytes;
+        return true;
+    }
+
+    bool fail() {
+        ok_ = false;
+        return false;
+    }
+};
+
+bool isIntegerOperator(const std::string& op_type) {
+    return op_type.compare(0, 7, "QLinear") == 0 ||
+           op_type == "ConvInteger" || op_type == "MatMulInteger" ||
+           op_type == "DynamicQuantizeLinear";
+}
+
+void inspectNode(const uint8_t* data, size_t size, Summary& summary) {
+    MessageReader reader(data, size);
+    MessageReader::Field field;
+    while (reader.next(field)) {
+        if (field.number == NODE_OP_TYPE && field.wire_type == WIRE_LENGTH_DELIMITED) {
+            std::string op_type(reinterpret_cast<const char*>(field.data), field.size);
+            summary.node_count++;
+            if (op_type == "QuantizeLinear") {
+                summary.quantize_nodes++;
+            } else if (op_type == "DequantizeLinear") {
+                summary.dequantize_nodes++;
+            } else if (isIntegerOperator(op_type)) {
+                summary.integer_op_nodes++;
+            }
+            return;
+        }
+    }
+}
+
+void inspectInitializer(const uint8_t* data, size_t size, Summary& summary) {
+    MessageReader reader(data, size);
+    MessageReader::Field field;
+    while (reader.next(field)) {
+        if (field.number == TENSOR_DATA_TYPE && field.wire_type == WIRE_VARINT) {
+            if (field.varint == ELEM_TYPE_FLOAT) {
+                summary.float_initializers++;
+            } else if (field.varint == ELEM_TYPE_FLOAT16) {
+                summary.float16_initializers++;
+            }
+            return;
+        }
+    }
+}
+
+// ValueInfoProto -> TypeProto -> TypeProto.Tensor -> elem_type
+int inputElemType(const uint8_t* data, size_t size) {
+    const uint32_t path[] = {VALUE_INFO_TYPE, TYPE_TENSOR_TYPE};
+    for (uint32_t number : path) {
+        MessageReader reader(data, size);
+        MessageReader::Field field;
+        bool found = false;
+        while (reader.next(field)) {
+            if (field.number == number && field.wire_type == WIRE_LENGTH_DELIMITED) {
+                data = field.data;
+                size = field.size;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return 0;
+        }
+    }
+    MessageReader reader(data, size);
+    MessageReader::Field field;
+    while (reader.next(field)) {
+        if (field.number == TENSOR_TYPE_ELEM_TYPE && field.wire_type == WIRE_VARINT) {
+            return static_cast<int>(field.varint);
+        }
+    }
+    return 0;
+}
+
+bool inspectGraph(const uint8_t* data, size_t size, Summary& summary) {
+    MessageReader reader(data, size);
+    MessageReader::Field field;
+    bool first_input = true;
+    while (reader.next(field)) {
+        if (field.wire_type != WIRE_LENGTH_DELIMITED) {
+            continue;
+        }
+        if (field.number == GRAPH_NODE) {
+            inspectNode(field.data, field.size, summary);
+        } else if (field.number == GRAPH_INITIALIZER) {
+            inspectInitializer(field.data, field.size, summary);
+        } else if (field.number == GRAPH_INPUT && first_input) {
+            // YOLO exports have a single image input and list it first
+            summary.input_elem_type = inputElemType(field.data, field.size);
+            first_input = false;
+        }
+    }
+    return reader.ok();
+}
+
+}  // namespace
+
+Summary inspectBuffer(const uint8_t* data, size_t size) {
+    Summary summary;
+    MessageReader reader(data, size);
+    MessageReader::Field field;
+    bool has_graph = false;
+    while (reader.next(field)) {
+        if (field.number == MODEL_GRAPH && field.wire_type == WIRE_LENGTH_DELIMITED) {
+            has_graph = inspectGraph(field.data, field.size, summary);
+        }
+    }
+    summary.valid = reader.ok() && has_graph;
+    if (!summary.valid) {
+        return summary;
+    }
+
+    if (summary.quantize_nodes > 0 || summary.dequantize_nodes > 0) {
+        summary.quant_format = QuantFormat::QDQ;
+    } else if (summary.integer_op_nodes > 0) {
+        summary.quant_format = QuantFormat::QOPERATOR;
+    }
+
+    if (summary.quant_format != QuantFormat::NONE) {
+        summary.precision = Precision::INT8;
+    } else if (summary.input_elem_type == ELEM_TYPE_FLOAT16 ||
+               summary.float16_initializers > summary.float_initializers) {
+        summary.precision = Precision::FP16;
+    }
+    return summary;
+}
+
+Summary inspect(const std::string& model_path) {
+    std::ifstream file(model_path, std::ios::binary);
+    if (!file.is_open()) {
+        return Summary();
+    }
+    std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return inspectBuffer(buffer.data(), buffer.size());
+}
+
+std::string describe(const Summary& summary) {
+    if (!summary.valid) {
+        return "unknown";
+    }
+    switch (summary.precision) {
+        case Precision::FP16:
+            return "FP16";
+        case Precision::INT8:
+            return summary.quant_format == QuantFormat::QDQ ? "INT8 (QDQ)" : "INT8 (QOperator)";
+        default:
+            return "FP32";
+    }
+}
+
+}  // namespace OnnxModelInfo
@@ -0,0 +1,428 @@
+#include "onnx_runtime_model.hpp"
+#include "class_registry.hpp"
+#include "onnx_model_info.hpp"
+#include <fstream>
+#include <algorithm>
+
+// Check if filesystem is available
+#if __has_include(<filesystem>)
+    #include <filesystem>
+    namespace fs = std::filesystem;
+#else
+    // Fallback for older systems
+    #include <sys/stat.h>
+    namespace fs {
+        inline bool exists(const std::string& path) {
+            struct stat buffer;
+            return (stat(path.c_str(), &buffer) == 0);
+        }
+    }
+#endif
+
+namespace {
+
+// One environment per process; sessions (one per model replica) share it
+Ort::Env& sharedEnvironment() {
+    static Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "object_detection");
+    return env;
+}
+
+GraphOptimizationLevel parseOptimizationLevel(const std::string& level) {
+    if (level == "disable") {
+        return GraphOptimizationLevel::ORT_DISABLE_ALL;
+    } else if (level == "basic") {
+        return GraphOptimizationLevel::ORT_ENABLE_BASIC;
+    } else if (level == "extended") {
+        return GraphOptimizationLevel::ORT_ENABLE_EXTENDED;
+    }
+    return GraphOptimizationLevel::ORT_ENABLE_ALL;
+}
+
+}  // namespace
+
+OnnxRuntimeModel::OnnxRuntimeModel(std::shared_ptr<Logger> logger,
+                                   DetectionModelFactory::ModelType model_type,
+                                   const DetectionModelFactory::BackendOptions& options)
+    : logger_(logger), model_type_(model_type), options_(options),
+      anchor_free_(model_type == DetectionModelFactory::ModelType::YOLO_V8_NANO ||
+                   model_type == DetectionModelFactory::ModelType::YOLO_V8_MEDIUM),
+      memory_info_(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)),
+      fixed_input_size_(0), dynamic_batch_(false), half_input_(false), confidence_threshold_(0.5), detection_scale_factor_(1.0),
+      initialized_(false) {
+    ModelMetrics metrics = getMetrics();
+    short_name_ = metrics.model_name + "/ORT";
+    avg_inference_time_ms_ = metrics.avg_inference_time_ms;
+}
+
+bool OnnxRuntimeModel::initialize(const std::string& model_path,
+                                  const std::string& /* config_path */,
+                                  const std::string& classes_path,
+                                  double confidence_threshold,
+                                  double detection_scale_factor) {
+    if (initialized_) {
+        return true;
+    }
+
+    confidence_threshold_ = confidence_threshold;
+    detection_scale_factor_ = detection_scale_factor;
+
+    logger_->info("Initializing " + getModelName() + " model...");
+    logger_->debug("Model path: " + model_path);
+    logger_->debug("Classes path: " + classes_path);
+    logger_->debug("Confidence threshold: " + std::to_string(confidence_threshold_));
+    logger_->debug("Detection scale factor: " + std::to_string(detection_scale_factor_));
+
+    // Load class names
+    if (!loadClassNames(classes_path)) {
+        logger_->error("Failed to load class names");
+        return false;
+    }
+    registry_ids_ = ClassRegistry::internAll(class_names_);
+
+    target_class_ids_ = YoloUtils::resolveClassIds(target_class_names_, class_names_);
+
+    // Load the model
+    if (!loadModel(model_path)) {
+        logger_->error("Failed to load " + getModelName() + " model");
+        return false;
+    }
+
+    initialized_ = true;
+    logger_->info(getModelName() + " model initialized successfully");
+
+    return true;
+}
+
+std::vector<Detection> OnnxRuntimeModel::detect(const cv::Mat& frame) {
+    return detectScaled(frame, detection_scale_factor_);
+}
+
+std::vector<Detection> OnnxRuntimeModel::detectRegion(const cv::Mat& crop) {
+    return detectScaled(crop, 1.0);
+}
+
+std::vector<Detection> OnnxRuntimeModel::detectScaled(const cv::Mat& frame, double scale_factor) {
+    if (!initialized_ || frame.empty()) {
+        return {};
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<Detection> detections;
+
+    try {
+        // Models exported with dynamic axes take a smaller stride-aligned input
+        int input_size = fixed_input_size_ > 0
+            ? fixed_input_size_
+            : YoloUtils::computeInputSize(frame.size(), scale_factor, NOMINAL_INPUT_SIZE);
+        detections = runNetwork(frame, input_size);
+
+    } catch (const Ort::Exception& e) {
+        logger_->error("ONNX Runtime error during " + short_name_ + " detection: " + std::string(e.what()));
+    } catch (const cv::Exception& e) {
+        logger_->error("OpenCV error during " + short_name_ + " detection: " + std::string(e.what()));
+    } catch (const std::exception& e) {
+        logger_->error("Error during " + short_name_ + " detection: " + std::string(e.what()));
+    }
+
+    // Update inference timing
+    auto end_time = std::chrono::steady_clock::now();
+    auto inference_time = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    updateInferenceTime(static_cast<int>(inference_time.count()));
+
+    return detections;
+}
+
+std::vector<std::vector<Detection>> OnnxRuntimeModel::detectBatch(const std::vector<cv::Mat>& frames) {
+    if (!initialized_ || !dynamic_batch_ || frames.size() < 2) {
+        return IDetectionModel::detectBatch(frames);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<std::vector<Detection>> results(frames.size());
+
+    try {
+        runBatch(frames, results);
+
+    } catch (const Ort::Exception& e) {
+        logger_->error("ONNX Runtime error during " + short_name_ + " batch detection: " + std::string(e.what()));
+    } catch (const cv::Exception& e) {
+        logger_->error("OpenCV error during " + short_name_ + " batch detection: " + std::string(e.what()));
+    } catch (const std::exception& e) {
+        logger_->error("Error during " + short_name_ + " batch detection: " + std::string(e.what()));
+    }
+
+    // Track per-frame cost so metrics stay comparable with detect()
+    auto end_time = std::chrono::steady_clock::now();
+    auto inference_time = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    updateInferenceTime(static_cast<int>(inference_time.count() / static_cast<long>(frames.size())));
+
+    return results;
+}
+
+ModelMetrics OnnxRuntimeModel::getMetrics() const {
+    // Same network as the OpenCV DNN model; getAvailableModels() follows ModelType order
+    ModelMetrics metrics = DetectionModelFactory::getAvailableModels().at(static_cast<size_t>(model_type_));
+    metrics.model_type = "YOLO (ONNX Runtime)";
+    if (initialized_) {
+        metrics.avg_inference_time_ms = avg_inference_time_ms_;
+    }
+    return metrics;
+}
+
+std::vector<std::string> OnnxRuntimeModel::getSupportedClasses() const {
+    return class_names_;
+}
+
+bool OnnxRuntimeModel::isInitialized() const {
+    return initialized_;
+}
+
+std::string OnnxRuntimeModel::getModelName() const {
+    return DetectionModelFactory::getAvailableModels().at(static_cast<size_t>(model_type_)).model_name +
+           " (ONNX Runtime)";
+}
+
+int OnnxRuntimeModel::getInputSize() const {
+    return fixed_input_size_ > 0 ? fixed_input_size_ : NOMINAL_INPUT_SIZE;
+}
+
+void OnnxRuntimeModel::setTargetClasses(const std::vector<std::string>& class_names) {
+    target_class_names_ = class_names;
+}
+
+void OnnxRuntimeModel::warmUp() {
+    if (!initialized_) {
+        return;
+    }
+
+    logger_->debug("Warming up " + getModelName() + " model...");
+
+    // Create a dummy frame for warm-up
+    cv::Mat dummy_frame(NOMINAL_INPUT_SIZE, NOMINAL_INPUT_SIZE, CV_8UC3, cv::Scalar(128, 128, 128));
+
+    // Run a few inference passes to warm up
+    for (int i = 0; i < 3; ++i) {
+        detect(dummy_frame);
+    }
+
+    logger_->debug(getModelName() + " model warm-up complete");
+}
+
+bool OnnxRuntimeModel::loadClassNames(const std::string& classes_path) {
+    std::ifstream class_file(classes_path);
+    if (!class_file.is_open()) {
+        logger_->warning("Classes file not found, using built-in COCO classes");
+        class_names_ = YoloUtils::cocoClassNames();
+        return true;
+    }
+
+    class_names_.clear();
+    std::string line;
+    while (std::getline(class_file, line)) {
+        if (!line.empty()) {
+            class_names_.push_back(line);
+        }
+    }
+    class_file.close();
+
+    return !class_names_.empty();
+}
+
+bool OnnxRuntimeModel::loadModel(const std::string& model_path) {
+    try {
+        // Check if model file exists
+        if (!fs::exists(model_path)) {
+            logger_->error(short_name_ + " model file not found: " + model_path);
+            return false;
+        }
+
+        Ort::SessionOptions session_options;
+        session_options.SetIntraOpNumThreads(options_.intra_op_threads);
+        if (options_.inter_op_threads > 0) {
+            // Inter-op threads are only used when independent nodes may run in parallel
+            session_options.SetExecutionMode(ExecutionMode::ORT_PARALLEL);
+            session_options.SetInterOpNumThreads(options_.inter_op_threads);
+        } else {
+            session_options.SetExecutionMode(ExecutionMode::ORT_SEQUENTIAL);
+        }
+        session_options.SetGraphOptimizationLevel(parseOptimizationLevel(options_.graph_optimization));
+
+        session_ = std::make_unique<Ort::Session>(sharedEnvironment(), model_path.c_str(), session_options);
+
+        if (session_->GetInputCount() != 1 || session_->GetOutputCount() < 1) {
+            logger_->error(short_name_ + " expects a single-input YOLO model: " + model_path);
+            session_.reset();
+            return false;
+        }
+
+        Ort::AllocatorWithDefaultOptions allocator;
+        input_name_ = session_->GetInputNameAllocated(0, allocator).get();
+        output_name_ = session_->GetOutputNameAllocated(0, allocator).get();
+
+        // INT8 models keep float32 I/O (quantization happens inside the graph);
+        // FP16 exports may take float16 input directly
+        auto input_info = session_->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo();
+        if (input_info.GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT &&
+            input_info.GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16) {
+            logger_->error(short_name_ + " requires a float32 or float16 input tensor: " + model_path);
+            session_.reset();
+            return false;
+        }
+        half_input_ = input_info.GetElementType() == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16;
+        logger_->info(short_name_ + " model precision: " + OnnxModelInfo::describe(OnnxModelInfo::inspect(model_path)));
+
+        // [N, 3, H, W]; batch and spatial axes are -1 when exported with dynamic=True
+        std::vector<int64_t> input_shape = input_info.GetShape();
+        if (input_shape.size() != 4) {
+            logger_->error(short_name_ + " expects a [N, 3, H, W] input, got " +
+                          std::to_string(input_shape.size()) + " dimensions");
+            session_.reset();
+            return false;
+        }
+        dynamic_batch_ = input_shape[0] <= 0;
+        if (input_shape[2] > 0 && input_shape[3] > 0) {
+            if (input_shape[2] != input_shape[3]) {
+                logger_->error(short_name_ + " expects a square network input");
+                session_.reset();
+                return false;
+            }
+            fixed_input_size_ = static_cast<int>(input_shape[2]);
+            if (detection_scale_factor_ < 1.0) {
+                logger_->info(short_name_ + " model has a fixed " + std::to_string(fixed_input_size_) +
+                             "x" + std::to_string(fixed_input_size_) +
+                             " input (re-export with dynamic axes to benefit from --detection-scale)");
+            }
+        }
+
+        logger_->info(short_name_ + " using ONNX Runtime CPU execution provider (intra-op threads: " +
+                     (options_.intra_op_threads > 0 ? std::to_string(options_.intra_op_threads) : std::string("default")) +
+                     ", inter-op threads: " +
+                     (options_.inter_op_threads > 0 ? std::to_string(options_.inter_op_threads) : std::string("sequential")) +
+                     ", graph optimization: " + options_.graph_optimization + ")");
+        return true;
+
+    } catch (const Ort::Exception& e) {
+        logger_->error("ONNX Runtime error loading " + short_name_ + " model: " + std::string(e.what()));
+        session_.reset();
+        return false;
+    } catch (const std::exception& e) {
+        logger_->error("Error loading " + short_name_ + " model: " + std::string(e.what()));
+        session_.reset();
+        return false;
+    }
+}
+
+std::vector<Detection> OnnxRuntimeModel::runNetwork(const cv::Mat& frame, int input_size) {
+    YoloUtils::Letterbox letterbox = YoloUtils::computeLetterbox(frame.size(), input_size);
+
+    // Same fused preprocessing as the OpenCV backend; the tensor wraps the blob without a copy
+    YoloUtils::letterboxToBlob(frame, letterbox, SCALE_FACTOR, resize_buffer_, input_blob_);
+
+    std::vector<Ort::Value> outputs;
+    std::vector<int64_t> shape;
+    const float* output = runSession(1, input_size, outputs, shape);
+    if (!output) {
+        return {};
+    }
+    return postProcess(frame, letterbox, output, shape);
+}
+
+void OnnxRuntimeModel::runBatch(const std::vector<cv::Mat>& frames, std::vector<std::vector<Detection>>& results) {
+    if (!YoloUtils::prepareBatch(frames, fixed_input_size_, detection_scale_factor_, NOMINAL_INPUT_SIZE,
+                                 SCALE_FACTOR, batch_, resize_buffer_, input_blob_)) {
+        return;
+    }
+
+    const int batch_size = static_cast<int>(batch_.size());
+    std::vector<Ort::Value> outputs;
+    std::vector<int64_t> shape;
+    const float* output = runSession(batch_size, batch_.input_size, outputs, shape);
+    if (!output || shape.size() != 3 || shape[0] != batch_size) {
+        return;
+    }
+
+    // Image b owns the b-th [dim1, dim2] slice of the output
+    const size_t slice_size = static_cast<size_t>(shape[1]) * static_cast<size_t>(shape[2]);
+    YoloUtils::scatterBatch(batch_, results, [&](size_t b) {
+        return postProcess(batch_.frames[b], batch_.letterboxes[b], output + b * slice_size, shape);
+    });
+}
+
+const float* OnnxRuntimeModel::runSession(int batch_size, int input_size, std::vector<Ort::Value>& outputs,
+                                          std::vector<int64_t>& shape) {
+    const int64_t input_shape[4] = {batch_size, 3, input_size, input_size};
+    Ort::Value input_tensor{nullptr};
+    if (half_input_) {
+        input_blob_.convertTo(half_blob_, CV_16F);
+        input_tensor = Ort::Value::CreateTensor(memory_info_, half_blob_.data,
+                                                half_blob_.total() * half_blob_.elemSize(),
+                                                input_shape, 4, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16);
+    } else {
+        input_tensor = Ort::Value::CreateTensor<float>(
+            memory_info_, input_blob_.ptr<float>(), input_blob_.total(), input_shape, 4);
+    }
+
+    const char* input_names[] = {input_name_.c_str()};
+    const char* output_names[] = {output_name_.c_str()};
+    outputs = session_->Run(Ort::RunOptions{nullptr},
+                            input_names, &input_tensor, 1,
+                            output_names, 1);
+
+    if (outputs.empty() || !outputs[0].IsTensor()) {
+        return nullptr;
+    }
+
+    auto output_info = outputs[0].GetTensorTypeAndShapeInfo();
+    shape = output_info.GetShape();
+    if (output_info.GetElementType() == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16) {
+        cv::Mat half_output(1, static_cast<int>(output_info.GetElementCount()), CV_16F,
+                            outputs[0].GetTensorMutableData<uint16_t>());
+        half_output.convertTo(output_buffer_, CV_32F);
+        return output_buffer_.ptr<float>();
+    }
+    return outputs[0].GetTensorData<float>();
+}
+
+std::vector<Detection> OnnxRuntimeModel::postProcess(
+    const cv::Mat& frame, const YoloUtils::Letterbox& letterbox,
+    const float* output, const std::vector<int64_t>& shape) {
+
+    std::vector<Detection> detections;
+
+    if (shape.size() != 3) {
+        logger_->debug("Unexpected " + short_name_ + " output dimensions: " + std::to_string(shape.size()));
+        return detections;
+    }
+
+    if (anchor_free_) {
+        // YOLOv8: [batch, 4 + classes, anchors], channel-major
+        const int channels = static_cast<int>(shape[1]);
+        const int anchors = static_cast<int>(shape[2]);
+        if (channels <= 4 || channels > anchors) {
+            logger_->debug("Unexpected " + short_name_ + " output shape (expected [1, 4 + classes, anchors])");
+            return detections;
+        }
+        YoloUtils::decodeYoloV8(output, channels, anchors, target_class_ids_,
+                                static_cast<float>(confidence_threshold_), best_scores_, candidates_);
+    } else {
+        // YOLOv5: [batch, num_detections, 5 + classes]
+        const int rows = static_cast<int>(shape[1]);
+        const int row_size = static_cast<int>(shape[2]);
+        if (row_size <= 5) {
+            logger_->debug("Unexpected " + short_name_ + " output shape (expected [1, detections, 5 + classes])");
+            return detections;
+        }
+        YoloUtils::decodeYoloV5(output, rows, row_size, target_class_ids_,
+                                static_cast<float>(confidence_threshold_), candidates_);
+    }
+
+    YoloUtils::suppressCandidates(candidates_, letterbox, frame.size(), NMS_IOU_THRESHOLD,
+                                  registry_ids_, nms_, detections);
+
+    return detections;
+}
+
+void OnnxRuntimeModel::updateInferenceTime(int inference_time_ms) const {
+    // Simple moving average
+    avg_inference_time_ms_ = (avg_inference_time_ms_ * 9 + inference_time_ms) / 10;
+}
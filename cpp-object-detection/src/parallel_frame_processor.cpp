@@ -1,6 +1,9 @@
 #include "parallel_frame_processor.hpp"
+#include "class_registry.hpp"
 #include "drawing_utils.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <sstream>
 #include <set>
@@ -18,8 +21,11 @@ ParallelFrameProcessor::ParallelFrameProcessor(std::shared_ptr<ObjectDetector> d
       num_threads_(num_threads), max_queue_size_(max_queue_size), output_dir_(output_dir),
       enable_brightness_filter_(enable_brightness_filter),
       stationary_timeout_seconds_(stationary_timeout_seconds),
+      max_batch_size_(1), batch_timeout_(0), stream_id_(-1), inference_interval_(1), frames_submitted_(0),
+      keyframe_requested_(false),
+      moving_objects_(0), avg_inference_ms_(0.0),
       total_images_saved_(0), shutdown_requested_(false), frames_in_progress_(0),
-      brightness_filter_active_(false) {
+      brightness_filter_active_(false), next_sequence_(0) {
     last_photo_time_ = std::chrono::steady_clock::now() - std::chrono::seconds(PHOTO_INTERVAL_SECONDS);
 }
 
@@ -28,17 +34,28 @@ ParallelFrameProcessor::~ParallelFrameProcessor() {
 }
 
 bool ParallelFrameProcessor::initialize() {
-    if (num_threads_ <= 1) {
+    if (scheduler_) {
+        logger_->info("Frame processor using shared inference scheduler (stream " + std::to_string(stream_id_) +
+                      ") with output directory " + output_dir_);
+        tracking_thread_ = std::thread(&ParallelFrameProcessor::trackingThread, this);
+    } else if (num_threads_ <= 1) {
         logger_->info("Parallel processing disabled - using sequential processing");
     } else {
         logger_->info("Initializing parallel frame processor with " + std::to_string(num_threads_) + " threads");
+        if (max_batch_size_ > 1) {
+            logger_->info("Batched inference: up to " + std::to_string(max_batch_size_) + " frames per forward pass, " +
+                         std::to_string(batch_timeout_.count()) + "ms batch window");
+        }
         
-        // Start worker threads
+        // Start inference worker threads
         worker_threads_.reserve(num_threads_);
         for (int i = 0; i < num_threads_; ++i) {
             worker_threads_.emplace_back(&ParallelFrameProcessor::workerThread, this);
         }
         
+        // Single tracking thread consumes inference results in capture order
+        tracking_thread_ = std::thread(&ParallelFrameProcessor::trackingThread, this);
+        
         logger_->info("Parallel frame processor initialized successfully");
     }
     
@@ -55,13 +72,167 @@ bool ParallelFrameProcessor::initialize() {
     return true;
 }
 
-std::future<ParallelFrameProcessor::FrameResult> ParallelFrameProcessor::submitFrame(const cv::Mat& frame) {
+void ParallelFrameProcessor::setBatching(size_t max_batch_size, int batch_timeout_ms) {
+    if (!worker_threads_.empty()) {
+        logger_->warning("Batching must be configured before initialization - ignoring");
+        return;
+    }
+    max_batch_size_ = std::max<size_t>(1, max_batch_size);
+    batch_timeout_ = std::chrono::milliseconds(std::max(0, batch_timeout_ms));
+}
+
+void ParallelFrameProcessor::setInferenceScheduler(std::shared_ptr<InferenceScheduler> scheduler, int stream_id) {
+    if (tracking_thread_.joinable()) {
+        logger_->warning("Inference scheduler must be set before initialization - ignoring");
+        return;
+    }
+    scheduler_ = scheduler;
+    stream_id_ = stream_id;
+}
+
+void ParallelFrameProcessor::setMotionGate(std::shared_ptr<MotionGate> gate) {
+    if (tracking_thread_.joinable()) {
+        logger_->warning("Motion gate must be set before initialization - ignoring");
+        return;
+    }
+    motion_gate_ = gate;
+}
+
+void ParallelFrameProcessor::setInferenceInterval(int interval) {
+    if (tracking_thread_.joinable()) {
+        logger_->warning("Inference interval must be set before initialization - ignoring");
+        return;
+    }
+    inference_interval_ = std::max(1, interval);
+}
+
+void ParallelFrameProcessor::setFlowTracker(std::shared_ptr<FlowTracker> tracker) {
+    if (tracking_thread_.joinable()) {
+        logger_->warning("Flow tracker must be set before initialization - ignoring");
+        return;
+    }
+    flow_tracker_ = tracker;
+}
+
+void ParallelFrameProcessor::setMotionRoiExtractor(std::shared_ptr<MotionRoiExtractor> extractor) {
+    if (tracking_thread_.joinable()) {
+        logger_->warning("Motion ROI extractor must be set before initialization - ignoring");
+        return;
+    }
+    roi_extractor_ = extractor;
+}
+
+void ParallelFrameProcessor::setTiledInference(std::shared_ptr<TiledInference> tiled) {
+    if (tracking_thread_.joinable()) {
+        logger_->warning("Tiled inference must be set before initialization - ignoring");
+        return;
+    }
+    tiled_ = tiled;
+}
+
+void ParallelFrameProcessor::setDetectionZones(std::shared_ptr<DetectionZones> zones) {
+    if (tracking_thread_.joinable()) {
+        logger_->warning("Detection zones must be set before initialization - ignoring");
+        return;
+    }
+    zones_ = zones;
+}
+
+void ParallelFrameProcessor::logInferenceStats() const {
+    if (motion_gate_) {
+        motion_gate_->logStats(getAverageInferenceTime());
+    }
+    if (roi_extractor_) {
+        roi_extractor_->logStats();
+    }
+    if (tiled_) {
+        tiled_->logStats();
+    }
+    if (flow_tracker_) {
+        flow_tracker_->logStats();
+    }
+    if (zones_) {
+        logger_->info("Detection zones: " + std::to_string(zones_->getFilteredCount()) +
+                      " detections outside the analyzed area dropped");
+    }
+}
+
+cv::Mat ParallelFrameProcessor::flowInput(const cv::Mat& frame) {
+    cv::Mat image = FlowTracker::prepareImage(frame);
+    if (zones_ && !image.empty()) {
+        cv::bitwise_and(image, zones_->getMask(image.size()), image);
+    }
+    return image;
+}
+
+cv::Mat ParallelFrameProcessor::zoneMask(const cv::Size& size) {
+    // The motion stages mask their own small copies; masking the camera frame would cost far more
+    return zones_ ? zones_->getMask(size) : cv::Mat();
+}
+
+std::vector<cv::Rect> ParallelFrameProcessor::findMotionRegions(const cv::Mat& frame,
+                                                                const FullResolutionSource* source) {
+    if (!roi_extractor_) {
+        return {};
+    }
+    // Tracks are in camera coordinates, the regions in those of the (possibly reduced) frame
+    const int decode_scale = source ? std::max(1, source->decode_scale) : 1;
+    std::vector<cv::Rect> track_boxes;
+    {
+        std::lock_guard<std::mutex> lock(track_regions_mutex_);
+        track_boxes.reserve(track_regions_.size());
+        for (const auto& box : track_regions_) {
+            track_boxes.emplace_back(box.x / decode_scale, box.y / decode_scale,
+                                     box.width / decode_scale, box.height / decode_scale);
+        }
+    }
+    // Traffic in an excluded zone must not count as motion
+    return roi_extractor_->extract(frame, track_boxes, zoneMask(MotionRoiExtractor::analysisSize(frame.size())));
+}
+
+double ParallelFrameProcessor::getAverageInferenceTime() const {
+    if (scheduler_) {
+        auto stats = scheduler_->getStreamStats();
+        return stream_id_ >= 0 && stream_id_ < static_cast<int>(stats.size()) ? stats[stream_id_].avg_inference_ms : 0.0;
+    }
+    return avg_inference_ms_.load();
+}
+
+void ParallelFrameProcessor::recordInferenceTime(double milliseconds_per_frame) {
+    // Concurrent workers may overwrite each other's update; close enough for an average
+    double previous = avg_inference_ms_.load();
+    avg_inference_ms_ = previous == 0.0 ? milliseconds_per_frame
+                                        : previous + 0.1 * (milliseconds_per_frame - previous);
+}
+
+std::future<ParallelFrameProcessor::FrameResult> ParallelFrameProcessor::submitFrame(
+        const cv::Mat& frame, const FullResolutionSource* source, std::chrono::steady_clock::time_point capture_time) {
+    // Between inference frames the tracker extrapolates the boxes instead,
+    // unless optical flow lost track and restarted the interval
+    if (keyframe_requested_.exchange(false)) {
+        frames_submitted_ = 0;
+    }
+    if (frames_submitted_++ % static_cast<uint64_t>(inference_interval_) != 0) {
+        return submitSkippedFrame(frame, source, capture_time, true);
+    }
+    
+    // Static scene and nothing moving in view: no need to run the network
+    if (motion_gate_ &&
+        !motion_gate_->shouldRunInference(frame, moving_objects_.load() > 0,
+                                          zoneMask(cv::Size(MotionGate::GATE_WIDTH, MotionGate::GATE_HEIGHT)))) {
+        return submitSkippedFrame(frame, source, capture_time, false);
+    }
+    
+    if (scheduler_) {
+        return submitToScheduler(frame, source, capture_time);
+    }
+    
     if (num_threads_ <= 1) {
         // Single-threaded mode - process synchronously
         std::promise<FrameResult> promise;
         auto future = promise.get_future();
         try {
-            auto result = processFrameSync(frame);
+            auto result = processFrameSync(frame, source, capture_time);
             promise.set_value(result);
         } catch (...) {
             promise.set_exception(std::current_exception());
@@ -69,7 +240,9 @@ std::future<ParallelFrameProcessor::FrameResult> ParallelFrameProcessor::submitF
         return future;
     }
     
-    // Multi-threaded mode - queue for processing
+    // Multi-threaded mode - queue for processing. Motion analysis runs before
+    // taking the lock so other submitters and the workers are not held up by it
+    std::vector<cv::Rect> regions = findMotionRegions(frame, source);
     std::unique_lock<std::mutex> lock(queue_mutex_);
     
     // Check if queue is full
@@ -80,31 +253,160 @@ std::future<ParallelFrameProcessor::FrameResult> ParallelFrameProcessor::submitF
         
         FrameResult empty_result;
         empty_result.processed = false;
-        empty_result.capture_time = std::chrono::high_resolution_clock::now();
+        empty_result.capture_time = capture_time;
         promise.set_value(empty_result);
         return future;
     }
     
     // Create promise/future pair for the result
-    std::promise<FrameResult> promise;
-    auto future = promise.get_future();
+    QueuedFrame queued;
+    queued.sequence = next_sequence_++;
+    queued.frame = frame.clone();
+    if (source && source->decode_scale > 1) {
+        queued.source = *source;
+    }
+    queued.regions = std::move(regions);
+    queued.capture_time = capture_time;
+    auto future = queued.promise.get_future();
     
     // Add frame to queue
-    frame_queue_.emplace(frame.clone(), std::move(promise));
+    frame_queue_.push(std::move(queued));
     frames_in_progress_++;
     
     lock.unlock();
-    queue_condition_.notify_one();
+    if (max_batch_size_ > 1) {
+        // A worker may be waiting for its batch to fill rather than for work
+        queue_condition_.notify_all();
+    } else {
+        queue_condition_.notify_one();
+    }
+    
+    return future;
+}
+
+std::future<ParallelFrameProcessor::FrameResult> ParallelFrameProcessor::submitSkippedFrame(
+        const cv::Mat& frame, const FullResolutionSource* source, std::chrono::steady_clock::time_point capture_time,
+        bool between_inferences) {
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        sequence = next_sequence_++;
+    }
+    int decode_scale = source ? std::max(1, source->decode_scale) : 1;
+    cv::Size camera_size(frame.cols * decode_scale, frame.rows * decode_scale);
+    // A static frame the motion gate skipped gives flow nothing to follow
+    cv::Mat flow_image = flow_tracker_ && between_inferences ? flowInput(frame) : cv::Mat();
+    
+    if (num_threads_ <= 1 && !scheduler_) {
+        // Sequential mode: the tracker is only touched from this thread
+        std::promise<FrameResult> promise;
+        auto future = promise.get_future();
+        FrameResult result;
+        result.capture_time = capture_time;
+        result.processed = true;
+        result.inference_skipped = true;
+        result.sequence = sequence;
+        trackSkippedFrame(flow_image, result.capture_time, camera_size, result.detections);
+        result.tracked_objects = detector_->shareTrackedObjects();
+        promise.set_value(std::move(result));
+        return future;
+    }
+    
+    // Asynchronous modes: keep capture order by going through the sequencer
+    InferredFrame inferred;
+    inferred.sequence = sequence;
+    inferred.capture_time = capture_time;
+    inferred.camera_size = camera_size;
+    inferred.flow_image = std::move(flow_image);
+    inferred.inference_ok = true;
+    inferred.inference_skipped = true;
+    auto future = inferred.promise.get_future();
+    frames_in_progress_++;
+    sequencer_.push(sequence, std::move(inferred));
+    return future;
+}
+
+void ParallelFrameProcessor::trackSkippedFrame(const cv::Mat& flow_image,
+                                               std::chrono::steady_clock::time_point capture_time,
+                                               const cv::Size& camera_size, std::vector<Detection>& detections) {
+    if (!flow_image.empty() && flow_tracker_->hasKeyframe()) {
+        if (flow_tracker_->propagate(flow_image, flow_boxes_)) {
+            detector_->moveTracks(flow_boxes_, capture_time, detections);
+            return;
+        }
+        // Flow lost an object or something new moved in: detect on the next frame
+        keyframe_requested_ = true;
+    }
+    detector_->predictTracks(capture_time, camera_size, detections);
+}
+
+std::future<ParallelFrameProcessor::FrameResult> ParallelFrameProcessor::submitToScheduler(
+        const cv::Mat& frame, const FullResolutionSource* source, std::chrono::steady_clock::time_point capture_time) {
+    auto inferred = std::make_shared<InferredFrame>();
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        inferred->sequence = next_sequence_++;
+    }
+    inferred->frame = frame.clone();
+    if (source && source->decode_scale > 1) {
+        inferred->source = *source;
+    }
+    inferred->capture_time = capture_time;
+    auto future = inferred->promise.get_future();
+    frames_in_progress_++;
+    
+    // The brightness filter runs here, on the submitting thread, since the
+    // scheduler's workers only run the model
+    std::vector<cv::Rect> regions = findMotionRegions(inferred->frame, source);
+    std::vector<cv::Point> origins;
+    bool reduced = false;
+    // Full frames may be batched with other cameras' frames
+    cv::Mat prepared = prepareFrame(inferred->frame, regions, origins, reduced, true);
+    cv::Size detection_size = reduced ? prepared.size() : inferred->frame.size();
+    if (reduced) {
+        // Already at detection resolution: as a region job the scale factor is not applied again
+        regions = {cv::Rect(0, 0, prepared.cols, prepared.rows)};
+    }
+    bool queued = scheduler_->submit(stream_id_, prepared,
+        [this, inferred, detection_size](bool inference_ok, std::vector<Detection>& detections) {
+            inferred->inference_ok = inference_ok;
+            if (inference_ok) {
+                inferred->detections = std::move(detections);
+                mapFromDetectionResolution(inferred->detections, detection_size, inferred->frame.size());
+                mapToFullResolution(inferred->detections, inferred->source.decode_scale);
+            }
+            uint64_t sequence = inferred->sequence;
+            sequencer_.push(sequence, std::move(*inferred));
+        }, std::move(regions), std::move(origins));
     
+    if (!queued) {
+        logger_->warning("Frame queue full, dropping frame");
+        sequencer_.skip(inferred->sequence);
+        frames_in_progress_--;
+        
+        FrameResult empty_result;
+        empty_result.processed = false;
+        empty_result.capture_time = inferred->capture_time;
+        empty_result.sequence = inferred->sequence;
+        inferred->promise.set_value(empty_result);
+    }
     return future;
 }
 
-ParallelFrameProcessor::FrameResult ParallelFrameProcessor::processFrameSync(const cv::Mat& frame) {
-    return processFrameInternal(frame);
+ParallelFrameProcessor::FrameResult ParallelFrameProcessor::processFrameSync(
+        const cv::Mat& frame, const FullResolutionSource* source, std::chrono::steady_clock::time_point capture_time) {
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        sequence = next_sequence_++;
+    }
+    auto result = processFrameInternal(frame, source, findMotionRegions(frame, source), capture_time);
+    result.sequence = sequence;
+    return result;
 }
 
 void ParallelFrameProcessor::shutdown() {
-    if (num_threads_ <= 1 || shutdown_requested_.load()) {
+    if ((num_threads_ <= 1 && !scheduler_) || shutdown_requested_.load()) {
         return;
     }
     
@@ -120,28 +422,48 @@ void ParallelFrameProcessor::shutdown() {
         }
     }
     
-    // Clear any remaining frames in queue
-    std::unique_lock<std::mutex> lock(queue_mutex_);
-    while (!frame_queue_.empty()) {
-        auto& [frame, promise] = frame_queue_.front();
-        FrameResult empty_result;
-        empty_result.processed = false;
-        empty_result.capture_time = std::chrono::high_resolution_clock::now();
-        promise.set_value(empty_result);
-        frame_queue_.pop();
+    // Frames of this camera still in the shared scheduler complete as unprocessed
+    if (scheduler_) {
+        scheduler_->drainStream(stream_id_);
+    }
+    
+    // Hand any frames still queued to the tracking thread as unprocessed so
+    // their futures resolve in capture order alongside the finished ones
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        while (!frame_queue_.empty()) {
+            auto& queued = frame_queue_.front();
+            InferredFrame inferred;
+            inferred.sequence = queued.sequence;
+            inferred.capture_time = queued.capture_time;
+            inferred.inference_ok = false;
+            inferred.promise = std::move(queued.promise);
+            sequencer_.push(queued.sequence, std::move(inferred));
+            frame_queue_.pop();
+        }
+    }
+    
+    // Let the tracking thread drain the reorder buffer and exit
+    sequencer_.close();
+    if (tracking_thread_.joinable()) {
+        tracking_thread_.join();
     }
     
     logger_->info("Parallel frame processor shutdown complete");
 }
 
 size_t ParallelFrameProcessor::getQueueSize() const {
-    std::unique_lock<std::mutex> lock(const_cast<std::mutex&>(queue_mutex_));
+    if (scheduler_) {
+        return scheduler_->getQueueSize(stream_id_);
+    }
+    std::unique_lock<std::mutex> lock(queue_mutex_);
     return frame_queue_.size();
 }
 
 void ParallelFrameProcessor::workerThread() {
     logger_->debug("Worker thread started");
     
+    std::vector<QueuedFrame> batch;
     while (!shutdown_requested_.load()) {
         std::unique_lock<std::mutex> lock(queue_mutex_);
         
@@ -158,32 +480,119 @@ void ParallelFrameProcessor::workerThread() {
             continue;
         }
         
-        // Get next frame to process
-        auto [frame, promise] = std::move(frame_queue_.front());
-        frame_queue_.pop();
+        if (max_batch_size_ > 1 && frame_queue_.size() < max_batch_size_) {
+            // Give a burst a short window to fill the batch before dispatching
+            queue_condition_.wait_for(lock, batch_timeout_, [this] {
+                return frame_queue_.size() >= max_batch_size_ || shutdown_requested_.load();
+            });
+            if (frame_queue_.empty()) {
+                continue;  // Another worker took the frames
+            }
+        }
+        
+        // Get next frames to process (a single frame unless batching)
+        batch.clear();
+        while (!frame_queue_.empty() && batch.size() < max_batch_size_) {
+            batch.push_back(std::move(frame_queue_.front()));
+            frame_queue_.pop();
+        }
         lock.unlock();
         
+        // Run inference only - tracking happens on the tracking thread in capture order
+        inferFrames(batch);
+    }
+    
+    logger_->debug("Worker thread exiting");
+}
+
+void ParallelFrameProcessor::inferFrames(std::vector<QueuedFrame>& frames) {
+    std::vector<std::vector<Detection>> detections(frames.size());
+    // One flag per frame: a failed region pass or batch must not discard the other frames' results
+    std::vector<uint8_t> inference_ok(frames.size(), 0);
+    try {
+        // Region crops differ in size, so only full frames share a forward pass
+        std::vector<cv::Mat> images;
+        std::vector<size_t> full_frames;
+        for (size_t i = 0; i < frames.size(); ++i) {
+            if (!frames[i].regions.empty() || frames.size() == 1 || tiled_) {
+                inference_ok[i] = runInference(frames[i].frame, frames[i].regions, detections[i]);
+            } else {
+                images.push_back(frames[i].frame);
+                full_frames.push_back(i);
+            }
+        }
+        if (images.size() == 1) {
+            inference_ok[full_frames[0]] = runInference(images[0], {}, detections[full_frames[0]]);
+        } else if (!images.empty()) {
+            std::vector<std::vector<Detection>> batch;
+            const bool batch_ok = runBatchInference(images, batch);
+            for (size_t i = 0; i < batch.size(); ++i) {
+                detections[full_frames[i]] = std::move(batch[i]);
+                inference_ok[full_frames[i]] = batch_ok;
+            }
+        }
+    } catch (const std::exception& e) {
+        // Frames inferred before the error keep their results
+        logger_->error("Error during frame inference: " + std::string(e.what()));
+    }
+    
+    // Scatter the results back to their frames; the sequencer restores capture order
+    for (size_t i = 0; i < frames.size(); ++i) {
+        InferredFrame inferred;
+        inferred.sequence = frames[i].sequence;
+        inferred.capture_time = frames[i].capture_time;
+        inferred.promise = std::move(frames[i].promise);
+        inferred.inference_ok = inference_ok[i] != 0;
+        if (inferred.inference_ok) {
+            inferred.detections = std::move(detections[i]);
+            mapToFullResolution(inferred.detections, frames[i].source.decode_scale);
+        }
+        inferred.frame = std::move(frames[i].frame);
+        inferred.source = std::move(frames[i].source);
+        
+        sequencer_.push(inferred.sequence, std::move(inferred));
+    }
+}
+
+void ParallelFrameProcessor::trackingThread() {
+    logger_->debug("Tracking thread started");
+    
+    InferredFrame inferred;
+    while (sequencer_.waitNext(inferred)) {
+        FrameResult result;
+        result.capture_time = inferred.capture_time;
+        result.sequence = inferred.sequence;
+        result.processed = inferred.inference_ok;
+        result.inference_skipped = inferred.inference_skipped;
+        result.detections = std::move(inferred.detections);
+        
         try {
-            // Process the frame
-            auto result = processFrameInternal(frame);
-            promise.set_value(result);
+            if (result.inference_skipped) {
+                trackSkippedFrame(inferred.flow_image, result.capture_time, inferred.camera_size, result.detections);
+                result.tracked_objects = detector_->shareTrackedObjects();
+            } else if (result.processed) {
+                applyTrackingStage(inferred.frame, &inferred.source, result);
+            }
+            inferred.promise.set_value(std::move(result));
         } catch (...) {
-            promise.set_exception(std::current_exception());
+            inferred.promise.set_exception(std::current_exception());
         }
         
+        inferred = InferredFrame();
         frames_in_progress_--;
     }
     
-    logger_->debug("Worker thread exiting");
+    logger_->debug("Tracking thread exiting");
 }
 
-void ParallelFrameProcessor::saveDetectionPhoto(const cv::Mat& frame, const std::vector<Detection>& detections, const std::shared_ptr<ObjectDetector>& detector) {
+void ParallelFrameProcessor::saveDetectionPhoto(const cv::Mat& frame, const FullResolutionSource* source,
+                                                const std::vector<Detection>& detections, const std::shared_ptr<ObjectDetector>& detector) {
     std::lock_guard<std::mutex> lock(photo_mutex_);
     
     // Count current object types
     std::map<std::string, int> current_object_counts;
     for (const auto& detection : detections) {
-        current_object_counts[detection.class_name]++;
+        current_object_counts[ClassRegistry::name(detection.class_id)]++;
     }
     
     // Check if there are new object types or new instances
@@ -218,7 +627,7 @@ void ParallelFrameProcessor::saveDetectionPhoto(const cv::Mat& frame, const std:
         for (const auto& obj : tracked) {
             if (obj.is_new && obj.frames_since_detection == 0) {
                 has_new_objects = true;
-                logger_->info("Newly entered " + obj.object_type + " detected by tracker");
+                logger_->info("Newly entered " + ClassRegistry::name(obj.class_id) + " detected by tracker");
                 break;
             }
         }
@@ -269,18 +678,28 @@ void ParallelFrameProcessor::saveDetectionPhoto(const cv::Mat& frame, const std:
     last_photo_time_ = now;
     last_saved_object_counts_ = current_object_counts;
     
-    // Create a copy of the frame to draw on
-    cv::Mat annotated_frame = frame.clone();
+    // Create a copy of the frame to draw on; a reduced-scale frame is replaced by
+    // the full-resolution decode, which only happens now that a photo is saved
+    cv::Mat annotated_frame;
+    if (source && source->decode_scale > 1) {
+        annotated_frame = cv::imdecode(source->jpeg, cv::IMREAD_COLOR);
+        if (annotated_frame.empty()) {
+            logger_->error("Failed to decode full-resolution frame for detection photo");
+            return;
+        }
+    } else {
+        annotated_frame = frame.clone();
+    }
     
     // Draw bounding boxes for each detection
     for (const auto& detection : detections) {
-        cv::Scalar color = getColorForClass(detection.class_name);
+        const cv::Scalar& color = ClassRegistry::color(detection.class_id);
         
         // Draw rectangle around the object
         cv::rectangle(annotated_frame, detection.bbox, color, 2);
         
         // Draw label with class name and confidence
-        std::string label = detection.class_name + " (" + 
+        std::string label = ClassRegistry::name(detection.class_id) + " (" + 
                            std::to_string(static_cast<int>(detection.confidence * 100)) + "%)";
         
         // Add stationary indicator if object is stationary
@@ -316,32 +735,6 @@ void ParallelFrameProcessor::saveDetectionPhoto(const cv::Mat& frame, const std:
     }
 }
 
-cv::Scalar ParallelFrameProcessor::getColorForClass(const std::string& class_name) const {
-    // Define colors for different object types (BGR format)
-    // Green for persons, red for cats, blue for dogs, yellow for vehicles, etc.
-    if (class_name == "person") {
-        return cv::Scalar(0, 255, 0);  // Green
-    } else if (class_name == "cat") {
-        return cv::Scalar(0, 0, 255);  // Red
-    } else if (class_name == "dog") {
-        return cv::Scalar(255, 0, 0);  // Blue
-    } else if (class_name == "bird") {
-        return cv::Scalar(255, 255, 0);  // Cyan
-    } else if (class_name == "bear") {
-        return cv::Scalar(0, 128, 128);  // Dark cyan/teal
-    } else if (class_name == "car" || class_name == "truck" || class_name == "bus") {
-        return cv::Scalar(0, 255, 255);  // Yellow
-    } else if (class_name == "motorcycle" || class_name == "bicycle") {
-        return cv::Scalar(255, 0, 255);  // Magenta
-    } else if (class_name == "chair") {
-        return cv::Scalar(128, 0, 128);  // Purple
-    } else if (class_name == "book") {
-        return cv::Scalar(255, 128, 0);  // Orange
-    } else {
-        return cv::Scalar(255, 255, 255);  // White for unknown
-    }
-}
-
 std::string ParallelFrameProcessor::generateFilename(const std::vector<Detection>& detections) const {
     // Get current time
     auto now = std::chrono::system_clock::now();
@@ -356,7 +749,7 @@ std::string ParallelFrameProcessor::generateFilename(const std::vector<Detection
     // Collect unique object types
     std::set<std::string> object_types;
     for (const auto& detection : detections) {
-        object_types.insert(detection.class_name);
+        object_types.insert(ClassRegistry::name(detection.class_id));
     }
     
     // Build object string (e.g., "person cat detected")
@@ -373,85 +766,303 @@ std::string ParallelFrameProcessor::generateFilename(const std::vector<Detection
     return timestamp.str() + " " + object_str.str() + ".jpg";
 }
 
-ParallelFrameProcessor::FrameResult ParallelFrameProcessor::processFrameInternal(const cv::Mat& frame) {
-    auto start_time = std::chrono::high_resolution_clock::now();
-    
+ParallelFrameProcessor::FrameResult ParallelFrameProcessor::processFrameInternal(const cv::Mat& frame,
+                                                                                const FullResolutionSource* source,
+                                                                                const std::vector<cv::Rect>& regions,
+                                                                                std::chrono::steady_clock::time_point capture_time) {
     FrameResult result;
-    result.capture_time = start_time;
+    result.capture_time = capture_time;
     result.processed = true;
     
     try {
-        // Apply brightness filter if enabled and high brightness is detected
-        cv::Mat processed_frame = frame.clone();
-        if (enable_brightness_filter_ && detectHighBrightness(frame)) {
-            processed_frame = applyBrightnessFilter(frame);
-            brightness_filter_active_ = true;
+        result.processed = runInference(frame, regions, result.detections);
+        if (result.processed) {
+            mapToFullResolution(result.detections, source ? source->decode_scale : 1);
+            applyTrackingStage(frame, source, result);
+        }
+    } catch (const std::exception& e) {
+        logger_->error("Error processing frame: " + std::string(e.what()));
+        result.processed = false;
+    }
+    
+    return result;
+}
+
+bool ParallelFrameProcessor::runInference(const cv::Mat& frame, const std::vector<cv::Rect>& regions,
+                                          std::vector<Detection>& detections) {
+    try {
+        // Perform object detection on the (possibly filtered) frame: motion region crops, tiles or one pass
+        auto start = std::chrono::steady_clock::now();
+        bool reduced = false;
+        std::vector<cv::Rect> crops = regions;
+        std::vector<cv::Point> origins;
+        cv::Mat prepared = prepareFrame(frame, crops, origins, reduced);
+        if (reduced) {
+            detections = detectReduced(prepared, frame.size());
+        } else if (!crops.empty()) {
+            detections = detector_->detectObjectsInRegions(prepared, crops, origins);
+        } else if (tiled_) {
+            detections = tiled_->detect(prepared);
         } else {
-            brightness_filter_active_ = false;
+            detections = detector_->detectObjects(prepared);
         }
+        recordInferenceTime(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        return true;
         
-        // Perform object detection on the (possibly filtered) frame
-        result.detections = detector_->detectObjects(processed_frame);
+    } catch (const std::exception& e) {
+        logger_->error("Error processing frame: " + std::string(e.what()));
+        return false;
+    }
+}
+
+bool ParallelFrameProcessor::runBatchInference(const std::vector<cv::Mat>& frames,
+                                               std::vector<std::vector<Detection>>& detections) {
+    try {
+        std::vector<cv::Mat> processed_frames(frames.size());
+        std::vector<uint8_t> reduced(frames.size(), 0);
+        std::vector<cv::Rect> no_regions;
+        std::vector<cv::Point> no_origins;
+        for (size_t i = 0; i < frames.size(); ++i) {
+            bool frame_reduced = false;
+            processed_frames[i] = prepareFrame(frames[i], no_regions, no_origins, frame_reduced, true);
+            reduced[i] = frame_reduced ? 1 : 0;
+        }
         
-        // Filter for target classes and log detections
-        std::vector<Detection> target_detections;
-        for (const auto& detection : result.detections) {
-            if (detector_->isTargetClass(detection.class_name)) {
-                target_detections.push_back(detection);
-                
-                // Log detection with center coordinates
-                cv::Point2f center(
-                    detection.bbox.x + detection.bbox.width / 2.0f,
-                    detection.bbox.y + detection.bbox.height / 2.0f
-                );
-                logger_->info("detected " + detection.class_name + " at coordinates: (" + 
-                             std::to_string(static_cast<int>(center.x)) + ", " + 
-                             std::to_string(static_cast<int>(center.y)) + ") with confidence " + 
-                             std::to_string(static_cast<int>(detection.confidence * 100)) + "%");
+        // One replica, one forward pass for the whole batch; frames the brightness
+        // filter already reduced to detection resolution run on their own
+        auto start = std::chrono::steady_clock::now();
+        std::vector<cv::Mat> batch;
+        std::vector<size_t> batch_index;
+        detections.assign(frames.size(), {});
+        for (size_t i = 0; i < frames.size(); ++i) {
+            if (reduced[i]) {
+                detections[i] = detectReduced(processed_frames[i], frames[i].size());
+            } else {
+                batch.push_back(processed_frames[i]);
+                batch_index.push_back(i);
             }
         }
-        
-        // Update object tracking before saving photo
-        if (!target_detections.empty()) {
-            detector_->updateTracking(target_detections);
-            // Enrich detections with stationary status from tracked objects
-            detector_->enrichDetectionsWithStationaryStatus(target_detections);
+        if (!batch.empty()) {
+            auto batch_detections = detector_->detectObjectsBatch(batch);
+            if (batch_detections.size() != batch.size()) {
+                return false;
+            }
+            for (size_t k = 0; k < batch.size(); ++k) {
+                detections[batch_index[k]] = std::move(batch_detections[k]);
+            }
         }
+        recordInferenceTime(std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count() / frames.size());
+        return true;
         
-        // Enrich all detections with stationary status for viewfinder and network stream
-        if (!result.detections.empty()) {
-            detector_->enrichDetectionsWithStationaryStatus(result.detections);
+    } catch (const std::exception& e) {
+        logger_->error("Error processing frame batch: " + std::string(e.what()));
+        return false;
+    }
+}
+
+std::vector<Detection> ParallelFrameProcessor::detectReduced(const cv::Mat& prepared, const cv::Size& frame_size) {
+    // As a whole-image region the frame is inferred as is, without the scale factor applied again
+    auto detections = detector_->detectObjectsInRegions(prepared, {cv::Rect(0, 0, prepared.cols, prepared.rows)});
+    mapFromDetectionResolution(detections, prepared.size(), frame_size);
+    return detections;
+}
+
+cv::Mat ParallelFrameProcessor::prepareFrame(const cv::Mat& frame, std::vector<cv::Rect>& regions,
+                                             std::vector<cv::Point>& origins, bool& reduced, bool batched) {
+    // Apply brightness filter if enabled and high brightness is detected
+    reduced = false;
+    cv::Mat prepared = frame;
+    bool high_brightness = enable_brightness_filter_ && detectHighBrightness(frame);
+    brightness_filter_active_ = high_brightness;
+    if (!regions.empty() && (high_brightness || zones_)) {
+        // Region crops are inferred at native resolution, so only they are filtered and
+        // masked, stacked one above the other instead of copied into a full frame
+        const cv::Rect bounds(0, 0, frame.cols, frame.rows);
+        std::vector<cv::Rect> crops;
+        cv::Size packed_size;
+        for (const auto& region : regions) {
+            cv::Rect crop = region & bounds;
+            if (!crop.empty()) {
+                crops.push_back(crop);
+                packed_size.width = std::max(packed_size.width, crop.width);
+                packed_size.height += crop.height;
+            }
         }
-        
-        // Save photo with bounding boxes if we have target detections
-        if (!target_detections.empty()) {
-            saveDetectionPhoto(frame, target_detections, detector_);
+        if (crops.empty()) {
+            return prepared;  // Nothing in view to infer
+        }
+        regions.clear();
+        origins.clear();
+        prepared = cv::Mat(packed_size, frame.type());
+        for (const auto& crop : crops) {
+            cv::Rect place(0, regions.empty() ? 0 : regions.back().y + regions.back().height, crop.width, crop.height);
+            cv::Mat target = prepared(place);
+            if (high_brightness) {
+                applyBrightnessFilter(frame(crop), target);
+            } else {
+                frame(crop).copyTo(target);
+            }
+            if (zones_) {
+                cv::bitwise_and(target, zones_->getMask(frame.size(), frame.channels())(crop), target);
+            }
+            regions.push_back(place);
+            origins.push_back(crop.tl());
+        }
+    } else if (high_brightness || zones_) {
+        // Filter and mask the copy the network actually sees rather than the full camera frame;
+        // tiles are cut from the full frame, so they still need it at full resolution
+        bool reduce = !tiled_ && (high_brightness || !batched);
+        cv::Size detection_size = reduce ? detector_->getDetectionResolution(frame.size()) : frame.size();
+        if (detection_size != frame.size()) {
+            cv::resize(frame, prepared, detection_size, 0, 0, cv::INTER_AREA);
+            reduced = true;
+        }
+        if (high_brightness) {
+            cv::Mat filtered;
+            applyBrightnessFilter(prepared, filtered);
+            prepared = filtered;
+        }
+        if (zones_) {
+            // Black out excluded pixels so the network has nothing to find there;
+            // in place unless prepared is still the caller's frame
+            if (prepared.data == frame.data) {
+                cv::Mat masked;
+                zones_->applyMask(prepared, masked);
+                prepared = masked;
+            } else {
+                zones_->applyMask(prepared, prepared);
+            }
         }
-        
-    } catch (const std::exception& e) {
-        logger_->error("Error processing frame: " + std::string(e.what()));
-        result.processed = false;
+    }
+    return prepared;
+}
+
+void ParallelFrameProcessor::applyTrackingStage(const cv::Mat& frame, const FullResolutionSource* source,
+                                                FrameResult& result) {
+    // Drop detections outside the analyzed area before anything acts on them
+    int decode_scale = source ? std::max(1, source->decode_scale) : 1;
+    cv::Size camera_size(frame.cols * decode_scale, frame.rows * decode_scale);
+    if (zones_) {
+        result.detections = zones_->filter(result.detections, camera_size);
     }
     
-    return result;
+    // Filter for target classes and log detections
+    std::vector<Detection> target_detections;
+    for (const auto& detection : result.detections) {
+        if (detector_->isTargetClass(detection)) {
+            target_detections.push_back(detection);
+            
+            // Log detection with center coordinates
+            cv::Point2f center(
+                detection.bbox.x + detection.bbox.width / 2.0f,
+                detection.bbox.y + detection.bbox.height / 2.0f
+            );
+            logger_->info("detected " + ClassRegistry::name(detection.class_id) + " at coordinates: (" + 
+                         std::to_string(static_cast<int>(center.x)) + ", " + 
+                         std::to_string(static_cast<int>(center.y)) + ") with confidence " + 
+                         std::to_string(static_cast<int>(detection.confidence * 100)) + "%");
+        }
+    }
+    
+    // Update object tracking before saving photo; an empty frame still counts as a miss for every track
+    detector_->updateTracking(target_detections, result.capture_time);
+    if (roi_extractor_) {
+        // Objects that stop moving fade into the background model; keep inferring them until they exit
+        std::lock_guard<std::mutex> lock(track_regions_mutex_);
+        track_regions_.clear();
+        for (const auto& tracked : detector_->getTrackedObjects()) {
+            track_regions_.push_back(tracked.bbox);
+        }
+    }
+    if (flow_tracker_) {
+        // The frames up to the next inference follow the tracks from here
+        detector_->presentTrackBoxes(flow_boxes_);
+        flow_tracker_->setKeyframe(flowInput(frame), flow_boxes_, camera_size);
+    }
+    if (!target_detections.empty()) {
+        // Enrich detections with stationary status from tracked objects
+        detector_->enrichDetectionsWithStationaryStatus(target_detections);
+    }
+    
+    // Enrich all detections with stationary status for viewfinder and network stream
+    if (!result.detections.empty()) {
+        detector_->enrichDetectionsWithStationaryStatus(result.detections);
+    }
+    
+    // Save photo with bounding boxes if we have target detections
+    if (!target_detections.empty()) {
+        saveDetectionPhoto(frame, source, target_detections, detector_);
+    }
+    
+    // Moving objects in view keep the motion gate open even if the scene looks still
+    int moving_objects = 0;
+    for (const auto& detection : target_detections) {
+        if (!detection.is_stationary) {
+            moving_objects++;
+        }
+    }
+    moving_objects_ = moving_objects;
+    
+    // Snapshot tracker state for consumers on other threads
+    result.tracked_objects = detector_->shareTrackedObjects();
+}
+
+void ParallelFrameProcessor::mapFromDetectionResolution(std::vector<Detection>& detections,
+                                                        const cv::Size& detection_size, const cv::Size& frame_size) {
+    if (detection_size == frame_size || detection_size.width <= 0 || detection_size.height <= 0) {
+        return;
+    }
+    // Each axis has its own factor: rounding the reduced size to whole pixels
+    // leaves the two aspect ratios slightly apart
+    const double scale_x = static_cast<double>(frame_size.width) / detection_size.width;
+    const double scale_y = static_cast<double>(frame_size.height) / detection_size.height;
+    for (auto& detection : detections) {
+        const cv::Rect& box = detection.bbox;
+        detection.bbox = cv::Rect(static_cast<int>(std::lround(box.x * scale_x)),
+                                  static_cast<int>(std::lround(box.y * scale_y)),
+                                  static_cast<int>(std::lround(box.width * scale_x)),
+                                  static_cast<int>(std::lround(box.height * scale_y)));
+    }
+}
+
+void ParallelFrameProcessor::mapToFullResolution(std::vector<Detection>& detections, int decode_scale) {
+    if (decode_scale <= 1) {
+        return;
+    }
+    for (auto& detection : detections) {
+        detection.bbox = cv::Rect(detection.bbox.x * decode_scale, detection.bbox.y * decode_scale,
+                                  detection.bbox.width * decode_scale, detection.bbox.height * decode_scale);
+    }
 }
 
 int ParallelFrameProcessor::getTotalImagesSaved() const {
     return total_images_saved_;
 }
 
-bool ParallelFrameProcessor::detectHighBrightness(const cv::Mat& frame) {
-    // Convert to grayscale for brightness analysis
-    cv::Mat gray;
-    if (frame.channels() == 3) {
-        cv::cvtColor(frame, gray, cv::COLOR_BGR2GRAY);
-    } else {
-        gray = frame;
+double ParallelFrameProcessor::estimateBrightness(const cv::Mat& frame, int stride) {
+    if (frame.empty() || frame.depth() != CV_8U) {
+        return 0.0;
     }
-    
-    // Calculate mean brightness
-    cv::Scalar mean_brightness = cv::mean(gray);
-    double avg_brightness = mean_brightness[0];
+    stride = std::max(1, stride);
+    const int channels = frame.channels();
+    uint64_t sum = 0;
+    uint64_t samples = 0;
+    for (int y = std::min(stride / 2, frame.rows - 1); y < frame.rows; y += stride) {
+        const uchar* row = frame.ptr<uchar>(y);
+        for (int x = std::min(stride / 2, frame.cols - 1); x < frame.cols; x += stride) {
+            const uchar* pixel = row + x * channels;
+            // BT.601 luma in 8-bit fixed point, the weights cv::COLOR_BGR2GRAY uses
+            sum += channels >= 3 ? (29u * pixel[0] + 150u * pixel[1] + 77u * pixel[2] + 128u) >> 8 : pixel[0];
+            samples++;
+        }
+    }
+    return static_cast<double>(sum) / samples;
+}
+
+bool ParallelFrameProcessor::detectHighBrightness(const cv::Mat& frame) {
+    // A sparse sample is plenty for a frame-wide mean and avoids a full grayscale conversion
+    double avg_brightness = estimateBrightness(frame);
     
     // High brightness threshold (on 0-255 scale, values above 180 indicate very bright conditions)
     const double HIGH_BRIGHTNESS_THRESHOLD = 180.0;
@@ -464,36 +1075,34 @@ bool ParallelFrameProcessor::detectHighBrightness(const cv::Mat& frame) {
     return false;
 }
 
-cv::Mat ParallelFrameProcessor::applyBrightnessFilter(const cv::Mat& frame) {
-    cv::Mat filtered = frame.clone();
-    
-    // Apply CLAHE (Contrast Limited Adaptive Histogram Equalization) to reduce glare
-    // This helps reduce the impact of reflections while preserving details
-    cv::Mat lab;
-    cv::cvtColor(filtered, lab, cv::COLOR_BGR2Lab);
+void ParallelFrameProcessor::applyBrightnessFilter(const cv::Mat& frame, cv::Mat& filtered) {
+    // CLAHE objects keep working buffers, so each inference thread builds its own
+    // once; the gamma table never changes
+    thread_local cv::Ptr<cv::CLAHE> clahe = cv::createCLAHE(2.0, cv::Size(8, 8));
+    thread_local cv::Mat lab;
+    thread_local cv::Mat lightness;
+    static const cv::Mat gamma_lut = [] {
+        const double gamma = 0.7;
+        cv::Mat lut(1, 256, CV_8U);
+        uchar* p = lut.ptr();
+        for (int i = 0; i < 256; ++i) {
+            p[i] = cv::saturate_cast<uchar>(std::pow(i / 255.0, gamma) * 255.0);
+        }
+        return lut;
+    }();
     
-    // Split into L, a, b channels
-    std::vector<cv::Mat> lab_channels;
-    cv::split(lab, lab_channels);
+    // Apply CLAHE (Contrast Limited Adaptive Histogram Equalization) to the L channel
+    // to reduce glare while preserving details
+    cv::cvtColor(frame, lab, cv::COLOR_BGR2Lab);
+    cv::extractChannel(lab, lightness, 0);
+    clahe->apply(lightness, lightness);
     
-    // Apply CLAHE to the L channel (lightness)
-    cv::Ptr<cv::CLAHE> clahe = cv::createCLAHE(2.0, cv::Size(8, 8));
-    clahe->apply(lab_channels[0], lab_channels[0]);
+    // Gamma correction against overexposure, fused into the same pass over the
+    // lightness plane instead of a LUT over all three BGR channels afterwards
+    cv::LUT(lightness, gamma_lut, lightness);
     
-    // Merge channels back
-    cv::merge(lab_channels, lab);
+    cv::insertChannel(lightness, lab, 0);
     cv::cvtColor(lab, filtered, cv::COLOR_Lab2BGR);
     
-    // Apply gamma correction to reduce overexposure
-    // Gamma < 1 darkens the image, reducing bright spots
-    const double gamma = 0.7;
-    cv::Mat lut(1, 256, CV_8U);
-    uchar* p = lut.ptr();
-    for (int i = 0; i < 256; ++i) {
-        p[i] = cv::saturate_cast<uchar>(pow(i / 255.0, gamma) * 255.0);
-    }
-    cv::LUT(filtered, lut, filtered);
-    
     logger_->debug("Applied brightness filter to reduce reflections");
-    return filtered;
-}
\ No newline at end of file
+}
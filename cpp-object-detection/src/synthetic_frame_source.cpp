@@ -0,0 +1,106 @@
+#include "synthetic_frame_source.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+
+SyntheticFrameSource::SyntheticFrameSource(int width, int height, FramePacing pacing, double fps, int frame_limit,
+                                           std::shared_ptr<Logger> logger)
+    : width_(width), height_(height), pacing_(pacing), fps_(fps > 0.0 ? fps : DEFAULT_FPS),
+      frame_limit_(frame_limit), logger_(logger), frames_generated_(0), initialized_(false) {
+}
+
+bool SyntheticFrameSource::initialize() {
+    if (initialized_) {
+        return true;
+    }
+    if (width_ <= 0 || height_ <= 0) {
+        logger_->error("Invalid synthetic frame size: " + std::to_string(width_) + "x" + std::to_string(height_));
+        return false;
+    }
+
+    // Vertical gradient background, drawn once and copied into every frame
+    background_.create(height_, width_, CV_8UC3);
+    for (int y = 0; y < height_; ++y) {
+        uchar level = static_cast<uchar>(60 + (120 * y) / height_);
+        background_.row(y).setTo(cv::Scalar(level, level, level));
+    }
+
+    // Same seed every run: identical scenes make benchmark runs comparable
+    std::mt19937 rng(SCENE_SEED);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    objects_.clear();
+    for (int i = 0; i < OBJECT_COUNT; ++i) {
+        MovingObject object;
+        object.size = cv::Size(std::max(8, static_cast<int>(width_ * (0.06f + 0.10f * unit(rng)))),
+                               std::max(8, static_cast<int>(height_ * (0.10f + 0.20f * unit(rng)))));
+        object.position = cv::Point2f(unit(rng) * (width_ - object.size.width),
+                                      unit(rng) * (height_ - object.size.height));
+        float speed = 0.004f * width_ + 0.01f * width_ * unit(rng);  // Crosses the frame in a few seconds
+        float angle = 6.2831853f * unit(rng);
+        object.velocity = cv::Point2f(speed * std::cos(angle), speed * std::sin(angle));
+        object.color = cv::Scalar(40 + 200 * unit(rng), 40 + 200 * unit(rng), 40 + 200 * unit(rng));
+        objects_.push_back(object);
+    }
+
+    pacer_.configure(pacing_, fps_);
+    frames_generated_ = 0;
+    initialized_ = true;
+    return true;
+}
+
+bool SyntheticFrameSource::isExhausted() const {
+    return frame_limit_ > 0 && frames_generated_ >= static_cast<uint64_t>(frame_limit_);
+}
+
+bool SyntheticFrameSource::captureFrame(cv::Mat& frame) {
+    if (!initialized_ || isExhausted()) {
+        return false;
+    }
+
+    pacer_.wait();
+    background_.copyTo(frame);
+    for (const auto& object : objects_) {
+        cv::Rect box(cv::Point(static_cast<int>(object.position.x), static_cast<int>(object.position.y)), object.size);
+        cv::rectangle(frame, box, object.color, cv::FILLED);
+    }
+    advanceObjects();
+    frames_generated_++;
+    return true;
+}
+
+void SyntheticFrameSource::advanceObjects() {
+    for (auto& object : objects_) {
+        object.position += object.velocity;
+
+        // Bounce off the frame edges
+        float max_x = static_cast<float>(width_ - object.size.width);
+        float max_y = static_cast<float>(height_ - object.size.height);
+        if (object.position.x < 0.0f || object.position.x > max_x) {
+            object.velocity.x = -object.velocity.x;
+            object.position.x = std::min(std::max(object.position.x, 0.0f), max_x);
+        }
+        if (object.position.y < 0.0f || object.position.y > max_y) {
+            object.velocity.y = -object.velocity.y;
+            object.position.y = std::min(std::max(object.position.y, 0.0f), max_y);
+        }
+    }
+}
+
+std::string SyntheticFrameSource::getSourceInfo() const {
+    std::stringstream ss;
+    ss << "Synthetic source: " << width_ << "x" << height_ << ", " << OBJECT_COUNT << " moving objects";
+    if (pacing_ == FramePacing::REAL_TIME) {
+        ss << " @ " << fps_ << " fps";
+    } else {
+        ss << ", unpaced";
+    }
+    if (frame_limit_ > 0) {
+        ss << ", " << frame_limit_ << " frames";
+    }
+    return ss.str();
+}
+
+void SyntheticFrameSource::release() {
+    initialized_ = false;
+}
@@ -0,0 +1,285 @@
+#include "tiled_inference.hpp"
+#include "nms_engine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+struct FusionBox {
+    Detection detection;
+    std::vector<cv::Rect> sources;  // Tiles (frame-sized for the full-frame pass) the box was built from
+    bool cut_left = false;    // Box ends on an edge of its tile that lies inside the frame
+    bool cut_right = false;
+    bool cut_top = false;
+    bool cut_bottom = false;
+};
+
+// Shared extent of [a0, a1) and [b0, b1) over the shorter of the two
+float alignment(int a0, int a1, int b0, int b1) {
+    int shared = std::min(a1, b1) - std::max(a0, b0);
+    int shorter = std::min(a1 - a0, b1 - b0);
+    return shorter > 0 ? static_cast<float>(std::max(0, shared)) / shorter : 0.0f;
+}
+
+}  // namespace
+
+TiledInference::TiledInference(std::shared_ptr<ObjectDetector> detector,
+                               std::shared_ptr<Logger> logger,
+                               const Options& options,
+                               int tile_size)
+    : detector_(detector), logger_(logger), options_(options), tile_size_(std::max(32, tile_size)),
+      next_frame_(0), frames_(0), tiles_inferred_(0), fused_boxes_(0) {
+    options_.tile_interval = std::max(1, options_.tile_interval);
+    options_.overlap = std::max(0.0, std::min(options_.overlap, 0.5));
+}
+
+std::vector<cv::Rect> TiledInference::computeTiles(const cv::Size& frame_size, int columns, int rows,
+                                                   int tile_size, double overlap) {
+    overlap = std::max(0.0, std::min(overlap, 0.5));
+
+    // Start and extent of each tile along one axis, evenly spread so the
+    // first and last tiles sit on the frame border
+    auto layoutAxis = [overlap, tile_size](int length, int count) {
+        auto extentFor = [length, overlap](int n) {
+            return std::min(length, static_cast<int>(std::ceil(length / (n - (n - 1) * overlap))));
+        };
+        if (count <= 0) {
+            count = 1;
+            while (extentFor(count) > tile_size && count < length) {
+                count++;
+            }
+        }
+        int extent = extentFor(count);
+        std::vector<std::pair<int, int>> spans;
+        for (int i = 0; i < count; ++i) {
+            double step = count > 1 ? static_cast<double>(length - extent) / (count - 1) : 0.0;
+            int start = static_cast<int>(std::lround(i * step));
+            spans.emplace_back(start, extent);
+        }
+        return spans;
+    };
+
+    std::vector<cv::Rect> tiles;
+    if (frame_size.width <= 0 || frame_size.height <= 0) {
+        return tiles;
+    }
+    auto x_spans = layoutAxis(frame_size.width, columns);
+    auto y_spans = layoutAxis(frame_size.height, rows);
+    tiles.reserve(x_spans.size() * y_spans.size());
+    for (const auto& [y, height] : y_spans) {
+        for (const auto& [x, width] : x_spans) {
+            tiles.emplace_back(x, y, width, height);
+        }
+    }
+    return tiles;
+}
+
+bool TiledInference::isTileDue(int tile_index, uint64_t frame_index, int tile_interval,
+                               const std::vector<int>& every_frame_tiles) {
+    if (tile_interval <= 1 ||
+        std::find(every_frame_tiles.begin(), every_frame_tiles.end(), tile_index) != every_frame_tiles.end()) {
+        return true;
+    }
+    // Staggered so each frame runs about 1/tile_interval of the remaining tiles
+    return (frame_index + static_cast<uint64_t>(tile_index)) % static_cast<uint64_t>(tile_interval) == 0;
+}
+
+std::vector<Detection> TiledInference::detect(const cv::Mat& frame) {
+    if (frame.empty()) {
+        return {};
+    }
+    frames_++;
+
+    std::vector<int> due;
+    std::vector<cv::Rect> due_tiles;
+    std::vector<TileDetection> candidates;
+    cv::Size layout;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        if (frame.size() != layout_size_) {
+            tiles_ = computeTiles(frame.size(), options_.columns, options_.rows, tile_size_, options_.overlap);
+            last_results_.assign(tiles_.size(), {});
+            layout_size_ = frame.size();
+            next_frame_ = 0;
+            logger_->info("Tiled inference: " + std::to_string(tiles_.size()) + " tiles of " +
+                          std::to_string(tiles_.front().width) + "x" + std::to_string(tiles_.front().height) +
+                          " over " + std::to_string(frame.cols) + "x" + std::to_string(frame.rows) + " frames");
+            for (int index : options_.every_frame_tiles) {
+                if (index < 0 || index >= static_cast<int>(tiles_.size())) {
+                    logger_->warning("Tile " + std::to_string(index) + " listed for every frame does not exist");
+                }
+            }
+        }
+        layout = layout_size_;
+
+        uint64_t frame_index = next_frame_++;
+        for (size_t i = 0; i < tiles_.size(); ++i) {
+            if (isTileDue(static_cast<int>(i), frame_index, options_.tile_interval, options_.every_frame_tiles)) {
+                due.push_back(static_cast<int>(i));
+                due_tiles.push_back(tiles_[i]);
+            } else {
+                for (const auto& detection : last_results_[i]) {
+                    candidates.push_back(TileDetection{detection, tiles_[i]});
+                }
+            }
+        }
+    }
+
+    // Task 0 is the full-frame pass at the normal detection scale, the rest are
+    // tiles. They run on the calling worker; concurrency comes from the frame
+    // processor's workers, each checking replicas out of the detector's pool
+    const size_t task_count = due_tiles.size() + 1;
+    std::vector<std::vector<Detection>> results(task_count);
+    results[0] = detector_->detectObjects(frame);
+    for (size_t task = 1; task < task_count; ++task) {
+        results[task] = detector_->detectObjectsInRegions(frame, {due_tiles[task - 1]});
+    }
+    tiles_inferred_ += due_tiles.size();
+
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        if (layout_size_ == layout) {
+            for (size_t k = 0; k < due.size(); ++k) {
+                last_results_[due[k]] = results[k + 1];
+            }
+        }
+    }
+
+    const cv::Rect whole_frame(0, 0, frame.cols, frame.rows);
+    for (const auto& detection : results[0]) {
+        candidates.push_back(TileDetection{detection, whole_frame});
+    }
+    for (size_t k = 0; k < due_tiles.size(); ++k) {
+        for (const auto& detection : results[k + 1]) {
+            candidates.push_back(TileDetection{detection, due_tiles[k]});
+        }
+    }
+
+    uint64_t fused = 0;
+    auto detections = fuseDetections(std::move(candidates), frame.size(), &fused);
+    fused_boxes_ += fused;
+    return detections;
+}
+
+std::vector<Detection> TiledInference::fuseDetections(std::vector<TileDetection> candidates,
+                                                      const cv::Size& frame_size, uint64_t* fused_count) {
+    std::vector<FusionBox> boxes;
+    boxes.reserve(candidates.size());
+    for (auto& candidate : candidates) {
+        FusionBox box;
+        const cv::Rect& b = candidate.detection.bbox;
+        const cv::Rect& tile = candidate.tile;
+        box.cut_left = tile.x > 0 && b.x <= tile.x + SEAM_MARGIN;
+        box.cut_right = tile.x + tile.width < frame_size.width && b.x + b.width >= tile.x + tile.width - SEAM_MARGIN;
+        box.cut_top = tile.y > 0 && b.y <= tile.y + SEAM_MARGIN;
+        box.cut_bottom = tile.y + tile.height < frame_size.height &&
+                         b.y + b.height >= tile.y + tile.height - SEAM_MARGIN;
+        box.sources.push_back(tile);
+        box.detection = std::move(candidate.detection);
+        boxes.push_back(std::move(box));
+    }
+    std::stable_sort(boxes.begin(), boxes.end(), [](const FusionBox& a, const FusionBox& b) {
+        return a.detection.confidence > b.detection.confidence;
+    });
+
+    auto belongTogether = [](const FusionBox& a, const FusionBox& b) {
+        const cv::Rect& ra = a.detection.bbox;
+        const cv::Rect& rb = b.detection.bbox;
+        // Each source already ran its own NMS, so boxes it kept apart are separate objects;
+        // a duplicate can only come from another source covering the same spot
+        const cv::Rect shared_box = ra & rb;
+        bool in_band = false;
+        for (const auto& source_a : a.sources) {
+            for (const auto& source_b : b.sources) {
+                if (source_a == source_b) {
+                    return false;
+                }
+                in_band = in_band || !(shared_box & source_a & source_b).empty();
+            }
+        }
+        if (in_band && NmsEngine::iou(ra, rb) >= DUPLICATE_IOU) {
+            return true;
+        }
+        int smaller = std::min(ra.area(), rb.area());
+        if (in_band && smaller > 0 && static_cast<float>(shared_box.area()) / smaller >= CONTAINED_FRACTION) {
+            return true;
+        }
+        // Two halves of an object cut by a vertical seam: they meet across it and line up vertically
+        bool meet_x = ra.x <= rb.x + rb.width && rb.x <= ra.x + ra.width;
+        if (meet_x && ((a.cut_right && b.cut_left) || (a.cut_left && b.cut_right)) &&
+            alignment(ra.y, ra.y + ra.height, rb.y, rb.y + rb.height) >= SEAM_ALIGNMENT) {
+            return true;
+        }
+        bool meet_y = ra.y <= rb.y + rb.height && rb.y <= ra.y + ra.height;
+        return meet_y && ((a.cut_bottom && b.cut_top) || (a.cut_top && b.cut_bottom)) &&
+               alignment(ra.x, ra.x + ra.width, rb.x, rb.x + rb.width) >= SEAM_ALIGNMENT;
+    };
+
+    // Merging grows boxes, which can make them fuse with further boxes, so repeat until stable
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            for (size_t j = i + 1; j < boxes.size();) {
+                if (boxes[i].detection.class_id != boxes[j].detection.class_id ||
+                    !belongTogether(boxes[i], boxes[j])) {
+                    ++j;
+                    continue;
+                }
+                FusionBox& keep = boxes[i];
+                const FusionBox& other = boxes[j];
+                const cv::Rect a = keep.detection.bbox;
+                const cv::Rect b = other.detection.bbox;
+                // The merged box is cut on a side only if the box reaching furthest there was
+                auto cutAt = [](int edge_a, int edge_b, bool cut_a, bool cut_b) {
+                    return edge_a == edge_b ? (cut_a && cut_b) : (edge_a > edge_b ? cut_a : cut_b);
+                };
+                keep.cut_left = cutAt(-a.x, -b.x, keep.cut_left, other.cut_left);
+                keep.cut_top = cutAt(-a.y, -b.y, keep.cut_top, other.cut_top);
+                keep.cut_right = cutAt(a.x + a.width, b.x + b.width, keep.cut_right, other.cut_right);
+                keep.cut_bottom = cutAt(a.y + a.height, b.y + b.height, keep.cut_bottom, other.cut_bottom);
+                keep.sources.insert(keep.sources.end(), other.sources.begin(), other.sources.end());
+                keep.detection.bbox = a | b;
+                keep.detection.confidence = std::max(keep.detection.confidence, other.detection.confidence);
+                boxes.erase(boxes.begin() + static_cast<std::ptrdiff_t>(j));
+                if (fused_count) {
+                    (*fused_count)++;
+                }
+                merged = true;
+            }
+        }
+    }
+
+    std::vector<Detection> detections;
+    detections.reserve(boxes.size());
+    for (auto& box : boxes) {
+        detections.push_back(std::move(box.detection));
+    }
+    return detections;
+}
+
+TiledInference::Stats TiledInference::getStats() const {
+    Stats stats;
+    stats.frames = frames_.load();
+    if (stats.frames > 0) {
+        stats.avg_tiles_per_frame = static_cast<double>(tiles_inferred_.load()) / stats.frames;
+    }
+    stats.fused_boxes = fused_boxes_.load();
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        stats.tile_count = static_cast<int>(tiles_.size());
+    }
+    return stats;
+}
+
+void TiledInference::logStats() const {
+    Stats stats = getStats();
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1)
+         << "Tiled inference: " << stats.avg_tiles_per_frame << " of " << stats.tile_count
+         << " tiles inferred per frame over " << stats.frames << " frames, "
+         << stats.fused_boxes << " overlapping or seam-split boxes fused";
+    logger_->info(line.str());
+}
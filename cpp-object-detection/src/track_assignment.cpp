@@ -0,0 +1,212 @@
+#include "track_assignment.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+TrackAssignment::GridIndex::GridIndex(float cell_size) : cell_size_(std::max(1.0f, cell_size)) {
+}
+
+int32_t TrackAssignment::GridIndex::cellOf(float coordinate) const {
+    return static_cast<int32_t>(std::floor(coordinate / cell_size_));
+}
+
+int64_t TrackAssignment::GridIndex::cellKey(int32_t column, int32_t row) {
+    return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(column)) << 32) |
+                                static_cast<uint32_t>(row));
+}
+
+void TrackAssignment::GridIndex::insert(const cv::Point2f& point, int id) {
+    std::pair<int64_t, int> entry(cellKey(cellOf(point.x), cellOf(point.y)), id);
+    entries_.insert(std::upper_bound(entries_.begin(), entries_.end(), entry), entry);
+}
+
+void TrackAssignment::GridIndex::query(const cv::Point2f& point, std::vector<int>& ids) const {
+    ids.clear();
+    const int32_t column = cellOf(point.x);
+    const int32_t row = cellOf(point.y);
+    for (int32_t dy = -1; dy <= 1; ++dy) {
+        for (int32_t dx = -1; dx <= 1; ++dx) {
+            const int64_t key = cellKey(column + dx, row + dy);
+            auto it = std::lower_bound(entries_.begin(), entries_.end(), std::make_pair(key, INT_MIN));
+            for (; it != entries_.end() && it->first == key; ++it) {
+                ids.push_back(it->second);
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+void TrackAssignment::solve(int rows, int columns, const std::vector<Edge>& edges, Workspace& workspace,
+                            std::vector<int>& assignment) {
+    assignment.assign(std::max(0, rows), -1);
+    if (rows <= 0 || columns <= 0 || edges.empty()) {
+        return;
+    }
+
+    // Group rows and columns linked by edges; columns follow the rows in one id space
+    const int nodes = rows + columns;
+    std::vector<int>& parent = workspace.parent;
+    parent.resize(nodes);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int node) {
+        while (parent[node] != node) {
+            parent[node] = parent[parent[node]];
+            node = parent[node];
+        }
+        return node;
+    };
+    for (const auto& edge : edges) {
+        parent[find(edge.row)] = find(rows + edge.column);
+    }
+
+    // Counting sort of the edges by group into one flat list; afterwards
+    // group_offsets[g] is where group g ends and group g + 1 starts
+    std::vector<int>& offsets = workspace.group_offsets;
+    offsets.assign(nodes + 1, 0);
+    for (const auto& edge : edges) {
+        offsets[find(edge.row) + 1]++;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    workspace.grouped_edges.resize(edges.size());
+    for (size_t e = 0; e < edges.size(); ++e) {
+        workspace.grouped_edges[offsets[find(edges[e].row)]++] = static_cast<int>(e);
+    }
+
+    workspace.local_row.assign(rows, -1);
+    workspace.local_column.assign(columns, -1);
+    std::vector<int>& group_rows = workspace.group_rows;
+    std::vector<int>& group_columns = workspace.group_columns;
+    std::vector<double>& cost = workspace.cost;
+    int group_start = 0;
+    for (int group = 0; group < nodes; ++group) {
+        const int group_end = offsets[group];
+        const int* group_edges = workspace.grouped_edges.data() + group_start;
+        const int group_size = group_end - group_start;
+        group_start = group_end;
+        if (group_size == 0) {
+            continue;
+        }
+        if (group_size == 1) {
+            assignment[edges[group_edges[0]].row] = edges[group_edges[0]].column;
+            continue;
+        }
+
+        group_rows.clear();
+        group_columns.clear();
+        for (int i = 0; i < group_size; ++i) {
+            const Edge& edge = edges[group_edges[i]];
+            if (workspace.local_row[edge.row] < 0) {
+                workspace.local_row[edge.row] = static_cast<int>(group_rows.size());
+                group_rows.push_back(edge.row);
+            }
+            if (workspace.local_column[edge.column] < 0) {
+                workspace.local_column[edge.column] = static_cast<int>(group_columns.size());
+                group_columns.push_back(edge.column);
+            }
+        }
+
+        // The Hungarian step needs no more rows than columns, so solve the transpose if necessary
+        const bool transpose = group_rows.size() > group_columns.size();
+        const int n = static_cast<int>(transpose ? group_columns.size() : group_rows.size());
+        const int m = static_cast<int>(transpose ? group_rows.size() : group_columns.size());
+        cost.assign(static_cast<size_t>(n) * m, FORBIDDEN_COST);
+        for (int i = 0; i < group_size; ++i) {
+            const Edge& edge = edges[group_edges[i]];
+            int r = workspace.local_row[edge.row];
+            int c = workspace.local_column[edge.column];
+            cost[transpose ? static_cast<size_t>(c) * m + r : static_cast<size_t>(r) * m + c] = edge.cost;
+        }
+
+        hungarian(cost, n, m, workspace, workspace.matched);
+        for (int i = 0; i < n; ++i) {
+            int j = workspace.matched[i];
+            if (j < 0 || cost[static_cast<size_t>(i) * m + j] >= FORBIDDEN_COST) {
+                continue;  // Only a forbidden pair was left for this one
+            }
+            if (transpose) {
+                assignment[group_rows[j]] = group_columns[i];
+            } else {
+                assignment[group_rows[i]] = group_columns[j];
+            }
+        }
+
+        for (int row : group_rows) {
+            workspace.local_row[row] = -1;
+        }
+        for (int column : group_columns) {
+            workspace.local_column[column] = -1;
+        }
+    }
+}
+
+void TrackAssignment::hungarian(const std::vector<double>& cost, int rows, int columns, Workspace& workspace,
+                                std::vector<int>& assignment) {
+    // Shortest augmenting paths with row and column potentials; index 0 is a virtual start column
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::vector<double>& row_potential = workspace.row_potential;
+    std::vector<double>& column_potential = workspace.column_potential;
+    std::vector<int>& column_owner = workspace.column_owner;        // 1-based row holding each column, 0 if free
+    std::vector<int>& previous_column = workspace.previous_column;
+    std::vector<double>& slack = workspace.slack;
+    std::vector<char>& visited = workspace.visited;
+    row_potential.assign(rows + 1, 0.0);
+    column_potential.assign(columns + 1, 0.0);
+    column_owner.assign(columns + 1, 0);
+    previous_column.assign(columns + 1, 0);
+    slack.resize(columns + 1);
+    visited.resize(columns + 1);
+
+    for (int row = 1; row <= rows; ++row) {
+        column_owner[0] = row;
+        int current = 0;
+        std::fill(slack.begin(), slack.end(), infinity);
+        std::fill(visited.begin(), visited.end(), 0);
+        do {
+            visited[current] = 1;
+            const int owner = column_owner[current];
+            double delta = infinity;
+            int next = 0;
+            for (int column = 1; column <= columns; ++column) {
+                if (visited[column]) {
+                    continue;
+                }
+                double reduced = cost[static_cast<size_t>(owner - 1) * columns + (column - 1)] -
+                                 row_potential[owner] - column_potential[column];
+                if (reduced < slack[column]) {
+                    slack[column] = reduced;
+                    previous_column[column] = current;
+                }
+                if (slack[column] < delta) {
+                    delta = slack[column];
+                    next = column;
+                }
+            }
+            for (int column = 0; column <= columns; ++column) {
+                if (visited[column]) {
+                    row_potential[column_owner[column]] += delta;
+                    column_potential[column] -= delta;
+                } else {
+                    slack[column] -= delta;
+                }
+            }
+            current = next;
+        } while (column_owner[current] != 0);
+
+        // Flip the augmenting path back to the start
+        do {
+            const int previous = previous_column[current];
+            column_owner[current] = column_owner[previous];
+            current = previous;
+        } while (current != 0);
+    }
+
+    assignment.assign(rows, -1);
+    for (int column = 1; column <= columns; ++column) {
+        if (column_owner[column] != 0) {
+            assignment[column_owner[column] - 1] = column - 1;
+        }
+    }
+}
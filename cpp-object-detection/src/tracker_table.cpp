@@ -0,0 +1,35 @@
+#include "tracker_table.hpp"
+#include <algorithm>
+
+TrackerTable::TrackerTable(size_t capacity)
+    : ids(capacity, 0), class_ids(capacity, -1), centers(capacity), previous_centers(capacity), boxes(capacity),
+      confidences(capacity, 0.0f), motions(capacity), last_detection_times(capacity), histories(capacity),
+      frames_since_detection(capacity, 0), flags(capacity, 0), stationary_since(capacity) {
+    active_.reserve(capacity);
+    free_.reserve(capacity);
+    // Lowest slots are handed out first
+    for (size_t slot = capacity; slot > 0; --slot) {
+        free_.push_back(static_cast<int>(slot - 1));
+    }
+}
+
+int TrackerTable::acquire() {
+    if (free_.empty()) {
+        return -1;
+    }
+    int slot = free_.back();
+    free_.pop_back();
+    active_.push_back(slot);
+    histories[slot].clear();
+    flags[slot] = 0;
+    frames_since_detection[slot] = 0;
+    return slot;
+}
+
+void TrackerTable::release(int slot) {
+    auto it = std::find(active_.begin(), active_.end(), slot);
+    if (it != active_.end()) {
+        active_.erase(it);
+        free_.push_back(slot);
+    }
+}
@@ -0,0 +1,253 @@
+#include "v4l2_capture.hpp"
+
+#ifdef __linux__
+#include <linux/videodev2.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace {
+
+// ioctl that retries when interrupted by a signal
+int xioctl(int fd, unsigned long request, void* arg) {
+    int result;
+    do {
+        result = ioctl(fd, request, arg);
+    } while (result == -1 && errno == EINTR);
+    return result;
+}
+
+}  // namespace
+#endif
+
+V4l2Capture::V4l2Capture(std::shared_ptr<Logger> logger)
+    : logger_(logger), fd_(-1), streaming_(false), held_index_(-1),
+      width_(0), height_(0), fps_(0.0) {
+}
+
+V4l2Capture::~V4l2Capture() {
+    close();
+}
+
+bool V4l2Capture::isSupported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef __linux__
+
+bool V4l2Capture::open(int device_index, int width, int height, int fps) {
+    close();
+
+    device_path_ = "/dev/video" + std::to_string(device_index);
+    auto fail = [this](const std::string& reason) {
+        logger_->warning("V4L2 capture on " + device_path_ + ": " + reason);
+        close();
+        return false;
+    };
+
+    fd_ = ::open(device_path_.c_str(), O_RDWR | O_NONBLOCK);
+    if (fd_ < 0) {
+        return fail(std::string("cannot open device (") + strerror(errno) + ")");
+    }
+
+    v4l2_capability capability{};
+    if (xioctl(fd_, VIDIOC_QUERYCAP, &capability) < 0) {
+        return fail("not a V4L2 device");
+    }
+    uint32_t caps = (capability.capabilities & V4L2_CAP_DEVICE_CAPS) ? capability.device_caps
+                                                                     : capability.capabilities;
+    if (!(caps & V4L2_CAP_VIDEO_CAPTURE) || !(caps & V4L2_CAP_STREAMING)) {
+        return fail("device does not support streaming video capture");
+    }
+
+    v4l2_format format{};
+    format.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    format.fmt.pix.width = static_cast<uint32_t>(width);
+    format.fmt.pix.height = static_cast<uint32_t>(height);
+    format.fmt.pix.pixelformat = V4L2_PIX_FMT_MJPEG;
+    format.fmt.pix.field = V4L2_FIELD_ANY;
+    if (xioctl(fd_, VIDIOC_S_FMT, &format) < 0) {
+        return fail(std::string("cannot set capture format (") + strerror(errno) + ")");
+    }
+    if (format.fmt.pix.pixelformat != V4L2_PIX_FMT_MJPEG) {
+        return fail("camera does not offer MJPEG");
+    }
+    width_ = static_cast<int>(format.fmt.pix.width);
+    height_ = static_cast<int>(format.fmt.pix.height);
+
+    // Frame rate is best effort; not every driver implements S_PARM
+    v4l2_streamparm stream_params{};
+    stream_params.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    stream_params.parm.capture.timeperframe.numerator = 1;
+    stream_params.parm.capture.timeperframe.denominator = static_cast<uint32_t>(fps);
+    fps_ = 0.0;
+    if (xioctl(fd_, VIDIOC_S_PARM, &stream_params) == 0 &&
+        stream_params.parm.capture.timeperframe.numerator > 0) {
+        fps_ = static_cast<double>(stream_params.parm.capture.timeperframe.denominator) /
+               stream_params.parm.capture.timeperframe.numerator;
+    }
+
+    v4l2_requestbuffers request{};
+    request.count = BUFFER_COUNT;
+    request.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    request.memory = V4L2_MEMORY_MMAP;
+    if (xioctl(fd_, VIDIOC_REQBUFS, &request) < 0 || request.count < 2) {
+        return fail("cannot allocate mmap buffers");
+    }
+
+    for (uint32_t i = 0; i < request.count; ++i) {
+        v4l2_buffer buffer{};
+        buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buffer.memory = V4L2_MEMORY_MMAP;
+        buffer.index = i;
+        if (xioctl(fd_, VIDIOC_QUERYBUF, &buffer) < 0) {
+            return fail("cannot query buffer " + std::to_string(i));
+        }
+        void* start = mmap(nullptr, buffer.length, PROT_READ, MAP_SHARED, fd_, buffer.m.offset);
+        if (start == MAP_FAILED) {
+            return fail("cannot map buffer " + std::to_string(i));
+        }
+        buffers_.push_back({start, buffer.length});
+    }
+
+    for (uint32_t i = 0; i < buffers_.size(); ++i) {
+        v4l2_buffer buffer{};
+        buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buffer.memory = V4L2_MEMORY_MMAP;
+        buffer.index = i;
+        if (xioctl(fd_, VIDIOC_QBUF, &buffer) < 0) {
+            return fail("cannot queue buffer " + std::to_string(i));
+        }
+    }
+
+    v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (xioctl(fd_, VIDIOC_STREAMON, &type) < 0) {
+        return fail(std::string("cannot start streaming (") + strerror(errno) + ")");
+    }
+    streaming_ = true;
+
+    logger_->debug("V4L2 capture streaming MJPEG " + std::to_string(width_) + "x" + std::to_string(height_) +
+                   " from " + device_path_ + " with " + std::to_string(buffers_.size()) + " mmap buffers");
+    return true;
+}
+
+void V4l2Capture::close() {
+    if (fd_ >= 0 && streaming_) {
+        v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        xioctl(fd_, VIDIOC_STREAMOFF, &type);
+    }
+    streaming_ = false;
+    held_index_ = -1;
+
+    for (const auto& buffer : buffers_) {
+        munmap(buffer.start, buffer.length);
+    }
+    buffers_.clear();
+
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool V4l2Capture::grab(const uint8_t*& data, size_t& size) {
+    if (!streaming_) {
+        return false;
+    }
+    if (!requeueHeld()) {
+        return false;
+    }
+
+    pollfd poll_fd{};
+    poll_fd.fd = fd_;
+    poll_fd.events = POLLIN;
+    int ready;
+    do {
+        ready = poll(&poll_fd, 1, GRAB_TIMEOUT_MS);
+    } while (ready < 0 && errno == EINTR);
+    if (ready <= 0) {
+        logger_->warning(ready == 0 ? "V4L2 capture timed out waiting for a frame"
+                                    : std::string("V4L2 poll failed: ") + strerror(errno));
+        return false;
+    }
+
+    v4l2_buffer buffer{};
+    buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buffer.memory = V4L2_MEMORY_MMAP;
+    if (xioctl(fd_, VIDIOC_DQBUF, &buffer) < 0) {
+        if (errno != EAGAIN) {
+            logger_->warning(std::string("V4L2 dequeue failed: ") + strerror(errno));
+        }
+        return false;
+    }
+    held_index_ = static_cast<int>(buffer.index);
+
+    const auto* payload = static_cast<const uint8_t*>(buffers_[buffer.index].start);
+    // A valid JPEG starts with the SOI marker; anything else is a truncated or corrupt transfer
+    if ((buffer.flags & V4L2_BUF_FLAG_ERROR) || buffer.bytesused < 4 ||
+        payload[0] != 0xFF || payload[1] != 0xD8) {
+        logger_->debug("V4L2 dropped a corrupt frame");
+        requeueHeld();
+        return false;
+    }
+
+    data = payload;
+    size = buffer.bytesused;
+    return true;
+}
+
+bool V4l2Capture::requeueHeld() {
+    if (held_index_ < 0) {
+        return true;
+    }
+    v4l2_buffer buffer{};
+    buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buffer.memory = V4L2_MEMORY_MMAP;
+    buffer.index = static_cast<uint32_t>(held_index_);
+    held_index_ = -1;
+    if (xioctl(fd_, VIDIOC_QBUF, &buffer) < 0) {
+        logger_->warning(std::string("V4L2 requeue failed: ") + strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+#else
+
+bool V4l2Capture::open(int, int, int, int) {
+    logger_->warning("V4L2 capture is only available on Linux");
+    return false;
+}
+
+void V4l2Capture::close() {
+    streaming_ = false;
+}
+
+bool V4l2Capture::grab(const uint8_t*&, size_t&) {
+    return false;
+}
+
+bool V4l2Capture::requeueHeld() {
+    return true;
+}
+
+#endif
+
+bool V4l2Capture::grab(std::vector<uint8_t>& jpeg) {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    if (!grab(data, size)) {
+        return false;
+    }
+    jpeg.assign(data, data + size);
+    // Hand the buffer back right away; only the compressed bytes were copied
+    return requeueHeld();
+}
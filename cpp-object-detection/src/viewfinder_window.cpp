@@ -1,4 +1,5 @@
 #include "viewfinder_window.hpp"
+#include "class_registry.hpp"
 #include "drawing_utils.hpp"
 
 ViewfinderWindow::ViewfinderWindow(std::shared_ptr<Logger> logger, 
@@ -91,13 +92,13 @@ cv::Mat ViewfinderWindow::drawBoundingBoxes(const cv::Mat& frame,
     
     // Draw bounding boxes for each detection
     for (const auto& detection : detections) {
-        cv::Scalar color = getColorForClass(detection.class_name);
+        const cv::Scalar& color = ClassRegistry::color(detection.class_id);
         
         // Draw rectangle around the object
         cv::rectangle(annotated_frame, detection.bbox, color, 2);
         
         // Draw label with class name and confidence
-        std::string label = detection.class_name + " (" + 
+        std::string label = ClassRegistry::name(detection.class_id) + " (" + 
                            std::to_string(static_cast<int>(detection.confidence * 100)) + "%)";
         
         // Add stationary indicator if object is stationary
@@ -123,24 +124,6 @@ cv::Mat ViewfinderWindow::drawBoundingBoxes(const cv::Mat& frame,
     return annotated_frame;
 }
 
-cv::Scalar ViewfinderWindow::getColorForClass(const std::string& class_name) const {
-    // Define colors for different object types (BGR format)
-    // Green for persons, red for cats, blue for dogs, yellow for vehicles, etc.
-    if (class_name == "person") {
-        return cv::Scalar(0, 255, 0);  // Green
-    } else if (class_name == "cat") {
-        return cv::Scalar(0, 0, 255);  // Red
-    } else if (class_name == "dog") {
-        return cv::Scalar(255, 0, 0);  // Blue
-    } else if (class_name == "car" || class_name == "truck" || class_name == "bus") {
-        return cv::Scalar(0, 255, 255);  // Yellow
-    } else if (class_name == "motorcycle" || class_name == "bicycle") {
-        return cv::Scalar(255, 0, 255);  // Magenta
-    } else {
-        return cv::Scalar(255, 255, 255);  // White for unknown
-    }
-}
-
 void ViewfinderWindow::showFrameWithStats(const cv::Mat& frame, 
                                          const std::vector<Detection>& detections,
                                          double current_fps,
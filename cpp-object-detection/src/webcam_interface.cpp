@@ -6,8 +6,9 @@
 WebcamInterface::WebcamInterface(int camera_id, int width, int height, 
                                 std::shared_ptr<Logger> logger)
     : camera_id_(camera_id), width_(width), height_(height), 
-      logger_(logger), initialized_(false), consecutive_failures_(0) {
+      logger_(logger), prefer_v4l2_(false), initialized_(false), consecutive_failures_(0) {
     capture_ = std::make_unique<cv::VideoCapture>();
+    v4l2_capture_ = std::make_unique<V4l2Capture>(logger_);
     last_keepalive_time_ = std::chrono::steady_clock::now();
 }
 
@@ -15,6 +16,10 @@ WebcamInterface::~WebcamInterface() {
     release();
 }
 
+void WebcamInterface::setCaptureBackend(const std::string& backend) {
+    prefer_v4l2_ = (backend == "v4l2");
+}
+
 bool WebcamInterface::initialize() {
     if (initialized_) {
         return true;
@@ -24,19 +29,35 @@ bool WebcamInterface::initialize() {
     logger_->debug("Camera ID: " + std::to_string(camera_id_));
     logger_->debug("Target resolution: " + std::to_string(width_) + "x" + std::to_string(height_));
 
-    // Try to open the camera
-    if (!capture_->open(camera_id_)) {
-        logger_->error("Failed to open camera with ID: " + std::to_string(camera_id_));
-        return false;
+    bool opened = false;
+    if (prefer_v4l2_) {
+        opened = v4l2_capture_->open(camera_id_, width_, height_, 30);
+        if (!opened) {
+            logger_->warning("V4L2 MJPEG capture unavailable - falling back to OpenCV capture");
+        } else if (v4l2_capture_->getWidth() != width_ || v4l2_capture_->getHeight() != height_) {
+            logger_->warning("Camera resolution differs from requested: got " +
+                            std::to_string(v4l2_capture_->getWidth()) + "x" +
+                            std::to_string(v4l2_capture_->getHeight()) +
+                            ", requested " + std::to_string(width_) + "x" + std::to_string(height_));
+        }
     }
 
-    // Set camera properties
-    setCameraProperties();
+    // Try to open the camera
+    if (!opened) {
+        if (!capture_->open(camera_id_)) {
+            logger_->error("Failed to open camera with ID: " + std::to_string(camera_id_));
+            return false;
+        }
+
+        // Set camera properties
+        setCameraProperties();
+    }
 
     // Test camera capabilities
     if (!testCameraCapabilities()) {
         logger_->error("Camera capability test failed");
         capture_->release();
+        v4l2_capture_->close();
         return false;
     }
 
@@ -48,13 +69,13 @@ bool WebcamInterface::initialize() {
 }
 
 bool WebcamInterface::captureFrame(cv::Mat& frame) {
-    if (!initialized_ || !capture_->isOpened()) {
+    if (!isReady()) {
         logger_->error("Camera not initialized or not opened");
         consecutive_failures_++;
         return false;
     }
 
-    if (!capture_->read(frame)) {
+    if (!readFrame(frame)) {
         logger_->warning("Failed to read frame from camera");
         consecutive_failures_++;
         return false;
@@ -75,8 +96,40 @@ bool WebcamInterface::captureFrame(cv::Mat& frame) {
     return true;
 }
 
+bool WebcamInterface::captureEncodedFrame(std::vector<uchar>& jpeg) {
+    if (!isReady() || !usingV4l2()) {
+        logger_->error("Camera not initialized or not delivering MJPEG");
+        consecutive_failures_++;
+        return false;
+    }
+
+    if (!v4l2_capture_->grab(jpeg)) {
+        logger_->warning("Failed to read frame from camera");
+        consecutive_failures_++;
+        return false;
+    }
+
+    consecutive_failures_ = 0;
+    return true;
+}
+
+bool WebcamInterface::providesEncodedFrames() const {
+    return initialized_ && usingV4l2();
+}
+
+bool WebcamInterface::usingV4l2() const {
+    return v4l2_capture_ && v4l2_capture_->isOpen();
+}
+
+bool WebcamInterface::readFrame(cv::Mat& frame) {
+    if (usingV4l2()) {
+        return v4l2_capture_->grab(encoded_buffer_) && decodeFrame(encoded_buffer_, frame);
+    }
+    return capture_->read(frame);
+}
+
 bool WebcamInterface::isReady() const {
-    return initialized_ && capture_ && capture_->isOpened();
+    return initialized_ && (usingV4l2() || (capture_ && capture_->isOpened()));
 }
 
 std::string WebcamInterface::getCameraInfo() const {
@@ -86,6 +139,15 @@ std::string WebcamInterface::getCameraInfo() const {
 
     std::stringstream ss;
     ss << "Camera " << camera_id_ << ": ";
+
+    if (usingV4l2()) {
+        ss << v4l2_capture_->getWidth() << "x" << v4l2_capture_->getHeight();
+        if (v4l2_capture_->getFps() > 0) {
+            ss << " @ " << v4l2_capture_->getFps() << " fps";
+        }
+        ss << " (backend: V4L2 mmap, MJPEG passthrough)";
+        return ss.str();
+    }
     
     // Get actual resolution
     int actual_width = static_cast<int>(capture_->get(cv::CAP_PROP_FRAME_WIDTH));
@@ -106,6 +168,10 @@ std::string WebcamInterface::getCameraInfo() const {
 }
 
 void WebcamInterface::release() {
+    if (usingV4l2()) {
+        v4l2_capture_->close();
+        logger_->info("Camera released");
+    }
     if (capture_ && capture_->isOpened()) {
         capture_->release();
         logger_->info("Camera released");
@@ -117,7 +183,7 @@ bool WebcamInterface::testCameraCapabilities() {
     cv::Mat test_frame;
     
     // Try to capture a test frame
-    if (!capture_->read(test_frame)) {
+    if (!readFrame(test_frame)) {
         logger_->error("Failed to capture test frame");
         return false;
     }
@@ -0,0 +1,447 @@
+#include "yolo_utils.hpp"
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace YoloUtils {
+
+int computeInputSize(const cv::Size& frame_size, double scale_factor, int nominal_size) {
+    int longest_side = std::max(frame_size.width, frame_size.height);
+    if (longest_side <= 0 || scale_factor <= 0.0) {
+        return nominal_size;
+    }
+
+    double target = longest_side * std::min(scale_factor, 1.0);
+    int aligned = static_cast<int>(std::lround(target / STRIDE)) * STRIDE;
+
+    int lower_bound = std::min(MIN_INPUT_SIZE, nominal_size);
+    return std::max(lower_bound, std::min(aligned, nominal_size));
+}
+
+Letterbox computeLetterbox(const cv::Size& frame_size, int input_size) {
+    Letterbox letterbox;
+    letterbox.input_size = cv::Size(input_size, input_size);
+    if (frame_size.width <= 0 || frame_size.height <= 0) {
+        letterbox.resized = letterbox.input_size;
+        return letterbox;
+    }
+
+    letterbox.scale = std::min(static_cast<float>(input_size) / frame_size.width,
+                               static_cast<float>(input_size) / frame_size.height);
+    letterbox.resized = cv::Size(
+        std::min(input_size, static_cast<int>(std::lround(frame_size.width * letterbox.scale))),
+        std::min(input_size, static_cast<int>(std::lround(frame_size.height * letterbox.scale))));
+    letterbox.pad_x = (input_size - letterbox.resized.width) / 2;
+    letterbox.pad_y = (input_size - letterbox.resized.height) / 2;
+    return letterbox;
+}
+
+#if CV_SIMD128
+// Widen 16 bytes to floats, scale, and store them contiguously
+static inline void storeScaled(const cv::v_uint8x16& pixels, float* dst, const cv::v_float32x4& scale) {
+    const cv::v_float32x4 zero = cv::v_setzero_f32();
+    cv::v_uint16x8 low, high;
+    cv::v_expand(pixels, low, high);
+
+    cv::v_uint32x4 q0, q1, q2, q3;
+    cv::v_expand(low, q0, q1);
+    cv::v_expand(high, q2, q3);
+
+    cv::v_store(dst, cv::v_muladd(cv::v_cvt_f32(cv::v_reinterpret_as_s32(q0)), scale, zero));
+    cv::v_store(dst + 4, cv::v_muladd(cv::v_cvt_f32(cv::v_reinterpret_as_s32(q1)), scale, zero));
+    cv::v_store(dst + 8, cv::v_muladd(cv::v_cvt_f32(cv::v_reinterpret_as_s32(q2)), scale, zero));
+    cv::v_store(dst + 12, cv::v_muladd(cv::v_cvt_f32(cv::v_reinterpret_as_s32(q3)), scale, zero));
+}
+#endif
+
+void convertBgrRowToPlanes(const uchar* bgr, float* red, float* green, float* blue,
+                           int width, float pixel_scale) {
+    int x = 0;
+#if CV_SIMD128
+    // 16 pixels per iteration: NEON on ARM64, SSE2 or better on x86
+    const cv::v_float32x4 scale = cv::v_setall_f32(pixel_scale);
+    for (; x <= width - 16; x += 16) {
+        cv::v_uint8x16 b, g, r;
+        cv::v_load_deinterleave(bgr + x * 3, b, g, r);
+        storeScaled(r, red + x, scale);
+        storeScaled(g, green + x, scale);
+        storeScaled(b, blue + x, scale);
+    }
+#endif
+    for (; x < width; ++x) {
+        blue[x] = bgr[x * 3] * pixel_scale;
+        green[x] = bgr[x * 3 + 1] * pixel_scale;
+        red[x] = bgr[x * 3 + 2] * pixel_scale;
+    }
+}
+
+// Letterbox one frame into the three planes of a single image starting at red
+static void letterboxIntoPlanes(const cv::Mat& frame, const Letterbox& letterbox, float pixel_scale,
+                                cv::Mat& resize_buffer, float* red) {
+    CV_Assert(frame.type() == CV_8UC3);
+
+    const int side = letterbox.input_size.width;
+
+    // Single resample into a persistent buffer (skipped when sizes already match)
+    const cv::Mat* content = &frame;
+    if (frame.cols != letterbox.resized.width || frame.rows != letterbox.resized.height) {
+        cv::resize(frame, resize_buffer, letterbox.resized, 0, 0, cv::INTER_LINEAR);
+        content = &resize_buffer;
+    }
+
+    const size_t plane_size = static_cast<size_t>(side) * side;
+    float* green = red + plane_size;
+    float* blue = green + plane_size;
+    const float pad = LETTERBOX_PAD_VALUE * pixel_scale;
+
+    const int content_width = letterbox.resized.width;
+    const int content_height = letterbox.resized.height;
+    const int right_pad = side - letterbox.pad_x - content_width;
+
+    for (int y = 0; y < side; ++y) {
+        const size_t row_offset = static_cast<size_t>(y) * side;
+        int content_row = y - letterbox.pad_y;
+
+        if (content_row < 0 || content_row >= content_height) {
+            std::fill_n(red + row_offset, side, pad);
+            std::fill_n(green + row_offset, side, pad);
+            std::fill_n(blue + row_offset, side, pad);
+            continue;
+        }
+
+        if (letterbox.pad_x > 0) {
+            std::fill_n(red + row_offset, letterbox.pad_x, pad);
+            std::fill_n(green + row_offset, letterbox.pad_x, pad);
+            std::fill_n(blue + row_offset, letterbox.pad_x, pad);
+        }
+
+        const size_t content_offset = row_offset + letterbox.pad_x;
+        convertBgrRowToPlanes(content->ptr<uchar>(content_row),
+                              red + content_offset, green + content_offset, blue + content_offset,
+                              content_width, pixel_scale);
+
+        if (right_pad > 0) {
+            const size_t right_offset = content_offset + content_width;
+            std::fill_n(red + right_offset, right_pad, pad);
+            std::fill_n(green + right_offset, right_pad, pad);
+            std::fill_n(blue + right_offset, right_pad, pad);
+        }
+    }
+}
+
+void letterboxToBlob(const cv::Mat& frame, const Letterbox& letterbox, float pixel_scale,
+                     cv::Mat& resize_buffer, cv::Mat& blob) {
+    const int side = letterbox.input_size.width;
+    const int blob_shape[] = {1, 3, side, side};
+    blob.create(4, blob_shape, CV_32F);
+
+    letterboxIntoPlanes(frame, letterbox, pixel_scale, resize_buffer, blob.ptr<float>());
+}
+
+void letterboxToBatchBlob(const std::vector<cv::Mat>& frames, const std::vector<Letterbox>& letterboxes,
+                          float pixel_scale, cv::Mat& resize_buffer, cv::Mat& blob) {
+    CV_Assert(!frames.empty() && frames.size() == letterboxes.size());
+
+    const int side = letterboxes[0].input_size.width;
+    const int blob_shape[] = {static_cast<int>(frames.size()), 3, side, side};
+    blob.create(4, blob_shape, CV_32F);
+
+    const size_t image_size = static_cast<size_t>(3) * side * side;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        CV_Assert(letterboxes[i].input_size.width == side);
+        letterboxIntoPlanes(frames[i], letterboxes[i], pixel_scale, resize_buffer,
+                            blob.ptr<float>() + i * image_size);
+    }
+}
+
+bool prepareBatch(const std::vector<cv::Mat>& frames, int fixed_input_size, double scale_factor,
+                  int nominal_size, float pixel_scale, Batch& batch,
+                  cv::Mat& resize_buffer, cv::Mat& blob) {
+    batch.frames.clear();
+    batch.indices.clear();
+    batch.letterboxes.clear();
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (!frames[i].empty()) {
+            batch.frames.push_back(frames[i]);
+            batch.indices.push_back(i);
+        }
+    }
+    if (batch.empty()) {
+        return false;
+    }
+
+    batch.input_size = fixed_input_size > 0
+        ? fixed_input_size
+        : computeInputSize(batch.frames.front().size(), scale_factor, nominal_size);
+    for (const auto& frame : batch.frames) {
+        batch.letterboxes.push_back(computeLetterbox(frame.size(), batch.input_size));
+    }
+    letterboxToBatchBlob(batch.frames, batch.letterboxes, pixel_scale, resize_buffer, blob);
+    return true;
+}
+
+bool acceptBatchOutput(std::vector<cv::Mat>& outputs, size_t batch_size) {
+    if (outputs.empty() || outputs[0].dims != 3 || outputs[0].size[0] != static_cast<int>(batch_size)) {
+        return false;
+    }
+    if (outputs[0].depth() != CV_32F) {
+        outputs[0].convertTo(outputs[0], CV_32F);
+    }
+    return true;
+}
+
+// Index of the highest class score over all classes
+static inline int argmaxAllClasses(const float* scores, int num_classes, float& best_score) {
+    int c = 0;
+    float max_score = 0.0f;
+#if CV_SIMD128
+    if (num_classes >= 4) {
+        cv::v_float32x4 running_max = cv::v_load(scores);
+        for (c = 4; c <= num_classes - 4; c += 4) {
+            running_max = cv::v_max(running_max, cv::v_load(scores + c));
+        }
+        max_score = cv::v_reduce_max(running_max);
+    }
+#endif
+    for (; c < num_classes; ++c) {
+        max_score = std::max(max_score, scores[c]);
+    }
+
+    best_score = max_score;
+    if (max_score <= 0.0f) {
+        return -1;
+    }
+    // First index holding the maximum, matching a scalar strict-greater scan
+    for (int i = 0; i < num_classes; ++i) {
+        if (scores[i] == max_score) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Score a row whose objectness passed; it becomes a candidate if its best class does too
+static inline void scoreRow(const float* row, int num_classes, const std::vector<int>& class_ids,
+                            float confidence_threshold, std::vector<Candidate>& candidates) {
+    const float objectness = row[4];
+    const float* scores = row + 5;
+    float best_score = 0.0f;
+    int best_class = -1;
+    if (class_ids.empty()) {
+        best_class = argmaxAllClasses(scores, num_classes, best_score);
+    } else {
+        // A dozen scattered target ids: a gather would cost more than it saves
+        for (int class_id : class_ids) {
+            if (class_id < num_classes && scores[class_id] > best_score) {
+                best_score = scores[class_id];
+                best_class = class_id;
+            }
+        }
+    }
+
+    float confidence = objectness * best_score;
+    if (best_class < 0 || confidence < confidence_threshold) {
+        return;
+    }
+    candidates.push_back({row[0], row[1], row[2], row[3], confidence, best_class});
+}
+
+void decodeYoloV5(const float* data, int rows, int row_size,
+                  const std::vector<int>& class_ids, float confidence_threshold,
+                  std::vector<Candidate>& candidates) {
+    candidates.clear();
+    const int num_classes = row_size - 5;
+    if (!data || rows <= 0 || num_classes <= 0) {
+        return;
+    }
+
+    int row = 0;
+#if CV_SIMD128
+    // Almost every anchor is background. Objectness is strided through the
+    // rows, so it is first copied into a contiguous column of OBJECTNESS_BLOCK
+    // rows; four vector compares then give a bit per row that passes, and only
+    // those rows are scored. A block of background costs no branch per row.
+    constexpr int OBJECTNESS_BLOCK = 16;
+    const cv::v_float32x4 threshold = cv::v_setall_f32(confidence_threshold);
+    float objectness[OBJECTNESS_BLOCK];
+    for (; row <= rows - OBJECTNESS_BLOCK; row += OBJECTNESS_BLOCK) {
+        const float* block = data + static_cast<size_t>(row) * row_size;
+        for (int i = 0; i < OBJECTNESS_BLOCK; ++i) {
+            objectness[i] = block[static_cast<size_t>(i) * row_size + 4];
+        }
+        cv::v_float32x4 pass0 = cv::v_load(objectness) >= threshold;
+        cv::v_float32x4 pass1 = cv::v_load(objectness + 4) >= threshold;
+        cv::v_float32x4 pass2 = cv::v_load(objectness + 8) >= threshold;
+        cv::v_float32x4 pass3 = cv::v_load(objectness + 12) >= threshold;
+        if (!cv::v_check_any(pass0 | pass1 | pass2 | pass3)) {
+            continue;
+        }
+        unsigned passing = static_cast<unsigned>(cv::v_signmask(pass0)) |
+                           static_cast<unsigned>(cv::v_signmask(pass1)) << 4 |
+                           static_cast<unsigned>(cv::v_signmask(pass2)) << 8 |
+                           static_cast<unsigned>(cv::v_signmask(pass3)) << 12;
+        for (int i = 0; passing != 0; ++i, passing >>= 1) {
+            if (passing & 1u) {
+                scoreRow(block + static_cast<size_t>(i) * row_size, num_classes, class_ids,
+                         confidence_threshold, candidates);
+            }
+        }
+    }
+#endif
+    for (; row < rows; ++row) {
+        const float* data_row = data + static_cast<size_t>(row) * row_size;
+        if (data_row[4] >= confidence_threshold) {
+            scoreRow(data_row, num_classes, class_ids, confidence_threshold, candidates);
+        }
+    }
+}
+
+// dst[i] = max(dst[i], row[i]) over contiguous memory
+static inline void accumulateMax(float* dst, const float* row, int count) {
+    int i = 0;
+#if CV_SIMD128
+    for (; i <= count - 4; i += 4) {
+        cv::v_store(dst + i, cv::v_max(cv::v_load(dst + i), cv::v_load(row + i)));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = std::max(dst[i], row[i]);
+    }
+}
+
+void decodeYoloV8(const float* data, int channels, int anchors,
+                  const std::vector<int>& class_ids, float confidence_threshold,
+                  std::vector<float>& best_scores, std::vector<Candidate>& candidates) {
+    candidates.clear();
+    const int num_classes = channels - 4;
+    if (!data || anchors <= 0 || num_classes <= 0) {
+        return;
+    }
+
+    auto class_row = [&](int class_id) {
+        return data + static_cast<size_t>(4 + class_id) * anchors;
+    };
+
+    // Pass 1: best class score per anchor, streaming one class row at a time
+    best_scores.assign(anchors, 0.0f);
+    if (class_ids.empty()) {
+        for (int c = 0; c < num_classes; ++c) {
+            accumulateMax(best_scores.data(), class_row(c), anchors);
+        }
+    } else {
+        for (int class_id : class_ids) {
+            if (class_id < num_classes) {
+                accumulateMax(best_scores.data(), class_row(class_id), anchors);
+            }
+        }
+    }
+
+    // Pass 2: only the few anchors above threshold are looked at individually
+    const float* center_x = data;
+    const float* center_y = data + anchors;
+    const float* width = data + 2 * static_cast<size_t>(anchors);
+    const float* height = data + 3 * static_cast<size_t>(anchors);
+    for (int a = 0; a < anchors; ++a) {
+        float score = best_scores[a];
+        if (score < confidence_threshold || score <= 0.0f) {
+            continue;
+        }
+
+        // Lowest class id holding the best score, as a strict-greater scan in class order
+        // would pick; class_ids need not be sorted, so every listed id is checked
+        int best_class = -1;
+        if (class_ids.empty()) {
+            for (int c = 0; c < num_classes && best_class < 0; ++c) {
+                if (class_row(c)[a] == score) {
+                    best_class = c;
+                }
+            }
+        } else {
+            for (int class_id : class_ids) {
+                if (class_id < num_classes && class_row(class_id)[a] == score &&
+                    (best_class < 0 || class_id < best_class)) {
+                    best_class = class_id;
+                }
+            }
+        }
+        if (best_class < 0) {
+            continue;
+        }
+        candidates.push_back({center_x[a], center_y[a], width[a], height[a], score, best_class});
+    }
+}
+
+std::vector<std::string> cocoClassNames() {
+    return {
+        "person", "bicycle", "car", "motorcycle", "airplane", "bus", "train", "truck",
+        "boat", "traffic light", "fire hydrant", "stop sign", "parking meter", "bench",
+        "bird", "cat", "dog", "horse", "sheep", "cow", "elephant", "bear", "zebra",
+        "giraffe", "backpack", "umbrella", "handbag", "tie", "suitcase", "frisbee",
+        "skis", "snowboard", "sports ball", "kite", "baseball bat", "baseball glove",
+        "skateboard", "surfboard", "tennis racket", "bottle", "wine glass", "cup",
+        "fork", "knife", "spoon", "bowl", "banana", "apple", "sandwich", "orange",
+        "broccoli", "carrot", "hot dog", "pizza", "donut", "cake", "chair", "couch",
+        "potted plant", "bed", "dining table", "toilet", "tv", "laptop", "mouse",
+        "remote", "keyboard", "cell phone", "microwave", "oven", "toaster", "sink",
+        "refrigerator", "book", "clock", "vase", "scissors", "teddy bear", "hair drier",
+        "toothbrush"
+    };
+}
+
+std::vector<int> resolveClassIds(const std::vector<std::string>& target_names,
+                                 const std::vector<std::string>& class_names) {
+    std::vector<int> class_ids;
+    for (const auto& name : target_names) {
+        auto it = std::find(class_names.begin(), class_names.end(), name);
+        if (it != class_names.end()) {
+            class_ids.push_back(static_cast<int>(it - class_names.begin()));
+        }
+    }
+    std::sort(class_ids.begin(), class_ids.end());
+    class_ids.erase(std::unique(class_ids.begin(), class_ids.end()), class_ids.end());
+    return class_ids;
+}
+
+cv::Rect unprojectBox(float center_x, float center_y, float width, float height,
+                      const Letterbox& letterbox, const cv::Size& frame_size) {
+    float inverse_scale = letterbox.scale > 0.0f ? 1.0f / letterbox.scale : 1.0f;
+
+    float x1 = (center_x - width / 2 - letterbox.pad_x) * inverse_scale;
+    float y1 = (center_y - height / 2 - letterbox.pad_y) * inverse_scale;
+    float x2 = (center_x + width / 2 - letterbox.pad_x) * inverse_scale;
+    float y2 = (center_y + height / 2 - letterbox.pad_y) * inverse_scale;
+
+    x1 = std::max(0.0f, std::min(x1, static_cast<float>(frame_size.width)));
+    y1 = std::max(0.0f, std::min(y1, static_cast<float>(frame_size.height)));
+    x2 = std::max(0.0f, std::min(x2, static_cast<float>(frame_size.width)));
+    y2 = std::max(0.0f, std::min(y2, static_cast<float>(frame_size.height)));
+
+    return cv::Rect(cv::Point(static_cast<int>(x1), static_cast<int>(y1)),
+                    cv::Point(static_cast<int>(x2), static_cast<int>(y2)));
+}
+
+void suppressCandidates(const std::vector<Candidate>& candidates, const Letterbox& letterbox,
+                        const cv::Size& frame_size, float iou_threshold,
+                        const std::vector<int>& registry_ids, NmsEngine& nms,
+                        std::vector<Detection>& detections) {
+    detections.clear();
+    nms.clear();
+    for (const auto& candidate : candidates) {
+        if (candidate.class_id >= static_cast<int>(registry_ids.size())) {
+            continue;
+        }
+        nms.add(unprojectBox(candidate.center_x, candidate.center_y, candidate.width, candidate.height,
+                             letterbox, frame_size),
+                candidate.confidence, candidate.class_id);
+    }
+
+    for (int index : nms.suppress(iou_threshold)) {
+        Detection det;
+        det.bbox = nms.box(index);
+        det.confidence = nms.score(index);
+        det.class_id = registry_ids[nms.classId(index)];
+        detections.push_back(det);
+    }
+}
+
+}  // namespace YoloUtils
@@ -1,4 +1,8 @@
 #include "yolo_v5_model.hpp"
+#include "class_registry.hpp"
+#include "yolo_utils.hpp"
+#include "nms_engine.hpp"
+#include "onnx_model_info.hpp"
 #include <fstream>
 #include <algorithm>
 
@@ -17,17 +21,13 @@
     }
 #endif
 
-// Static member definitions
-const cv::Scalar YoloV5SmallModel::MEAN = cv::Scalar(0, 0, 0);
-const cv::Scalar YoloV5LargeModel::MEAN = cv::Scalar(0, 0, 0);
-
 // ============================================================================
 // YoloV5SmallModel Implementation
 // ============================================================================
 
 YoloV5SmallModel::YoloV5SmallModel(std::shared_ptr<Logger> logger)
     : logger_(logger), confidence_threshold_(0.5), detection_scale_factor_(1.0), 
-      initialized_(false), enable_gpu_(false), avg_inference_time_ms_(65) {
+      initialized_(false), enable_gpu_(false), dynamic_input_size_(true), batch_supported_(true), avg_inference_time_ms_(65) {
 }
 
 bool YoloV5SmallModel::initialize(const std::string& model_path,
@@ -53,6 +53,13 @@ bool YoloV5SmallModel::initialize(const std::string& model_path,
         logger_->error("Failed to load class names");
         return false;
     }
+    registry_ids_ = ClassRegistry::internAll(class_names_);
+
+    target_class_ids_ = YoloUtils::resolveClassIds(target_class_names_, class_names_);
+    if (!target_class_names_.empty()) {
+        logger_->debug("Scoring " + std::to_string(target_class_ids_.size()) + " of " +
+                      std::to_string(class_names_.size()) + " classes");
+    }
 
     // Load the model
     if (!loadModel(model_path)) {
@@ -67,6 +74,14 @@ bool YoloV5SmallModel::initialize(const std::string& model_path,
 }
 
 std::vector<Detection> YoloV5SmallModel::detect(const cv::Mat& frame) {
+    return detectScaled(frame, detection_scale_factor_);
+}
+
+std::vector<Detection> YoloV5SmallModel::detectRegion(const cv::Mat& crop) {
+    return detectScaled(crop, 1.0);
+}
+
+std::vector<Detection> YoloV5SmallModel::detectScaled(const cv::Mat& frame, double scale_factor) {
     if (!initialized_ || frame.empty()) {
         return {};
     }
@@ -75,29 +90,24 @@ std::vector<Detection> YoloV5SmallModel::detect(const cv::Mat& frame) {
     std::vector<Detection> detections;
 
     try {
-        // Downscale frame if scale factor is less than 1.0
-        cv::Mat detection_frame = frame;
-        if (detection_scale_factor_ < 1.0) {
-            int new_width = static_cast<int>(frame.cols * detection_scale_factor_);
-            int new_height = static_cast<int>(frame.rows * detection_scale_factor_);
-            cv::resize(frame, detection_frame, cv::Size(new_width, new_height), 0, 0, cv::INTER_LINEAR);
+        // The scale factor picks a smaller stride-aligned network input instead of
+        // shrinking the frame and letting the blob stretch it back up
+        int input_size = dynamic_input_size_
+            ? YoloUtils::computeInputSize(frame.size(), scale_factor, INPUT_WIDTH)
+            : INPUT_WIDTH;
+        try {
+            detections = runNetwork(frame, input_size);
+        } catch (const cv::Exception&) {
+            if (input_size == INPUT_WIDTH) {
+                throw;
+            }
+            // Models exported with a fixed input shape cannot be reshaped
+            logger_->warning("YOLOv5s rejected " + std::to_string(input_size) + "x" + std::to_string(input_size) +
+                             " input, using " + std::to_string(INPUT_WIDTH) + "x" + std::to_string(INPUT_HEIGHT) +
+                             " (re-export the model with dynamic axes to enable smaller inputs)");
+            dynamic_input_size_ = false;
+            detections = runNetwork(frame, INPUT_WIDTH);
         }
-        
-        // Create blob from image (potentially downscaled)
-        cv::Mat blob;
-        cv::dnn::blobFromImage(detection_frame, blob, SCALE_FACTOR, 
-                              cv::Size(INPUT_WIDTH, INPUT_HEIGHT), 
-                              MEAN, true, false, CV_32F);
-
-        // Set input to the network
-        net_.setInput(blob);
-
-        // Forward pass
-        std::vector<cv::Mat> outputs;
-        net_.forward(outputs, net_.getUnconnectedOutLayersNames());
-
-        // Post-process the outputs (pass original frame for proper bbox scaling)
-        detections = postProcess(frame, outputs);
 
     } catch (const cv::Exception& e) {
         logger_->error("OpenCV error during YOLOv5s detection: " + std::string(e.what()));
@@ -113,6 +123,40 @@ std::vector<Detection> YoloV5SmallModel::detect(const cv::Mat& frame) {
     return detections;
 }
 
+std::vector<std::vector<Detection>> YoloV5SmallModel::detectBatch(const std::vector<cv::Mat>& frames) {
+    if (!initialized_ || !batch_supported_ || frames.size() < 2) {
+        return IDetectionModel::detectBatch(frames);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<std::vector<Detection>> results(frames.size());
+
+    bool batched = false;
+    try {
+        batched = runBatch(frames, results);
+    } catch (const cv::Exception& e) {
+        logger_->debug("YOLOv5s batch error: " + std::string(e.what()));
+    } catch (const std::exception& e) {
+        logger_->error("Error during YOLOv5s batch detection: " + std::string(e.what()));
+        return results;
+    }
+
+    if (!batched) {
+        // Exports with a fixed batch axis of 1 either throw or return a single image
+        logger_->warning("YOLOv5s rejected a batch of " + std::to_string(frames.size()) +
+                         " frames, running frames one at a time (re-export the model with dynamic axes to enable batching)");
+        batch_supported_ = false;
+        return IDetectionModel::detectBatch(frames);
+    }
+
+    // Track per-frame cost so metrics stay comparable with detect()
+    auto end_time = std::chrono::steady_clock::now();
+    auto inference_time = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    updateInferenceTime(static_cast<int>(inference_time.count() / static_cast<long>(frames.size())));
+
+    return results;
+}
+
 ModelMetrics YoloV5SmallModel::getMetrics() const {
     return {
         "YOLOv5s",
@@ -137,10 +181,18 @@ std::string YoloV5SmallModel::getModelName() const {
     return "YOLOv5 Small";
 }
 
+int YoloV5SmallModel::getInputSize() const {
+    return INPUT_WIDTH;
+}
+
 void YoloV5SmallModel::setEnableGpu(bool enable_gpu) {
     enable_gpu_ = enable_gpu;
 }
 
+void YoloV5SmallModel::setTargetClasses(const std::vector<std::string>& class_names) {
+    target_class_names_ = class_names;
+}
+
 void YoloV5SmallModel::warmUp() {
     if (!initialized_) {
         return;
@@ -164,20 +216,7 @@ bool YoloV5SmallModel::loadClassNames(const std::string& classes_path) {
     if (!class_file.is_open()) {
         // If COCO classes file doesn't exist, create a basic one
         logger_->warning("Classes file not found, using built-in COCO classes");
-        class_names_ = {
-            "person", "bicycle", "car", "motorcycle", "airplane", "bus", "train", "truck",
-            "boat", "traffic light", "fire hydrant", "stop sign", "parking meter", "bench",
-            "bird", "cat", "dog", "horse", "sheep", "cow", "elephant", "bear", "zebra",
-            "giraffe", "backpack", "umbrella", "handbag", "tie", "suitcase", "frisbee",
-            "skis", "snowboard", "sports ball", "kite", "baseball bat", "baseball glove",
-            "skateboard", "surfboard", "tennis racket", "bottle", "wine glass", "cup",
-            "fork", "knife", "spoon", "bowl", "banana", "apple", "sandwich", "orange",
-            "broccoli", "carrot", "hot dog", "pizza", "donut", "cake", "chair", "couch",
-            "potted plant", "bed", "dining table", "toilet", "tv", "laptop", "mouse",
-            "remote", "keyboard", "cell phone", "microwave", "oven", "toaster", "sink",
-            "refrigerator", "book", "clock", "vase", "scissors", "teddy bear", "hair drier",
-            "toothbrush"
-        };
+        class_names_ = YoloUtils::cocoClassNames();
         return true;
     }
 
@@ -211,9 +250,19 @@ bool YoloV5SmallModel::loadModel(const std::string& model_path) {
             return false;
         }
 
+        // QDQ/QOperator INT8 and FP16 exports load through the same importer, but
+        // OpenCV only implements the quantized layers on its own CPU backend
+        OnnxModelInfo::Summary model_info = OnnxModelInfo::inspect(model_path);
+        logger_->info("YOLOv5s model precision: " + OnnxModelInfo::describe(model_info));
+        bool use_gpu = enable_gpu_;
+        if (use_gpu && model_info.precision == OnnxModelInfo::Precision::INT8) {
+            logger_->warning("YOLOv5s INT8 model runs on the CPU only, ignoring GPU acceleration");
+            use_gpu = false;
+        }
+
         // Select backend based on platform and available hardware
 #ifdef __APPLE__
-        if (enable_gpu_) {
+        if (use_gpu) {
             // Try to use GPU acceleration on macOS via OpenCL
             try {
                 net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
@@ -231,7 +280,7 @@ bool YoloV5SmallModel::loadModel(const std::string& model_path) {
         }
 #else
         // Try to use GPU if available and enabled on other platforms
-        if (enable_gpu_) {
+        if (use_gpu) {
             try {
                 net_.setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
                 net_.setPreferableTarget(cv::dnn::DNN_TARGET_CUDA);
@@ -260,8 +309,44 @@ bool YoloV5SmallModel::loadModel(const std::string& model_path) {
     }
 }
 
+std::vector<Detection> YoloV5SmallModel::runNetwork(const cv::Mat& frame, int input_size) {
+    YoloUtils::Letterbox letterbox = YoloUtils::computeLetterbox(frame.size(), input_size);
+
+    // Fused letterbox + BGR->RGB + 1/255 + HWC->CHW into the persistent input tensor
+    YoloUtils::letterboxToBlob(frame, letterbox, SCALE_FACTOR, resize_buffer_, input_blob_);
+
+    net_.setInput(input_blob_);
+
+    std::vector<cv::Mat> outputs;
+    net_.forward(outputs, net_.getUnconnectedOutLayersNames());
+
+    return postProcess(frame, letterbox, outputs);
+}
+
+bool YoloV5SmallModel::runBatch(const std::vector<cv::Mat>& frames,
+                                std::vector<std::vector<Detection>>& results) {
+    if (!YoloUtils::prepareBatch(frames, dynamic_input_size_ ? 0 : INPUT_WIDTH, detection_scale_factor_,
+                                 INPUT_WIDTH, SCALE_FACTOR, batch_, resize_buffer_, input_blob_)) {
+        return true;
+    }
+
+    // [N, 3, H, W] blob -> one forward pass -> [N, rows, 5 + classes]
+    net_.setInput(input_blob_);
+    std::vector<cv::Mat> outputs;
+    net_.forward(outputs, net_.getUnconnectedOutLayersNames());
+    if (!YoloUtils::acceptBatchOutput(outputs, batch_.size())) {
+        return false;
+    }
+
+    YoloUtils::scatterBatch(batch_, results, [&](size_t b) {
+        return postProcess(batch_.frames[b], batch_.letterboxes[b], outputs, static_cast<int>(b));
+    });
+    return true;
+}
+
 std::vector<Detection> YoloV5SmallModel::postProcess(
-    const cv::Mat& frame, const std::vector<cv::Mat>& outputs) {
+    const cv::Mat& frame, const YoloUtils::Letterbox& letterbox, const std::vector<cv::Mat>& outputs,
+    int batch_index) {
     
     std::vector<Detection> detections;
     
@@ -270,9 +355,12 @@ std::vector<Detection> YoloV5SmallModel::postProcess(
     }
 
     // YOLO output format: [batch, num_detections, 85] where 85 = 4 (bbox) + 1 (confidence) + 80 (classes)
-    const cv::Mat& output = outputs[0];
+    cv::Mat output = outputs[0];
+    if (output.depth() != CV_32F) {
+        output.convertTo(output, CV_32F);  // FP16 exports may return half-precision outputs
+    }
     
-    if (output.dims != 3) {
+    if (output.dims != 3 || batch_index >= output.size[0]) {
         logger_->debug("Unexpected YOLOv5s output dimensions: " + std::to_string(output.dims));
         return detections;
     }
@@ -280,79 +368,14 @@ std::vector<Detection> YoloV5SmallModel::postProcess(
     const int num_detections = output.size[1];
     const int num_classes = output.size[2] - 5; // First 5 are x, y, w, h, confidence
     
-    float* data = (float*)output.data;
-    
-    // Temporary storage for NMS
-    std::vector<cv::Rect> boxes;
-    std::vector<float> confidences;
-    std::vector<int> class_ids;
+    const float* data = output.ptr<float>(batch_index);  // Slice of this frame in a batched output
     
-    for (int i = 0; i < num_detections; ++i) {
-        float* detection = data + i * (num_classes + 5);
-        
-        float confidence = detection[4];
-        if (confidence < confidence_threshold_) {
-            continue;
-        }
-        
-        // Find the class with maximum score
-        float max_class_score = 0;
-        int max_class_id = -1;
-        for (int j = 0; j < num_classes; ++j) {
-            float class_score = detection[5 + j];
-            if (class_score > max_class_score) {
-                max_class_score = class_score;
-                max_class_id = j;
-            }
-        }
-        
-        float final_confidence = confidence * max_class_score;
-        if (final_confidence < confidence_threshold_) {
-            continue;
-        }
-        
-        if (max_class_id < 0 || max_class_id >= static_cast<int>(class_names_.size())) {
-            continue;
-        }
-        
-        // Extract bounding box (center format)
-        float center_x = detection[0];
-        float center_y = detection[1];
-        float width = detection[2];
-        float height = detection[3];
-        
-        // Convert to corner format and scale to frame size
-        float x1 = (center_x - width / 2) * frame.cols / INPUT_WIDTH;
-        float y1 = (center_y - height / 2) * frame.rows / INPUT_HEIGHT;
-        float x2 = (center_x + width / 2) * frame.cols / INPUT_WIDTH;
-        float y2 = (center_y + height / 2) * frame.rows / INPUT_HEIGHT;
-        
-        cv::Rect bbox(cv::Point(static_cast<int>(x1), static_cast<int>(y1)),
-                      cv::Point(static_cast<int>(x2), static_cast<int>(y2)));
-        
-        // Collect boxes for NMS
-        boxes.push_back(bbox);
-        confidences.push_back(final_confidence);
-        class_ids.push_back(max_class_id);
-    }
-    
-    // Apply Non-Maximum Suppression to eliminate overlapping boxes
-    std::vector<int> indices;
-    if (!boxes.empty()) {
-        // NMS threshold of 0.45 is standard for YOLO
-        // This means boxes with IoU > 0.45 (45% overlap) will be suppressed
-        cv::dnn::NMSBoxes(boxes, confidences, confidence_threshold_, 0.45f, indices);
-    }
+    // Objectness-first decode that only scores the target classes
+    YoloUtils::decodeYoloV5(data, num_detections, num_classes + 5, target_class_ids_,
+                            static_cast<float>(confidence_threshold_), candidates_);
     
-    // Build final detections from NMS results
-    for (int idx : indices) {
-        Detection det;
-        det.bbox = boxes[idx];
-        det.confidence = confidences[idx];
-        det.class_id = class_ids[idx];
-        det.class_name = class_names_[class_ids[idx]];
-        detections.push_back(det);
-    }
+    YoloUtils::suppressCandidates(candidates_, letterbox, frame.size(), NMS_IOU_THRESHOLD,
+                                  registry_ids_, nms_, detections);
     
     return detections;
 }
@@ -368,7 +391,7 @@ void YoloV5SmallModel::updateInferenceTime(int inference_time_ms) const {
 
 YoloV5LargeModel::YoloV5LargeModel(std::shared_ptr<Logger> logger)
     : logger_(logger), confidence_threshold_(0.5), detection_scale_factor_(1.0),
-      initialized_(false), enable_gpu_(false), avg_inference_time_ms_(120) {
+      initialized_(false), enable_gpu_(false), dynamic_input_size_(true), batch_supported_(true), avg_inference_time_ms_(120) {
 }
 
 bool YoloV5LargeModel::initialize(const std::string& model_path,
@@ -394,6 +417,13 @@ bool YoloV5LargeModel::initialize(const std::string& model_path,
         logger_->error("Failed to load class names");
         return false;
     }
+    registry_ids_ = ClassRegistry::internAll(class_names_);
+
+    target_class_ids_ = YoloUtils::resolveClassIds(target_class_names_, class_names_);
+    if (!target_class_names_.empty()) {
+        logger_->debug("Scoring " + std::to_string(target_class_ids_.size()) + " of " +
+                      std::to_string(class_names_.size()) + " classes");
+    }
 
     // Load the model
     if (!loadModel(model_path)) {
@@ -408,6 +438,14 @@ bool YoloV5LargeModel::initialize(const std::string& model_path,
 }
 
 std::vector<Detection> YoloV5LargeModel::detect(const cv::Mat& frame) {
+    return detectScaled(frame, detection_scale_factor_);
+}
+
+std::vector<Detection> YoloV5LargeModel::detectRegion(const cv::Mat& crop) {
+    return detectScaled(crop, 1.0);
+}
+
+std::vector<Detection> YoloV5LargeModel::detectScaled(const cv::Mat& frame, double scale_factor) {
     if (!initialized_ || frame.empty()) {
         return {};
     }
@@ -416,29 +454,24 @@ std::vector<Detection> YoloV5LargeModel::detect(const cv::Mat& frame) {
     std::vector<Detection> detections;
 
     try {
-        // Downscale frame if scale factor is less than 1.0
-        cv::Mat detection_frame = frame;
-        if (detection_scale_factor_ < 1.0) {
-            int new_width = static_cast<int>(frame.cols * detection_scale_factor_);
-            int new_height = static_cast<int>(frame.rows * detection_scale_factor_);
-            cv::resize(frame, detection_frame, cv::Size(new_width, new_height), 0, 0, cv::INTER_LINEAR);
+        // The scale factor picks a smaller stride-aligned network input instead of
+        // shrinking the frame and letting the blob stretch it back up
+        int input_size = dynamic_input_size_
+            ? YoloUtils::computeInputSize(frame.size(), scale_factor, INPUT_WIDTH)
+            : INPUT_WIDTH;
+        try {
+            detections = runNetwork(frame, input_size);
+        } catch (const cv::Exception&) {
+            if (input_size == INPUT_WIDTH) {
+                throw;
+            }
+            // Models exported with a fixed input shape cannot be reshaped
+            logger_->warning("YOLOv5l rejected " + std::to_string(input_size) + "x" + std::to_string(input_size) +
+                             " input, using " + std::to_string(INPUT_WIDTH) + "x" + std::to_string(INPUT_HEIGHT) +
+                             " (re-export the model with dynamic axes to enable smaller inputs)");
+            dynamic_input_size_ = false;
+            detections = runNetwork(frame, INPUT_WIDTH);
         }
-        
-        // Create blob from image (larger input size for better accuracy)
-        cv::Mat blob;
-        cv::dnn::blobFromImage(detection_frame, blob, SCALE_FACTOR, 
-                              cv::Size(INPUT_WIDTH, INPUT_HEIGHT), 
-                              MEAN, true, false, CV_32F);
-
-        // Set input to the network
-        net_.setInput(blob);
-
-        // Forward pass
-        std::vector<cv::Mat> outputs;
-        net_.forward(outputs, net_.getUnconnectedOutLayersNames());
-
-        // Post-process the outputs (pass original frame for proper bbox scaling)
-        detections = postProcess(frame, outputs);
 
     } catch (const cv::Exception& e) {
         logger_->error("OpenCV error during YOLOv5l detection: " + std::string(e.what()));
@@ -454,6 +487,40 @@ std::vector<Detection> YoloV5LargeModel::detect(const cv::Mat& frame) {
     return detections;
 }
 
+std::vector<std::vector<Detection>> YoloV5LargeModel::detectBatch(const std::vector<cv::Mat>& frames) {
+    if (!initialized_ || !batch_supported_ || frames.size() < 2) {
+        return IDetectionModel::detectBatch(frames);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<std::vector<Detection>> results(frames.size());
+
+    bool batched = false;
+    try {
+        batched = runBatch(frames, results);
+    } catch (const cv::Exception& e) {
+        logger_->debug("YOLOv5l batch error: " + std::string(e.what()));
+    } catch (const std::exception& e) {
+        logger_->error("Error during YOLOv5l batch detection: " + std::string(e.what()));
+        return results;
+    }
+
+    if (!batched) {
+        // Exports with a fixed batch axis of 1 either throw or return a single image
+        logger_->warning("YOLOv5l rejected a batch of " + std::to_string(frames.size()) +
+                         " frames, running frames one at a time (re-export the model with dynamic axes to enable batching)");
+        batch_supported_ = false;
+        return IDetectionModel::detectBatch(frames);
+    }
+
+    // Track per-frame cost so metrics stay comparable with detect()
+    auto end_time = std::chrono::steady_clock::now();
+    auto inference_time = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    updateInferenceTime(static_cast<int>(inference_time.count() / static_cast<long>(frames.size())));
+
+    return results;
+}
+
 ModelMetrics YoloV5LargeModel::getMetrics() const {
     return {
         "YOLOv5l",
@@ -478,10 +545,18 @@ std::string YoloV5LargeModel::getModelName() const {
     return "YOLOv5 Large";
 }
 
+int YoloV5LargeModel::getInputSize() const {
+    return INPUT_WIDTH;
+}
+
 void YoloV5LargeModel::setEnableGpu(bool enable_gpu) {
     enable_gpu_ = enable_gpu;
 }
 
+void YoloV5LargeModel::setTargetClasses(const std::vector<std::string>& class_names) {
+    target_class_names_ = class_names;
+}
+
 void YoloV5LargeModel::warmUp() {
     if (!initialized_) {
         return;
@@ -505,20 +580,7 @@ bool YoloV5LargeModel::loadClassNames(const std::string& classes_path) {
     if (!class_file.is_open()) {
         // If COCO classes file doesn't exist, create a basic one
         logger_->warning("Classes file not found, using built-in COCO classes");
-        class_names_ = {
-            "person", "bicycle", "car", "motorcycle", "airplane", "bus", "train", "truck",
-            "boat", "traffic light", "fire hydrant", "stop sign", "parking meter", "bench",
-            "bird", "cat", "dog", "horse", "sheep", "cow", "elephant", "bear", "zebra",
-            "giraffe", "backpack", "umbrella", "handbag", "tie", "suitcase", "frisbee",
-            "skis", "snowboard", "sports ball", "kite", "baseball bat", "baseball glove",
-            "skateboard", "surfboard", "tennis racket", "bottle", "wine glass", "cup",
-            "fork", "knife", "spoon", "bowl", "banana", "apple", "sandwich", "orange",
-            "broccoli", "carrot", "hot dog", "pizza", "donut", "cake", "chair", "couch",
-            "potted plant", "bed", "dining table", "toilet", "tv", "laptop", "mouse",
-            "remote", "keyboard", "cell phone", "microwave", "oven", "toaster", "sink",
-            "refrigerator", "book", "clock", "vase", "scissors", "teddy bear", "hair drier",
-            "toothbrush"
-        };
+        class_names_ = YoloUtils::cocoClassNames();
         return true;
     }
 
@@ -552,9 +614,19 @@ bool YoloV5LargeModel::loadModel(const std::string& model_path) {
             return false;
         }
 
+        // QDQ/QOperator INT8 and FP16 exports load through the same importer, but
+        // OpenCV only implements the quantized layers on its own CPU backend
+        OnnxModelInfo::Summary model_info = OnnxModelInfo::inspect(model_path);
+        logger_->info("YOLOv5l model precision: " + OnnxModelInfo::describe(model_info));
+        bool use_gpu = enable_gpu_;
+        if (use_gpu && model_info.precision == OnnxModelInfo::Precision::INT8) {
+            logger_->warning("YOLOv5l INT8 model runs on the CPU only, ignoring GPU acceleration");
+            use_gpu = false;
+        }
+
         // Select backend based on platform and available hardware
 #ifdef __APPLE__
-        if (enable_gpu_) {
+        if (use_gpu) {
             // Try to use GPU acceleration on macOS via OpenCL
             try {
                 net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
@@ -572,7 +644,7 @@ bool YoloV5LargeModel::loadModel(const std::string& model_path) {
         }
 #else
         // Try to use GPU if available and enabled on other platforms
-        if (enable_gpu_) {
+        if (use_gpu) {
             try {
                 net_.setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
                 net_.setPreferableTarget(cv::dnn::DNN_TARGET_CUDA);
@@ -601,19 +673,58 @@ bool YoloV5LargeModel::loadModel(const std::string& model_path) {
     }
 }
 
+std::vector<Detection> YoloV5LargeModel::runNetwork(const cv::Mat& frame, int input_size) {
+    YoloUtils::Letterbox letterbox = YoloUtils::computeLetterbox(frame.size(), input_size);
+
+    // Fused letterbox + BGR->RGB + 1/255 + HWC->CHW into the persistent input tensor
+    YoloUtils::letterboxToBlob(frame, letterbox, SCALE_FACTOR, resize_buffer_, input_blob_);
+
+    net_.setInput(input_blob_);
+
+    std::vector<cv::Mat> outputs;
+    net_.forward(outputs, net_.getUnconnectedOutLayersNames());
+
+    return postProcess(frame, letterbox, outputs);
+}
+
+bool YoloV5LargeModel::runBatch(const std::vector<cv::Mat>& frames,
+                                std::vector<std::vector<Detection>>& results) {
+    if (!YoloUtils::prepareBatch(frames, dynamic_input_size_ ? 0 : INPUT_WIDTH, detection_scale_factor_,
+                                 INPUT_WIDTH, SCALE_FACTOR, batch_, resize_buffer_, input_blob_)) {
+        return true;
+    }
+
+    // [N, 3, H, W] blob -> one forward pass -> [N, rows, 5 + classes]
+    net_.setInput(input_blob_);
+    std::vector<cv::Mat> outputs;
+    net_.forward(outputs, net_.getUnconnectedOutLayersNames());
+    if (!YoloUtils::acceptBatchOutput(outputs, batch_.size())) {
+        return false;
+    }
+
+    YoloUtils::scatterBatch(batch_, results, [&](size_t b) {
+        return postProcess(batch_.frames[b], batch_.letterboxes[b], outputs, static_cast<int>(b));
+    });
+    return true;
+}
+
 std::vector<Detection> YoloV5LargeModel::postProcess(
-    const cv::Mat& frame, const std::vector<cv::Mat>& outputs) {
+    const cv::Mat& frame, const YoloUtils::Letterbox& letterbox, const std::vector<cv::Mat>& outputs,
+    int batch_index) {
     
-    // Same post-processing logic as small model, but with larger input dimensions
+    // Same post-processing logic as small model
     std::vector<Detection> detections;
     
     if (outputs.empty()) {
         return detections;
     }
 
-    const cv::Mat& output = outputs[0];
+    cv::Mat output = outputs[0];
+    if (output.depth() != CV_32F) {
+        output.convertTo(output, CV_32F);  // FP16 exports may return half-precision outputs
+    }
     
-    if (output.dims != 3) {
+    if (output.dims != 3 || batch_index >= output.size[0]) {
         logger_->debug("Unexpected YOLOv5l output dimensions: " + std::to_string(output.dims));
         return detections;
     }
@@ -621,78 +732,14 @@ std::vector<Detection> YoloV5LargeModel::postProcess(
     const int num_detections = output.size[1];
     const int num_classes = output.size[2] - 5;
     
-    float* data = (float*)output.data;
+    const float* data = output.ptr<float>(batch_index);  // Slice of this frame in a batched output
     
-    // Temporary storage for NMS
-    std::vector<cv::Rect> boxes;
-    std::vector<float> confidences;
-    std::vector<int> class_ids;
+    // Objectness-first decode that only scores the target classes
+    YoloUtils::decodeYoloV5(data, num_detections, num_classes + 5, target_class_ids_,
+                            static_cast<float>(confidence_threshold_), candidates_);
     
-    for (int i = 0; i < num_detections; ++i) {
-        float* detection = data + i * (num_classes + 5);
-        
-        float confidence = detection[4];
-        if (confidence < confidence_threshold_) {
-            continue;
-        }
-        
-        // Find the class with maximum score
-        float max_class_score = 0;
-        int max_class_id = -1;
-        for (int j = 0; j < num_classes; ++j) {
-            float class_score = detection[5 + j];
-            if (class_score > max_class_score) {
-                max_class_score = class_score;
-                max_class_id = j;
-            }
-        }
-        
-        float final_confidence = confidence * max_class_score;
-        if (final_confidence < confidence_threshold_) {
-            continue;
-        }
-        
-        if (max_class_id < 0 || max_class_id >= static_cast<int>(class_names_.size())) {
-            continue;
-        }
-        
-        // Extract bounding box and scale to frame size (using larger input dimensions)
-        float center_x = detection[0];
-        float center_y = detection[1];
-        float width = detection[2];
-        float height = detection[3];
-        
-        float x1 = (center_x - width / 2) * frame.cols / INPUT_WIDTH;
-        float y1 = (center_y - height / 2) * frame.rows / INPUT_HEIGHT;
-        float x2 = (center_x + width / 2) * frame.cols / INPUT_WIDTH;
-        float y2 = (center_y + height / 2) * frame.rows / INPUT_HEIGHT;
-        
-        cv::Rect bbox(cv::Point(static_cast<int>(x1), static_cast<int>(y1)),
-                      cv::Point(static_cast<int>(x2), static_cast<int>(y2)));
-        
-        // Collect boxes for NMS
-        boxes.push_back(bbox);
-        confidences.push_back(final_confidence);
-        class_ids.push_back(max_class_id);
-    }
-    
-    // Apply Non-Maximum Suppression to eliminate overlapping boxes
-    std::vector<int> indices;
-    if (!boxes.empty()) {
-        // NMS threshold of 0.45 is standard for YOLO
-        // This means boxes with IoU > 0.45 (45% overlap) will be suppressed
-        cv::dnn::NMSBoxes(boxes, confidences, confidence_threshold_, 0.45f, indices);
-    }
-    
-    // Build final detections from NMS results
-    for (int idx : indices) {
-        Detection det;
-        det.bbox = boxes[idx];
-        det.confidence = confidences[idx];
-        det.class_id = class_ids[idx];
-        det.class_name = class_names_[class_ids[idx]];
-        detections.push_back(det);
-    }
+    YoloUtils::suppressCandidates(candidates_, letterbox, frame.size(), NMS_IOU_THRESHOLD,
+                                  registry_ids_, nms_, detections);
     
     return detections;
 }
@@ -0,0 +1,393 @@
+#include "yolo_v8_model.hpp"
+#include "class_registry.hpp"
+#include "onnx_model_info.hpp"
+#include <fstream>
+#include <algorithm>
+
+// Check if filesystem is available
+#if __has_include(<filesystem>)
+    #include <filesystem>
+    namespace fs = std::filesystem;
+#else
+    // Fallback for older systems
+    #include <sys/stat.h>
+    namespace fs {
+        inline bool exists(const std::string& path) {
+            struct stat buffer;
+            return (stat(path.c_str(), &buffer) == 0);
+        }
+    }
+#endif
+
+YoloV8Model::YoloV8Model(std::shared_ptr<Logger> logger, Variant variant)
+    : logger_(logger), variant_(variant),
+      short_name_(variant == Variant::NANO ? "YOLOv8n" : "YOLOv8m"),
+      confidence_threshold_(0.5), detection_scale_factor_(1.0),
+      initialized_(false), enable_gpu_(false), dynamic_input_size_(true), batch_supported_(true),
+      avg_inference_time_ms_(variant == Variant::NANO ? 35 : 150) {
+}
+
+bool YoloV8Model::initialize(const std::string& model_path,
+                             const std::string& /* config_path */,
+                             const std::string& classes_path,
+                             double confidence_threshold,
+                             double detection_scale_factor) {
+    if (initialized_) {
+        return true;
+    }
+
+    confidence_threshold_ = confidence_threshold;
+    detection_scale_factor_ = detection_scale_factor;
+
+    logger_->info("Initializing " + getModelName() + " model...");
+    logger_->debug("Model path: " + model_path);
+    logger_->debug("Classes path: " + classes_path);
+    logger_->debug("Confidence threshold: " + std::to_string(confidence_threshold_));
+    logger_->debug("Detection scale factor: " + std::to_string(detection_scale_factor_));
+
+    // Load class names
+    if (!loadClassNames(classes_path)) {
+        logger_->error("Failed to load class names");
+        return false;
+    }
+    registry_ids_ = ClassRegistry::internAll(class_names_);
+
+    target_class_ids_ = YoloUtils::resolveClassIds(target_class_names_, class_names_);
+    if (!target_class_names_.empty()) {
+        logger_->debug("Scoring " + std::to_string(target_class_ids_.size()) + " of " +
+                      std::to_string(class_names_.size()) + " classes");
+    }
+
+    // Load the model
+    if (!loadModel(model_path)) {
+        logger_->error("Failed to load " + getModelName() + " model");
+        return false;
+    }
+
+    initialized_ = true;
+    logger_->info(getModelName() + " model initialized successfully");
+
+    return true;
+}
+
+std::vector<Detection> YoloV8Model::detect(const cv::Mat& frame) {
+    return detectScaled(frame, detection_scale_factor_);
+}
+
+std::vector<Detection> YoloV8Model::detectRegion(const cv::Mat& crop) {
+    return detectScaled(crop, 1.0);
+}
+
+std::vector<Detection> YoloV8Model::detectScaled(const cv::Mat& frame, double scale_factor) {
+    if (!initialized_ || frame.empty()) {
+        return {};
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<Detection> detections;
+
+    try {
+        // The scale factor picks a smaller stride-aligned network input
+        int input_size = dynamic_input_size_
+            ? YoloUtils::computeInputSize(frame.size(), scale_factor, INPUT_WIDTH)
+            : INPUT_WIDTH;
+        try {
+            detections = runNetwork(frame, input_size);
+        } catch (const cv::Exception&) {
+            if (input_size == INPUT_WIDTH) {
+                throw;
+            }
+            // Models exported with a fixed input shape cannot be reshaped
+            logger_->warning(short_name_ + " rejected " + std::to_string(input_size) + "x" + std::to_string(input_size) +
+                             " input, using " + std::to_string(INPUT_WIDTH) + "x" + std::to_string(INPUT_HEIGHT) +
+                             " (re-export the model with dynamic=True to enable smaller inputs)");
+            dynamic_input_size_ = false;
+            detections = runNetwork(frame, INPUT_WIDTH);
+        }
+
+    } catch (const cv::Exception& e) {
+        logger_->error("OpenCV error during " + short_name_ + " detection: " + std::string(e.what()));
+    } catch (const std::exception& e) {
+        logger_->error("Error during " + short_name_ + " detection: " + std::string(e.what()));
+    }
+
+    // Update inference timing
+    auto end_time = std::chrono::steady_clock::now();
+    auto inference_time = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    updateInferenceTime(static_cast<int>(inference_time.count()));
+
+    return detections;
+}
+
+std::vector<std::vector<Detection>> YoloV8Model::detectBatch(const std::vector<cv::Mat>& frames) {
+    if (!initialized_ || !batch_supported_ || frames.size() < 2) {
+        return IDetectionModel::detectBatch(frames);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<std::vector<Detection>> results(frames.size());
+
+    bool batched = false;
+    try {
+        batched = runBatch(frames, results);
+    } catch (const cv::Exception& e) {
+        logger_->debug(short_name_ + " batch error: " + std::string(e.what()));
+    } catch (const std::exception& e) {
+        logger_->error("Error during " + short_name_ + " batch detection: " + std::string(e.what()));
+        return results;
+    }
+
+    if (!batched) {
+        // Exports with a fixed batch axis of 1 either throw or return a single image
+        logger_->warning(short_name_ + " rejected a batch of " + std::to_string(frames.size()) +
+                         " frames, running frames one at a time (re-export the model with dynamic=True to enable batching)");
+        batch_supported_ = false;
+        return IDetectionModel::detectBatch(frames);
+    }
+
+    // Track per-frame cost so metrics stay comparable with detect()
+    auto end_time = std::chrono::steady_clock::now();
+    auto inference_time = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    updateInferenceTime(static_cast<int>(inference_time.count() / static_cast<long>(frames.size())));
+
+    return results;
+}
+
+ModelMetrics YoloV8Model::getMetrics() const {
+    if (variant_ == Variant::NANO) {
+        return {
+            "YOLOv8n",
+            "YOLO",
+            0.70,                    // 70% relative accuracy
+            avg_inference_time_ms_,  // Current measured average (~35ms)
+            6,                       // ~6MB model size
+            "Ultra-fast anchor-free nano model for embedded systems and edge devices. "
+            "Recommended for Raspberry Pi deployments."
+        };
+    }
+    return {
+        "YOLOv8m",
+        "YOLO",
+        0.88,                    // 88% relative accuracy
+        avg_inference_time_ms_,  // Current measured average (~150ms)
+        52,                      // ~52MB model size
+        "High-accuracy anchor-free medium model with state-of-the-art performance. "
+        "Best accuracy available but requires more computational resources."
+    };
+}
+
+std::vector<std::string> YoloV8Model::getSupportedClasses() const {
+    return class_names_;
+}
+
+bool YoloV8Model::isInitialized() const {
+    return initialized_;
+}
+
+std::string YoloV8Model::getModelName() const {
+    return variant_ == Variant::NANO ? "YOLOv8 Nano" : "YOLOv8 Medium";
+}
+
+int YoloV8Model::getInputSize() const {
+    return INPUT_WIDTH;
+}
+
+void YoloV8Model::setEnableGpu(bool enable_gpu) {
+    enable_gpu_ = enable_gpu;
+}
+
+void YoloV8Model::setTargetClasses(const std::vector<std::string>& class_names) {
+    target_class_names_ = class_names;
+}
+
+void YoloV8Model::warmUp() {
+    if (!initialized_) {
+        return;
+    }
+
+    logger_->debug("Warming up " + getModelName() + " model...");
+
+    // Create a dummy frame for warm-up
+    cv::Mat dummy_frame(INPUT_HEIGHT, INPUT_WIDTH, CV_8UC3, cv::Scalar(128, 128, 128));
+
+    // Run a few inference passes to warm up
+    for (int i = 0; i < 3; ++i) {
+        detect(dummy_frame);
+    }
+
+    logger_->debug(getModelName() + " model warm-up complete");
+}
+
+bool YoloV8Model::loadClassNames(const std::string& classes_path) {
+    std::ifstream class_file(classes_path);
+    if (!class_file.is_open()) {
+        logger_->warning("Classes file not found, using built-in COCO classes");
+        class_names_ = YoloUtils::cocoClassNames();
+        return true;
+    }
+
+    class_names_.clear();
+    std::string line;
+    while (std::getline(class_file, line)) {
+        if (!line.empty()) {
+            class_names_.push_back(line);
+        }
+    }
+    class_file.close();
+
+    return !class_names_.empty();
+}
+
+bool YoloV8Model::loadModel(const std::string& model_path) {
+    try {
+        // Check if model file exists
+        if (!fs::exists(model_path)) {
+            std::string weights = variant_ == Variant::NANO ? "yolov8n" : "yolov8m";
+            logger_->error(short_name_ + " model file not found: " + model_path);
+            logger_->error("Please export " + weights + ".onnx and place it at the specified path");
+            logger_->error("Example: pip install ultralytics && yolo export model=" + weights +
+                          ".pt format=onnx dynamic=True");
+            return false;
+        }
+
+        // Load the network
+        net_ = cv::dnn::readNetFromONNX(model_path);
+
+        if (net_.empty()) {
+            logger_->error("Failed to load " + short_name_ + " neural network from: " + model_path);
+            return false;
+        }
+
+        // QDQ/QOperator INT8 and FP16 exports load through the same importer, but
+        // OpenCV only implements the quantized layers on its own CPU backend
+        OnnxModelInfo::Summary model_info = OnnxModelInfo::inspect(model_path);
+        logger_->info(short_name_ + " model precision: " + OnnxModelInfo::describe(model_info));
+        bool use_gpu = enable_gpu_;
+        if (use_gpu && model_info.precision == OnnxModelInfo::Precision::INT8) {
+            logger_->warning(short_name_ + " INT8 model runs on the CPU only, ignoring GPU acceleration");
+            use_gpu = false;
+        }
+
+        // Select backend based on platform and available hardware
+#ifdef __APPLE__
+        if (use_gpu) {
+            // Try to use GPU acceleration on macOS via OpenCL
+            try {
+                net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+                net_.setPreferableTarget(cv::dnn::DNN_TARGET_OPENCL);
+                logger_->info(short_name_ + " using OpenCL backend for GPU acceleration (macOS)");
+            } catch (const std::exception& e) {
+                logger_->info(short_name_ + " using CPU backend for inference (OpenCL failed): " + std::string(e.what()));
+                net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+                net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+            }
+        } else {
+            logger_->info(short_name_ + " using CPU backend for inference (macOS)");
+            net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+            net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+        }
+#else
+        // Try to use GPU if available and enabled on other platforms
+        if (use_gpu) {
+            try {
+                net_.setPreferableBackend(cv::dnn::DNN_BACKEND_CUDA);
+                net_.setPreferableTarget(cv::dnn::DNN_TARGET_CUDA);
+                logger_->info(short_name_ + " using CUDA backend for GPU acceleration");
+            } catch (const std::exception& e) {
+                logger_->info(short_name_ + " using CPU backend for inference (CUDA failed): " + std::string(e.what()));
+                net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+                net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+            }
+        } else {
+            logger_->info(short_name_ + " using CPU backend for inference");
+            net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+            net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+        }
+#endif
+
+        logger_->debug(short_name_ + " neural network loaded successfully");
+        return true;
+
+    } catch (const cv::Exception& e) {
+        logger_->error("OpenCV error loading " + short_name_ + " model: " + std::string(e.what()));
+        return false;
+    } catch (const std::exception& e) {
+        logger_->error("Error loading " + short_name_ + " model: " + std::string(e.what()));
+        return false;
+    }
+}
+
+std::vector<Detection> YoloV8Model::runNetwork(const cv::Mat& frame, int input_size) {
+    YoloUtils::Letterbox letterbox = YoloUtils::computeLetterbox(frame.size(), input_size);
+
+    // Fused letterbox + BGR->RGB + 1/255 + HWC->CHW into the persistent input tensor
+    YoloUtils::letterboxToBlob(frame, letterbox, SCALE_FACTOR, resize_buffer_, input_blob_);
+
+    net_.setInput(input_blob_);
+
+    std::vector<cv::Mat> outputs;
+    net_.forward(outputs, net_.getUnconnectedOutLayersNames());
+
+    return postProcess(frame, letterbox, outputs);
+}
+
+bool YoloV8Model::runBatch(const std::vector<cv::Mat>& frames,
+                           std::vector<std::vector<Detection>>& results) {
+    if (!YoloUtils::prepareBatch(frames, dynamic_input_size_ ? 0 : INPUT_WIDTH, detection_scale_factor_,
+                                 INPUT_WIDTH, SCALE_FACTOR, batch_, resize_buffer_, input_blob_)) {
+        return true;
+    }
+
+    // [N, 3, H, W] blob -> one forward pass -> [N, 4 + classes, anchors]
+    net_.setInput(input_blob_);
+    std::vector<cv::Mat> outputs;
+    net_.forward(outputs, net_.getUnconnectedOutLayersNames());
+    if (!YoloUtils::acceptBatchOutput(outputs, batch_.size())) {
+        return false;
+    }
+
+    YoloUtils::scatterBatch(batch_, results, [&](size_t b) {
+        return postProcess(batch_.frames[b], batch_.letterboxes[b], outputs, static_cast<int>(b));
+    });
+    return true;
+}
+
+std::vector<Detection> YoloV8Model::postProcess(
+    const cv::Mat& frame, const YoloUtils::Letterbox& letterbox, const std::vector<cv::Mat>& outputs,
+    int batch_index) {
+
+    std::vector<Detection> detections;
+
+    if (outputs.empty()) {
+        return detections;
+    }
+
+    // YOLOv8 output format: [batch, 4 + classes, anchors] - channel-major, no objectness
+    cv::Mat output = outputs[0];
+    if (output.depth() != CV_32F) {
+        output.convertTo(output, CV_32F);  // FP16 exports may return half-precision outputs
+    }
+
+    if (output.dims != 3 || batch_index >= output.size[0] ||
+        output.size[1] <= 4 || output.size[1] > output.size[2]) {
+        logger_->debug("Unexpected " + short_name_ + " output shape (expected [1, 4 + classes, anchors])");
+        return detections;
+    }
+
+    const int channels = output.size[1];
+    const int anchors = output.size[2];
+
+    // Decode straight from the channel-major layout without transposing
+    YoloUtils::decodeYoloV8(output.ptr<float>(batch_index), channels, anchors, target_class_ids_,
+                            static_cast<float>(confidence_threshold_), best_scores_, candidates_);
+
+    YoloUtils::suppressCandidates(candidates_, letterbox, frame.size(), NMS_IOU_THRESHOLD,
+                                  registry_ids_, nms_, detections);
+
+    return detections;
+}
+
+void YoloV8Model::updateInferenceTime(int inference_time_ms) const {
+    // Simple moving average
+    avg_inference_time_ms_ = (avg_inference_time_ms_ * 9 + inference_time_ms) / 10;
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "box_kalman_filter.hpp"
+#include <cmath>
+
+TEST(BoxKalmanFilterTest, NewTrackHoldsStill) {
+    BoxKalmanFilter filter(cv::Rect(100, 200, 50, 100));
+
+    EXPECT_EQ(filter.predict(0.0), cv::Rect(100, 200, 50, 100));
+    EXPECT_EQ(filter.predict(1.0), cv::Rect(100, 200, 50, 100));
+    EXPECT_FLOAT_EQ(filter.getVelocity().x, 0.0f);
+}
+
+TEST(BoxKalmanFilterTest, LearnsConstantVelocity) {
+    // 200 pixels per second to the right, detected at 5 fps
+    BoxKalmanFilter filter(cv::Rect(0, 100, 50, 100));
+    for (int i = 1; i < 8; ++i) {
+        filter.update(cv::Rect(i * 40, 100, 50, 100), 0.2);
+    }
+
+    EXPECT_NEAR(filter.getVelocity().x, 200.0f, 10.0f);
+    EXPECT_NEAR(filter.getVelocity().y, 0.0f, 1.0f);
+    cv::Rect ahead = filter.predict(0.5);
+    EXPECT_NEAR(ahead.x, 280 + 100, 10);
+    EXPECT_NEAR(ahead.y, 100, 1);
+    EXPECT_NEAR(ahead.width, 50, 1);
+    EXPECT_NEAR(ahead.height, 100, 1);
+}
+
+TEST(BoxKalmanFilterTest, JitterDoesNotBecomeMotion) {
+    BoxKalmanFilter filter(cv::Rect(300, 300, 80, 160));
+    for (int i = 1; i < 30; ++i) {
+        int jitter = (i % 2 == 0) ? 3 : -3;
+        filter.update(cv::Rect(300 + jitter, 300 - jitter, 80, 160), 0.2);
+    }
+
+    // 6 pixels peak to peak at 5 fps would be 30 pixels per second if taken at face value
+    EXPECT_LT(std::abs(filter.getVelocity().x), 10.0f);
+    EXPECT_LT(std::abs(filter.getVelocity().y), 10.0f);
+    cv::Rect ahead = filter.predict(1.0);
+    EXPECT_NEAR(ahead.x, 300, 10);
+    EXPECT_NEAR(ahead.y, 300, 10);
+}
+
+TEST(BoxKalmanFilterTest, PredictedBoxKeepsPositiveSize) {
+    // A box shrinking quickly must not turn inside out when extrapolated far ahead
+    BoxKalmanFilter filter(cv::Rect(100, 100, 100, 100));
+    filter.update(cv::Rect(120, 120, 60, 60), 0.2);
+    filter.update(cv::Rect(140, 140, 20, 20), 0.2);
+
+    cv::Rect ahead = filter.predict(5.0);
+    EXPECT_GE(ahead.width, 1);
+    EXPECT_GE(ahead.height, 1);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include "class_registry.hpp"
+#include "detection_model_interface.hpp"
+
+TEST(ClassRegistryTest, NamesMapToStableIds) {
+    int person = ClassRegistry::intern("person");
+    int dog = ClassRegistry::intern("dog");
+    ASSERT_GE(person, 0);
+    ASSERT_GE(dog, 0);
+    EXPECT_NE(person, dog);
+    EXPECT_EQ(ClassRegistry::intern("person"), person);
+    EXPECT_EQ(ClassRegistry::find("dog"), dog);
+    EXPECT_EQ(ClassRegistry::name(person), "person");
+    EXPECT_EQ(ClassRegistry::find("registry test class never interned"), -1);
+    EXPECT_TRUE(ClassRegistry::name(-1).empty());
+
+    auto ids = ClassRegistry::internAll({"dog", "person"});
+    EXPECT_EQ(ids, (std::vector<int>{dog, person}));
+}
+
+TEST(ClassRegistryTest, ColorsFollowClassIds) {
+    EXPECT_EQ(ClassRegistry::color(ClassRegistry::intern("person")), cv::Scalar(0, 255, 0));
+    EXPECT_EQ(ClassRegistry::color(ClassRegistry::intern("truck")), ClassRegistry::color(ClassRegistry::intern("car")));
+    EXPECT_EQ(ClassRegistry::color(ClassRegistry::intern("toaster")), cv::Scalar(255, 255, 255));
+    EXPECT_EQ(ClassRegistry::color(-1), cv::Scalar(255, 255, 255));
+}
+
+TEST(ClassRegistryTest, DetectionsCarryOnlyTheId) {
+    Detection detection;
+    detection.class_id = ClassRegistry::intern("cat");
+    EXPECT_EQ(ClassRegistry::name(detection.class_id), "cat");
+    EXPECT_EQ(ClassRegistry::find("cat"), detection.class_id);
+
+    auto set = ClassRegistry::makeSet({"cat", "bird"});
+    EXPECT_TRUE(ClassRegistry::contains(set, detection.class_id));
+    EXPECT_FALSE(ClassRegistry::contains(set, ClassRegistry::intern("person")));
+    EXPECT_FALSE(ClassRegistry::contains(set, -1));
+}
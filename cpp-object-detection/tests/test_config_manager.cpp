@@ -219,3 +219,254 @@ TEST_F(ConfigManagerTest, GpuDefaultDisabled) {
     const auto& config = config_manager->getConfig();
     EXPECT_FALSE(config.enable_gpu);
 }
+
+TEST_F(ConfigManagerTest, InferenceBackendDefaults) {
+    const auto& config = config_manager->getConfig();
+    EXPECT_EQ(config.inference_backend, "opencv");
+    EXPECT_EQ(config.inter_op_threads, 0);
+    EXPECT_EQ(config.graph_optimization, "all");
+}
+
+TEST_F(ConfigManagerTest, InferenceBackendArguments) {
+    const char* argv[] = {"program", "--backend", "onnxruntime", "--inter-op-threads", "2",
+                          "--graph-optimization", "extended"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_EQ(config.inference_backend, "onnxruntime");
+    EXPECT_EQ(config.inter_op_threads, 2);
+    EXPECT_EQ(config.graph_optimization, "extended");
+    EXPECT_TRUE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, InvalidGraphOptimization) {
+    const char* argv[] = {"program", "--graph-optimization", "aggressive"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, InvalidInterOpThreads) {
+    const char* argv[] = {"program", "--inter-op-threads", "-1"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, InferenceBatchArguments) {
+    EXPECT_EQ(config_manager->getConfig().inference_batch_size, 1);
+    
+    const char* argv[] = {"program", "--inference-batch-size", "4", "--batch-timeout-ms", "20"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_EQ(config.inference_batch_size, 4);
+    EXPECT_EQ(config.batch_timeout_ms, 20);
+    EXPECT_TRUE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, InferenceBatchLargerThanQueueIsInvalid) {
+    const char* argv[] = {"program", "--inference-batch-size", "8", "--max-frame-queue", "4"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, CaptureBackendArguments) {
+    EXPECT_EQ(config_manager->getConfig().capture_backend, "opencv");
+    EXPECT_FALSE(config_manager->getConfig().stream_passthrough);
+    
+    const char* argv[] = {"program", "--capture-backend", "v4l2", "--enable-streaming", "--stream-passthrough",
+                          "--reduced-decode"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_EQ(config.capture_backend, "v4l2");
+    EXPECT_TRUE(config.stream_passthrough);
+    EXPECT_TRUE(config.reduced_decode);
+    EXPECT_TRUE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, UnknownCaptureBackendIsInvalid) {
+    const char* argv[] = {"program", "--capture-backend", "directshow"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, FrameSourceArguments) {
+    EXPECT_EQ(config_manager->getConfig().frame_source, "webcam");
+    
+    const char* argv[] = {"program", "--source", "video", "--source-path", "/tmp/clip.mp4", "--source-fps", "15",
+                          "--source-pacing", "fast", "--source-loop", "--source-frames", "500"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_EQ(config.frame_source, "video");
+    EXPECT_EQ(config.source_path, "/tmp/clip.mp4");
+    EXPECT_DOUBLE_EQ(config.source_fps, 15.0);
+    EXPECT_EQ(config.source_pacing, "fast");
+    EXPECT_TRUE(config.source_loop);
+    EXPECT_EQ(config.source_frame_limit, 500);
+    EXPECT_TRUE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, FileSourceWithoutPathIsInvalid) {
+    const char* argv[] = {"program", "--source", "images"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, UnknownSourcePacingIsInvalid) {
+    const char* argv[] = {"program", "--source", "synthetic", "--source-pacing", "slow"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, MultipleCameraIds) {
+    const char* argv[] = {"program", "--camera-id", "0,2", "--camera-id", "4"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_EQ(config.camera_id, 0);
+    EXPECT_EQ(config.camera_ids, (std::vector<int>{0, 2, 4}));
+    EXPECT_TRUE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, DuplicateCameraIdIsInvalid) {
+    const char* argv[] = {"program", "--camera-id", "1,1"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, MotionGateArguments) {
+    const char* argv[] = {"program", "--motion-gate", "--motion-threshold", "0.02"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_TRUE(config_manager->validateConfig());
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_TRUE(config.enable_motion_gate);
+    EXPECT_DOUBLE_EQ(config.motion_threshold, 0.02);
+}
+
+TEST_F(ConfigManagerTest, MotionThresholdOutOfRangeIsInvalid) {
+    const char* argv[] = {"program", "--motion-threshold", "1.5"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, MotionRoiArguments) {
+    const char* argv[] = {"program", "--motion-roi", "--max-motion-rois", "2"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_TRUE(config_manager->validateConfig());
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_TRUE(config.enable_motion_roi);
+    EXPECT_EQ(config.max_motion_rois, 2);
+}
+
+TEST_F(ConfigManagerTest, MaxMotionRoisOutOfRangeIsInvalid) {
+    const char* argv[] = {"program", "--max-motion-rois", "0"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, TilingArguments) {
+    const char* argv[] = {"program", "--tiles", "--tile-grid", "3x2", "--tile-overlap", "0.25",
+                          "--tile-interval", "4", "--tile-every-frame", "0,1,2"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_TRUE(config_manager->validateConfig());
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_TRUE(config.enable_tiling);
+    EXPECT_EQ(config.tile_columns, 3);
+    EXPECT_EQ(config.tile_rows, 2);
+    EXPECT_DOUBLE_EQ(config.tile_overlap, 0.25);
+    EXPECT_EQ(config.tile_interval, 4);
+    EXPECT_EQ(config.tile_every_frame, (std::vector<int>{0, 1, 2}));
+}
+
+TEST_F(ConfigManagerTest, InvalidTileSettings) {
+    const char* bad_grid[] = {"program", "--tile-grid", "3by2"};
+    EXPECT_EQ(config_manager->parseArgs(3, const_cast<char**>(bad_grid)), ConfigManager::ParseResult::PARSE_ERROR);
+    
+    const char* bad_overlap[] = {"program", "--tile-overlap", "0.8"};
+    EXPECT_EQ(config_manager->parseArgs(3, const_cast<char**>(bad_overlap)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, InferenceIntervalArgument) {
+    EXPECT_EQ(config_manager->getConfig().inference_interval, 1);
+    
+    const char* argv[] = {"program", "--inference-interval", "5"};
+    EXPECT_EQ(config_manager->parseArgs(3, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_TRUE(config_manager->validateConfig());
+    EXPECT_EQ(config_manager->getConfig().inference_interval, 5);
+    
+    const char* zero[] = {"program", "--inference-interval", "0"};
+    EXPECT_EQ(config_manager->parseArgs(3, const_cast<char**>(zero)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, OpticalFlowNeedsInferenceInterval) {
+    const char* alone[] = {"program", "--optical-flow"};
+    EXPECT_EQ(config_manager->parseArgs(2, const_cast<char**>(alone)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_TRUE(config_manager->getConfig().enable_optical_flow);
+    EXPECT_FALSE(config_manager->validateConfig());
+    
+    const char* argv[] = {"program", "--optical-flow", "--inference-interval", "5"};
+    EXPECT_EQ(config_manager->parseArgs(4, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_TRUE(config_manager->validateConfig());
+}
+
+TEST_F(ConfigManagerTest, DetectionZoneArguments) {
+    const char* argv[] = {"program", "--exclude-zone", "0.6,0;1,0;1,0.4", "--exclude-zone", "0,0;0.2,0;0.2,0.2",
+                          "--include-zone", "0,0.3;1,0.3;1,1;0,1"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_TRUE(config_manager->validateConfig());
+    
+    const auto& config = config_manager->getConfig();
+    EXPECT_EQ(config.exclude_zones.size(), 2u);
+    ASSERT_EQ(config.include_zones.size(), 1u);
+    EXPECT_EQ(config.include_zones[0], "0,0.3;1,0.3;1,1;0,1");
+}
+
+TEST_F(ConfigManagerTest, InvalidZoneIsRejected) {
+    const char* argv[] = {"program", "--exclude-zone", "0,0;2,0;1,1"};
+    int argc = sizeof(argv) / sizeof(argv[0]);
+    
+    EXPECT_EQ(config_manager->parseArgs(argc, const_cast<char**>(argv)), ConfigManager::ParseResult::SUCCESS);
+    EXPECT_FALSE(config_manager->validateConfig());
+}
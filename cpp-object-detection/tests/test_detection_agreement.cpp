@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "detection_agreement.hpp"
+#include "class_registry.hpp"
+#include <vector>
+
+namespace {
+
+Detection makeDetection(const std::string& class_name, cv::Rect bbox, double confidence) {
+    Detection det;
+    det.class_id = ClassRegistry::intern(class_name);
+    det.bbox = bbox;
+    det.confidence = confidence;
+    return det;
+}
+
+}  // namespace
+
+TEST(DetectionAgreementTest, IdenticalDetectionsAgreeFully) {
+    std::vector<Detection> detections = {
+        makeDetection("person", cv::Rect(10, 10, 50, 100), 0.9),
+        makeDetection("car", cv::Rect(200, 50, 120, 80), 0.8)
+    };
+
+    DetectionAgreement agreement;
+    agreement.addFrame(detections, detections);
+
+    EXPECT_EQ(agreement.totals().matched, 2u);
+    EXPECT_DOUBLE_EQ(agreement.recall(), 1.0);
+    EXPECT_DOUBLE_EQ(agreement.precision(), 1.0);
+    EXPECT_DOUBLE_EQ(agreement.meanIou(), 1.0);
+    EXPECT_DOUBLE_EQ(agreement.meanConfidenceDelta(), 0.0);
+}
+
+TEST(DetectionAgreementTest, MissedAndExtraDetections) {
+    std::vector<Detection> reference = {
+        makeDetection("person", cv::Rect(10, 10, 50, 100), 0.9),
+        makeDetection("dog", cv::Rect(300, 300, 40, 30), 0.6)
+    };
+    std::vector<Detection> candidate = {
+        makeDetection("person", cv::Rect(12, 12, 50, 100), 0.85),  // Slightly shifted
+        makeDetection("cat", cv::Rect(300, 300, 40, 30), 0.55),    // Class changed
+        makeDetection("car", cv::Rect(500, 100, 90, 60), 0.7)      // Not in reference
+    };
+
+    DetectionAgreement agreement;
+    agreement.addFrame(reference, candidate);
+
+    EXPECT_EQ(agreement.totals().matched, 1u);
+    EXPECT_DOUBLE_EQ(agreement.recall(), 0.5);
+    EXPECT_NEAR(agreement.precision(), 1.0 / 3.0, 1e-9);
+    EXPECT_NEAR(agreement.meanConfidenceDelta(), 0.05, 1e-9);
+    EXPECT_EQ(agreement.perClass().at("dog").matched, 0u);
+    EXPECT_EQ(agreement.perClass().at("car").candidate, 1u);
+}
+
+TEST(DetectionAgreementTest, LowOverlapDoesNotMatch) {
+    std::vector<Detection> reference = {makeDetection("person", cv::Rect(0, 0, 100, 100), 0.9)};
+    std::vector<Detection> candidate = {makeDetection("person", cv::Rect(60, 0, 100, 100), 0.9)};
+
+    DetectionAgreement agreement(0.5);
+    agreement.addFrame(reference, candidate);
+
+    EXPECT_EQ(agreement.totals().matched, 0u);
+}
+
+TEST(DetectionAgreementTest, EachCandidateMatchesOnce) {
+    // Two overlapping reference people, one candidate: the more confident one claims it
+    std::vector<Detection> reference = {
+        makeDetection("person", cv::Rect(0, 0, 100, 200), 0.6),
+        makeDetection("person", cv::Rect(5, 0, 100, 200), 0.9)
+    };
+    std::vector<Detection> candidate = {makeDetection("person", cv::Rect(3, 0, 100, 200), 0.8)};
+
+    DetectionAgreement agreement;
+    agreement.addFrame(reference, candidate);
+
+    EXPECT_EQ(agreement.totals().matched, 1u);
+    EXPECT_NEAR(agreement.meanConfidenceDelta(), 0.1, 1e-9);
+}
+
+TEST(DetectionAgreementTest, AccumulatesAcrossFrames) {
+    std::vector<Detection> person = {makeDetection("person", cv::Rect(10, 10, 50, 100), 0.9)};
+
+    DetectionAgreement agreement;
+    agreement.addFrame(person, person);
+    agreement.addFrame(person, {});
+    agreement.addFrame({}, {});
+
+    EXPECT_EQ(agreement.frames(), 3u);
+    EXPECT_EQ(agreement.totals().reference, 2u);
+    EXPECT_DOUBLE_EQ(agreement.recall(), 0.5);
+    EXPECT_DOUBLE_EQ(agreement.precision(), 1.0);
+}
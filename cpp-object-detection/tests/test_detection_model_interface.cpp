@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include "../include/detection_model_interface.hpp"
+#include "../include/class_registry.hpp"
 #include "../include/yolo_v5_model.hpp"
+#include "../include/yolo_v8_model.hpp"
 #include "../include/logger.hpp"
 
 class DetectionModelInterfaceTest : public ::testing::Test {
@@ -35,10 +37,9 @@ public:
         
         // Mock detection: return a single person detection
         Detection det;
-        det.class_name = "person";
+        det.class_id = ClassRegistry::intern("person");
         det.confidence = 0.8;
         det.bbox = cv::Rect(100, 100, 200, 300);
-        det.class_id = 0;
         
         return {det};
     }
@@ -97,7 +98,7 @@ TEST_F(DetectionModelInterfaceTest, MockModelDetection) {
     auto detections = model->detect(test_frame);
     
     EXPECT_EQ(detections.size(), 1);
-    EXPECT_EQ(detections[0].class_name, "person");
+    EXPECT_EQ(ClassRegistry::name(detections[0].class_id), "person");
     EXPECT_DOUBLE_EQ(detections[0].confidence, 0.8);
     EXPECT_EQ(detections[0].bbox.x, 100);
     EXPECT_EQ(detections[0].bbox.y, 100);
@@ -179,6 +180,29 @@ TEST_F(DetectionModelInterfaceTest, DetectionModelFactoryModelTypeToString) {
         DetectionModelFactory::ModelType::YOLO_V8_MEDIUM), "yolov8m");
 }
 
+TEST_F(DetectionModelInterfaceTest, DefaultDetectBatchRunsEachFrame) {
+    auto model = std::make_unique<MockDetectionModel>(logger_);
+    model->initialize("test_model.onnx", "", "test_classes.names", 0.5);
+    
+    cv::Mat test_frame(480, 640, CV_8UC3, cv::Scalar(128, 128, 128));
+    auto results = model->detectBatch({test_frame, cv::Mat(), test_frame});
+    
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[0].size(), 1u);
+    EXPECT_TRUE(results[1].empty());  // Empty frames yield no detections
+    EXPECT_EQ(results[2].size(), 1u);
+}
+
+TEST_F(DetectionModelInterfaceTest, UninitializedYoloModelBatchReturnsEmptyResults) {
+    auto model = std::make_unique<YoloV8Model>(logger_, YoloV8Model::Variant::NANO);
+    cv::Mat test_frame(480, 640, CV_8UC3, cv::Scalar(128, 128, 128));
+    
+    auto results = model->detectBatch({test_frame, test_frame});
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_TRUE(results[0].empty());
+    EXPECT_TRUE(results[1].empty());
+}
+
 TEST_F(DetectionModelInterfaceTest, YoloV5SmallModelCreation) {
     auto model = std::make_unique<YoloV5SmallModel>(logger_);
     
@@ -210,6 +234,80 @@ TEST_F(DetectionModelInterfaceTest, YoloV5LargeModelCreation) {
     EXPECT_GT(metrics.accuracy_score, small_metrics.accuracy_score);
 }
 
+TEST_F(DetectionModelInterfaceTest, YoloV8ModelCreation) {
+    auto nano = std::make_unique<YoloV8Model>(logger_, YoloV8Model::Variant::NANO);
+    auto medium = std::make_unique<YoloV8Model>(logger_, YoloV8Model::Variant::MEDIUM);
+    
+    EXPECT_EQ(nano->getModelName(), "YOLOv8 Nano");
+    EXPECT_EQ(medium->getModelName(), "YOLOv8 Medium");
+    EXPECT_FALSE(nano->isInitialized());
+    
+    auto nano_metrics = nano->getMetrics();
+    auto medium_metrics = medium->getMetrics();
+    EXPECT_EQ(nano_metrics.model_name, "YOLOv8n");
+    EXPECT_EQ(medium_metrics.model_name, "YOLOv8m");
+    EXPECT_GT(medium_metrics.accuracy_score, nano_metrics.accuracy_score);
+    EXPECT_LT(nano_metrics.avg_inference_time_ms, medium_metrics.avg_inference_time_ms);
+}
+
+TEST_F(DetectionModelInterfaceTest, DetectionModelFactoryCreatesYoloV8) {
+    // YOLOv8 types must no longer fall back to YOLOv5
+    auto nano = DetectionModelFactory::createModel(
+        DetectionModelFactory::ModelType::YOLO_V8_NANO, logger_);
+    auto medium = DetectionModelFactory::createModel(
+        DetectionModelFactory::ModelType::YOLO_V8_MEDIUM, logger_);
+    
+    ASSERT_NE(nano, nullptr);
+    ASSERT_NE(medium, nullptr);
+    EXPECT_NE(dynamic_cast<YoloV8Model*>(nano.get()), nullptr);
+    EXPECT_EQ(nano->getModelName(), "YOLOv8 Nano");
+    EXPECT_EQ(medium->getModelName(), "YOLOv8 Medium");
+}
+
+TEST_F(DetectionModelInterfaceTest, YoloV8MissingModelFileFailsInitialization) {
+    auto model = std::make_unique<YoloV8Model>(logger_, YoloV8Model::Variant::NANO);
+    
+    EXPECT_FALSE(model->initialize("non_existent_yolov8n.onnx", "", "test_classes.names", 0.5, 0.5));
+    EXPECT_FALSE(model->isInitialized());
+    EXPECT_TRUE(model->detect(cv::Mat::zeros(64, 64, CV_8UC3)).empty());
+}
+
+TEST_F(DetectionModelInterfaceTest, DetectionModelFactoryParseBackend) {
+    EXPECT_EQ(DetectionModelFactory::parseBackend("opencv"),
+              DetectionModelFactory::Backend::OPENCV_DNN);
+    EXPECT_EQ(DetectionModelFactory::parseBackend("OnnxRuntime"),
+              DetectionModelFactory::Backend::ONNX_RUNTIME);
+    EXPECT_EQ(DetectionModelFactory::parseBackend("ort"),
+              DetectionModelFactory::Backend::ONNX_RUNTIME);
+    EXPECT_EQ(DetectionModelFactory::backendToString(DetectionModelFactory::Backend::ONNX_RUNTIME),
+              "onnxruntime");
+    
+    EXPECT_THROW(DetectionModelFactory::parseBackend("tensorrt"), std::invalid_argument);
+    EXPECT_TRUE(DetectionModelFactory::isBackendAvailable(DetectionModelFactory::Backend::OPENCV_DNN));
+}
+
+TEST_F(DetectionModelInterfaceTest, OnnxRuntimeBackendCreatesModelOrFallsBack) {
+    DetectionModelFactory::BackendOptions options;
+    options.backend = DetectionModelFactory::Backend::ONNX_RUNTIME;
+    options.intra_op_threads = 2;
+    
+    auto model = DetectionModelFactory::createModel(
+        DetectionModelFactory::ModelType::YOLO_V5_SMALL, logger_, options);
+    ASSERT_NE(model, nullptr);
+    EXPECT_FALSE(model->isInitialized());
+    EXPECT_EQ(model->getMetrics().model_name, "YOLOv5s");
+    
+#ifdef HAVE_ONNXRUNTIME
+    EXPECT_TRUE(DetectionModelFactory::isBackendAvailable(options.backend));
+    EXPECT_EQ(model->getModelName(), "YOLOv5s (ONNX Runtime)");
+    EXPECT_FALSE(model->initialize("non_existent_model.onnx", "", "test_classes.names", 0.5, 0.5));
+#else
+    // Without ONNX Runtime at build time the OpenCV DNN model is used instead
+    EXPECT_FALSE(DetectionModelFactory::isBackendAvailable(options.backend));
+    EXPECT_NE(dynamic_cast<YoloV5SmallModel*>(model.get()), nullptr);
+#endif
+}
+
 TEST_F(DetectionModelInterfaceTest, ModelPerformanceComparison) {
     auto available_models = DetectionModelFactory::getAvailableModels();
     
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "detection_zones.hpp"
+#include "class_registry.hpp"
+#include <vector>
+
+namespace {
+
+Detection makeDetection(const cv::Rect& box) {
+    Detection detection;
+    detection.class_id = ClassRegistry::intern("person");
+    detection.confidence = 0.9;
+    detection.bbox = box;
+    return detection;
+}
+
+DetectionZones::Polygon rightHalf() {
+    return {cv::Point2f(0.5f, 0.0f), cv::Point2f(1.0f, 0.0f), cv::Point2f(1.0f, 1.0f), cv::Point2f(0.5f, 1.0f)};
+}
+
+}  // namespace
+
+TEST(DetectionZonesTest, ParsesPolygons) {
+    DetectionZones::Polygon polygon;
+    ASSERT_TRUE(DetectionZones::parsePolygon("0,0;1,0;0.5,0.75", polygon));
+    ASSERT_EQ(polygon.size(), 3u);
+    EXPECT_FLOAT_EQ(polygon[2].x, 0.5f);
+    EXPECT_FLOAT_EQ(polygon[2].y, 0.75f);
+
+    EXPECT_FALSE(DetectionZones::parsePolygon("0,0;1,0", polygon));          // Too few points
+    EXPECT_FALSE(DetectionZones::parsePolygon("0,0;1,0;1.5,1", polygon));    // Outside the frame
+    EXPECT_FALSE(DetectionZones::parsePolygon("0,0;1;1,1", polygon));        // Missing coordinate
+    EXPECT_FALSE(DetectionZones::parsePolygon("0,0;1,0;a,1", polygon));
+    EXPECT_FALSE(DetectionZones::parsePolygon("0,0;1,0;1,1x", polygon));
+    EXPECT_FALSE(DetectionZones::parsePolygon("", polygon));
+}
+
+TEST(DetectionZonesTest, ExcludeZoneIsMaskedOut) {
+    DetectionZones zones({}, {rightHalf()});
+    cv::Mat mask = zones.getMask(cv::Size(100, 100));
+
+    ASSERT_EQ(mask.size(), cv::Size(100, 100));
+    EXPECT_EQ(mask.at<uchar>(50, 10), 255);
+    EXPECT_EQ(mask.at<uchar>(50, 90), 0);
+    EXPECT_NEAR(cv::countNonZero(mask), 5000, 100);
+
+    cv::Mat frame(100, 100, CV_8UC3, cv::Scalar(200, 200, 200));
+    cv::Mat masked = zones.applyMask(frame);
+    EXPECT_EQ(masked.at<cv::Vec3b>(10, 10), cv::Vec3b(200, 200, 200));
+    EXPECT_EQ(masked.at<cv::Vec3b>(80, 80), cv::Vec3b(0, 0, 0));
+    EXPECT_EQ(frame.at<cv::Vec3b>(80, 80), cv::Vec3b(200, 200, 200));  // Input untouched
+}
+
+TEST(DetectionZonesTest, MaskIsAppliedInPlaceAtAnySize) {
+    DetectionZones zones({}, {rightHalf()});
+    cv::Mat color_mask = zones.getMask(cv::Size(160, 90), 3);
+    EXPECT_EQ(color_mask.type(), CV_8UC3);
+    EXPECT_EQ(zones.getMask(cv::Size(160, 90), 3).data, color_mask.data);  // Built once per size
+
+    cv::Mat frame(90, 160, CV_8UC3, cv::Scalar(200, 200, 200));
+    const uchar* buffer = frame.data;
+    zones.applyMask(frame, frame);
+    EXPECT_EQ(frame.data, buffer);
+    EXPECT_EQ(frame.at<cv::Vec3b>(45, 10), cv::Vec3b(200, 200, 200));
+    EXPECT_EQ(frame.at<cv::Vec3b>(45, 150), cv::Vec3b(0, 0, 0));
+}
+
+TEST(DetectionZonesTest, DetectionsOutsideAnalyzedAreaAreDropped) {
+    DetectionZones zones({}, {rightHalf()});
+    std::vector<Detection> detections = {
+        makeDetection(cv::Rect(10, 10, 20, 20)),   // Fully analyzed
+        makeDetection(cv::Rect(70, 10, 20, 20)),   // Fully excluded
+        makeDetection(cv::Rect(45, 50, 20, 20)),   // Mostly excluded
+    };
+    auto kept = zones.filter(detections, cv::Size(100, 100));
+
+    ASSERT_EQ(kept.size(), 1u);
+    EXPECT_EQ(kept[0].bbox, cv::Rect(10, 10, 20, 20));
+    EXPECT_EQ(zones.getFilteredCount(), 2u);
+}
+
+TEST(DetectionZonesTest, IncludeZoneLimitsAnalyzedArea) {
+    DetectionZones::Polygon top_left = {cv::Point2f(0.0f, 0.0f), cv::Point2f(0.5f, 0.0f), cv::Point2f(0.5f, 0.5f),
+                                        cv::Point2f(0.0f, 0.5f)};
+    DetectionZones zones({top_left}, {});
+
+    // Zones are relative, so the same polygon applies at any resolution
+    auto kept = zones.filter({makeDetection(cv::Rect(100, 100, 100, 100)), makeDetection(cv::Rect(900, 500, 100, 100))},
+                             cv::Size(1280, 720));
+    ASSERT_EQ(kept.size(), 1u);
+    EXPECT_EQ(kept[0].bbox.x, 100);
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "flow_tracker.hpp"
+#include "logger.hpp"
+#include <random>
+
+class FlowTrackerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        logger = std::make_shared<Logger>("test_flow_tracker.log", false);
+
+        // Blocky random texture: plenty of corners that survive the downscale
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> level(0, 255);
+        texture = cv::Mat(160, 80, CV_8UC3);
+        for (int y = 0; y < texture.rows; y += 8) {
+            for (int x = 0; x < texture.cols; x += 8) {
+                int value = level(rng);
+                texture(cv::Rect(x, y, 8, 8)).setTo(cv::Scalar(value, value, value));
+            }
+        }
+    }
+
+    // 640x360 gray scene with the textured object at the given position
+    cv::Mat scene(const cv::Point& object) const {
+        cv::Mat frame(360, 640, CV_8UC3, cv::Scalar(128, 128, 128));
+        cv::Mat region = frame(cv::Rect(object.x, object.y, texture.cols, texture.rows));
+        texture.copyTo(region);
+        return frame;
+    }
+
+    std::shared_ptr<Logger> logger;
+    cv::Mat texture;
+};
+
+TEST_F(FlowTrackerTest, FollowsTranslatingObject) {
+    FlowTracker tracker(logger);
+    tracker.setKeyframe(FlowTracker::prepareImage(scene({200, 100})), {cv::Rect(200, 100, 80, 160)},
+                        cv::Size(640, 360));
+
+    std::vector<cv::Rect> boxes;
+    ASSERT_TRUE(tracker.propagate(FlowTracker::prepareImage(scene({212, 106})), boxes));
+    ASSERT_TRUE(tracker.propagate(FlowTracker::prepareImage(scene({224, 112})), boxes));
+
+    ASSERT_EQ(boxes.size(), 1u);
+    const cv::Rect& box = boxes[0];
+    EXPECT_NEAR(box.x, 224, 3);
+    EXPECT_NEAR(box.y, 112, 3);
+    EXPECT_NEAR(box.width, 80, 6);
+    EXPECT_NEAR(box.height, 160, 12);
+    EXPECT_EQ(tracker.getStats().frames_propagated, 2u);
+}
+
+TEST_F(FlowTrackerTest, NewMotionRequestsDetection) {
+    FlowTracker tracker(logger);
+    tracker.setKeyframe(FlowTracker::prepareImage(scene({200, 100})), {cv::Rect(200, 100, 80, 160)},
+                        cv::Size(640, 360));
+
+    // Something walks in at the other end of the frame
+    cv::Mat frame = scene({200, 100});
+    cv::Mat newcomer = frame(cv::Rect(500, 150, texture.cols, texture.rows));
+    texture.copyTo(newcomer);
+
+    std::vector<cv::Rect> boxes;
+    EXPECT_FALSE(tracker.propagate(FlowTracker::prepareImage(frame), boxes));
+    EXPECT_FALSE(tracker.hasKeyframe());
+    EXPECT_EQ(tracker.getStats().new_motion_fallbacks, 1u);
+}
+
+TEST_F(FlowTrackerTest, LostObjectRequestsDetection) {
+    FlowTracker tracker(logger);
+    tracker.setKeyframe(FlowTracker::prepareImage(scene({200, 100})), {cv::Rect(200, 100, 80, 160)},
+                        cv::Size(640, 360));
+
+    // The object is gone, so its points have nothing to follow
+    cv::Mat empty(360, 640, CV_8UC3, cv::Scalar(128, 128, 128));
+    std::vector<cv::Rect> boxes;
+    EXPECT_FALSE(tracker.propagate(FlowTracker::prepareImage(empty), boxes));
+    EXPECT_EQ(tracker.getStats().low_confidence_fallbacks, 1u);
+}
+
+TEST_F(FlowTrackerTest, PlainBoxIsLeftToTheMotionModel) {
+    FlowTracker tracker(logger);
+    cv::Mat frame = scene({200, 100});
+    // Boxes are indexed by track slot; a free slot has an empty box
+    tracker.setKeyframe(FlowTracker::prepareImage(frame),
+                        {cv::Rect(400, 100, 100, 100), cv::Rect(), cv::Rect(180, 80, 60, 60)}, cv::Size(640, 360));
+
+    // No features to follow in a flat area: that box is not reported, no detection is forced
+    std::vector<cv::Rect> boxes;
+    ASSERT_TRUE(tracker.propagate(FlowTracker::prepareImage(frame), boxes));
+    ASSERT_EQ(boxes.size(), 3u);
+    EXPECT_TRUE(boxes[0].empty());
+    EXPECT_TRUE(boxes[1].empty());
+    EXPECT_FALSE(boxes[2].empty());
+}
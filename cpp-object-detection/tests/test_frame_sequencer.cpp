@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "frame_sequencer.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(FrameSequencerTest, InOrderPushIsReleasedImmediately) {
+    FrameSequencer<int> sequencer;
+
+    sequencer.push(0, 100);
+    sequencer.push(1, 101);
+
+    int value = 0;
+    EXPECT_TRUE(sequencer.tryNext(value));
+    EXPECT_EQ(value, 100);
+    EXPECT_TRUE(sequencer.tryNext(value));
+    EXPECT_EQ(value, 101);
+    EXPECT_FALSE(sequencer.tryNext(value));
+}
+
+TEST(FrameSequencerTest, OutOfOrderPushIsHeldBack) {
+    FrameSequencer<int> sequencer;
+
+    sequencer.push(2, 102);
+    sequencer.push(1, 101);
+
+    int value = 0;
+    EXPECT_FALSE(sequencer.tryNext(value));
+    EXPECT_EQ(sequencer.pendingCount(), 2);
+
+    sequencer.push(0, 100);
+    for (int expected = 100; expected <= 102; ++expected) {
+        EXPECT_TRUE(sequencer.tryNext(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_EQ(sequencer.nextSequence(), 3);
+}
+
+TEST(FrameSequencerTest, SkippedSequenceDoesNotStall) {
+    FrameSequencer<int> sequencer;
+
+    sequencer.push(0, 100);
+    sequencer.skip(1);
+    sequencer.push(2, 102);
+
+    int value = 0;
+    EXPECT_TRUE(sequencer.tryNext(value));
+    EXPECT_EQ(value, 100);
+    EXPECT_TRUE(sequencer.tryNext(value));
+    EXPECT_EQ(value, 102);
+}
+
+TEST(FrameSequencerTest, StalePushIsIgnored) {
+    FrameSequencer<int> sequencer;
+
+    sequencer.skip(0);
+    sequencer.push(1, 101);
+
+    int value = 0;
+    EXPECT_TRUE(sequencer.tryNext(value));
+    EXPECT_EQ(value, 101);
+
+    // Sequence 0 was already released as skipped
+    sequencer.push(0, 100);
+    EXPECT_FALSE(sequencer.tryNext(value));
+    EXPECT_EQ(sequencer.pendingCount(), 0);
+}
+
+TEST(FrameSequencerTest, CloseDrainsAcrossGaps) {
+    FrameSequencer<int> sequencer;
+
+    sequencer.push(1, 101);
+    sequencer.push(3, 103);
+    sequencer.close();
+
+    int value = 0;
+    EXPECT_TRUE(sequencer.waitNext(value));
+    EXPECT_EQ(value, 101);
+    EXPECT_TRUE(sequencer.waitNext(value));
+    EXPECT_EQ(value, 103);
+    EXPECT_FALSE(sequencer.waitNext(value));
+}
+
+TEST(FrameSequencerTest, ConcurrentProducersDeliverCaptureOrder) {
+    constexpr int FRAME_COUNT = 200;
+    constexpr int WORKER_COUNT = 4;
+    FrameSequencer<std::string> sequencer;
+
+    // Simulate workers finishing frames in a shuffled order
+    std::vector<int> order(FRAME_COUNT);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < WORKER_COUNT; ++w) {
+        workers.emplace_back([&, w] {
+            for (int i = w; i < FRAME_COUNT; i += WORKER_COUNT) {
+                sequencer.push(order[i], "frame" + std::to_string(order[i]));
+            }
+        });
+    }
+
+    std::vector<std::string> received;
+    std::thread consumer([&] {
+        std::string item;
+        while (sequencer.waitNext(item)) {
+            received.push_back(item);
+            if (received.size() == FRAME_COUNT) {
+                break;
+            }
+        }
+    });
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    consumer.join();
+
+    ASSERT_EQ(received.size(), static_cast<size_t>(FRAME_COUNT));
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        EXPECT_EQ(received[i], "frame" + std::to_string(i));
+    }
+}
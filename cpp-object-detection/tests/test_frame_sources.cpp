@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "frame_source_interface.hpp"
+#include "file_frame_sources.hpp"
+#include "synthetic_frame_source.hpp"
+#include "logger.hpp"
+#include <chrono>
+#include <stdexcept>
+
+class FrameSourceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        logger = std::make_shared<Logger>("test_frame_sources.log", false);
+    }
+
+    std::shared_ptr<Logger> logger;
+};
+
+TEST_F(FrameSourceTest, ParseSourceType) {
+    EXPECT_EQ(FrameSourceFactory::parseSourceType("webcam"), FrameSourceFactory::SourceType::WEBCAM);
+    EXPECT_EQ(FrameSourceFactory::parseSourceType("video"), FrameSourceFactory::SourceType::VIDEO_FILE);
+    EXPECT_EQ(FrameSourceFactory::parseSourceType("images"), FrameSourceFactory::SourceType::IMAGE_DIRECTORY);
+    EXPECT_EQ(FrameSourceFactory::parseSourceType("synthetic"), FrameSourceFactory::SourceType::SYNTHETIC);
+    EXPECT_THROW(FrameSourceFactory::parseSourceType("rtsp"), std::invalid_argument);
+
+    for (auto type : {FrameSourceFactory::SourceType::WEBCAM, FrameSourceFactory::SourceType::VIDEO_FILE,
+                      FrameSourceFactory::SourceType::IMAGE_DIRECTORY, FrameSourceFactory::SourceType::SYNTHETIC}) {
+        EXPECT_EQ(FrameSourceFactory::parseSourceType(FrameSourceFactory::sourceTypeToString(type)), type);
+    }
+}
+
+TEST_F(FrameSourceTest, ParsePacing) {
+    EXPECT_EQ(FrameSourceFactory::parsePacing("realtime"), FramePacing::REAL_TIME);
+    EXPECT_EQ(FrameSourceFactory::parsePacing("fast"), FramePacing::AS_FAST_AS_POSSIBLE);
+    EXPECT_THROW(FrameSourceFactory::parsePacing("slow"), std::invalid_argument);
+}
+
+TEST_F(FrameSourceTest, UnpacedFramePacerNeverWaits) {
+    FramePacer pacer;
+    pacer.configure(FramePacing::AS_FAST_AS_POSSIBLE, 1.0);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100; ++i) {
+        pacer.wait();
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+}
+
+TEST_F(FrameSourceTest, SyntheticSourceIsDeterministicAndStopsAtFrameLimit) {
+    FrameSourceFactory::SourceOptions options;
+    options.type = FrameSourceFactory::SourceType::SYNTHETIC;
+    options.width = 320;
+    options.height = 240;
+    options.pacing = FramePacing::AS_FAST_AS_POSSIBLE;
+    options.frame_limit = 3;
+
+    auto first = FrameSourceFactory::createSource(options, logger);
+    auto second = FrameSourceFactory::createSource(options, logger);
+    ASSERT_TRUE(first->initialize());
+    ASSERT_TRUE(second->initialize());
+
+    cv::Mat a, b;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(first->captureFrame(a));
+        ASSERT_TRUE(second->captureFrame(b));
+        EXPECT_EQ(a.cols, 320);
+        EXPECT_EQ(a.rows, 240);
+        EXPECT_EQ(cv::norm(a, b, cv::NORM_INF), 0.0);
+    }
+
+    EXPECT_TRUE(first->isExhausted());
+    EXPECT_FALSE(first->captureFrame(a));
+}
+
+TEST_F(FrameSourceTest, MissingVideoFileFailsToInitialize) {
+    VideoFileSource source("/nonexistent/clip.mp4", FramePacing::AS_FAST_AS_POSSIBLE, 0.0, false, logger);
+    EXPECT_FALSE(source.initialize());
+    EXPECT_FALSE(source.isReady());
+}
+
+TEST_F(FrameSourceTest, MissingImageDirectoryFailsToInitialize) {
+    ImageDirectorySource source("/nonexistent/images", FramePacing::AS_FAST_AS_POSSIBLE, 0.0, false, logger);
+    EXPECT_FALSE(source.initialize());
+    EXPECT_FALSE(source.isReady());
+    EXPECT_FALSE(source.providesEncodedFrames());
+}
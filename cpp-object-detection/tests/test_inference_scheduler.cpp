@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "inference_scheduler.hpp"
+#include "object_detector.hpp"
+#include "logger.hpp"
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The detector is never initialized: inference completes immediately with no
+// detections, which is all the scheduling logic needs
+class InferenceSchedulerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        logger = std::make_shared<Logger>("test_inference_scheduler.log", false);
+        detector = std::make_shared<ObjectDetector>("none.onnx", "", "none.txt", 0.5, logger);
+    }
+
+    InferenceScheduler::Completion record(int stream_id) {
+        return [this, stream_id](bool inference_ok, std::vector<Detection>&) {
+            std::lock_guard<std::mutex> lock(order_mutex);
+            order.push_back(inference_ok ? stream_id : -1);
+        };
+    }
+
+    void waitForCompletions(size_t count) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline) {
+            {
+                std::lock_guard<std::mutex> lock(order_mutex);
+                if (order.size() >= count) {
+                    return;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::shared_ptr<Logger> logger;
+    std::shared_ptr<ObjectDetector> detector;
+    std::mutex order_mutex;
+    std::vector<int> order;
+};
+
+TEST_F(InferenceSchedulerTest, WorkersTakeStreamsRoundRobin) {
+    InferenceScheduler scheduler(detector, logger, 1, 10);
+    int busy = scheduler.registerStream("camera0");
+    int quiet = scheduler.registerStream("camera1");
+    cv::Mat frame;
+
+    // Queue before the worker starts so the order depends only on the scheduler
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(scheduler.submit(busy, frame, record(busy)));
+    }
+    ASSERT_TRUE(scheduler.submit(quiet, frame, record(quiet)));
+
+    ASSERT_TRUE(scheduler.initialize());
+    waitForCompletions(4);
+    scheduler.shutdown();
+
+    std::vector<int> expected = {busy, quiet, busy, busy};
+    EXPECT_EQ(order, expected);
+}
+
+TEST_F(InferenceSchedulerTest, FullQueueDropsOnlyThatStream) {
+    InferenceScheduler scheduler(detector, logger, 1, 2);
+    int busy = scheduler.registerStream("camera0");
+    int quiet = scheduler.registerStream("camera1");
+    cv::Mat frame;
+
+    EXPECT_TRUE(scheduler.submit(busy, frame, record(busy)));
+    EXPECT_TRUE(scheduler.submit(busy, frame, record(busy)));
+    EXPECT_FALSE(scheduler.submit(busy, frame, record(busy)));
+    EXPECT_TRUE(scheduler.submit(quiet, frame, record(quiet)));
+
+    auto stats = scheduler.getStreamStats();
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].name, "camera0");
+    EXPECT_EQ(stats[0].submitted, 2u);
+    EXPECT_EQ(stats[0].dropped, 1u);
+    EXPECT_EQ(stats[0].queued, 2u);
+    EXPECT_EQ(stats[1].dropped, 0u);
+
+    ASSERT_TRUE(scheduler.initialize());
+    waitForCompletions(3);
+    scheduler.shutdown();
+
+    stats = scheduler.getStreamStats();
+    EXPECT_EQ(stats[0].inferred, 2u);
+    EXPECT_EQ(stats[1].inferred, 1u);
+}
+
+TEST_F(InferenceSchedulerTest, DrainAndShutdownFailQueuedFrames) {
+    InferenceScheduler scheduler(detector, logger, 1, 10);
+    int first = scheduler.registerStream("camera0");
+    int second = scheduler.registerStream("camera1");
+    cv::Mat frame;
+
+    ASSERT_TRUE(scheduler.submit(first, frame, record(first)));
+    ASSERT_TRUE(scheduler.submit(second, frame, record(second)));
+
+    // Never started: both frames resolve as failed, one by the drain and one by shutdown
+    scheduler.drainStream(first);
+    EXPECT_EQ(scheduler.getQueueSize(first), 0u);
+    EXPECT_EQ(scheduler.getQueueSize(second), 1u);
+    scheduler.shutdown();
+
+    std::vector<int> expected = {-1, -1};
+    EXPECT_EQ(order, expected);
+    EXPECT_FALSE(scheduler.submit(first, frame, record(first)));
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "latest_frame_slot.hpp"
+#include "frame_capture_thread.hpp"
+#include "webcam_interface.hpp"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+TEST(LatestFrameSlotTest, ConsumeWithoutPublishReturnsNothing) {
+    LatestFrameSlot<int> slot;
+
+    EXPECT_FALSE(slot.hasFresh());
+    EXPECT_EQ(slot.consume(), nullptr);
+}
+
+TEST(LatestFrameSlotTest, PublishedValueIsConsumedOnce) {
+    LatestFrameSlot<int> slot;
+
+    slot.writeBuffer() = 42;
+    EXPECT_FALSE(slot.publish());
+    EXPECT_TRUE(slot.hasFresh());
+
+    const int* value = slot.consume();
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 42);
+    EXPECT_FALSE(slot.hasFresh());
+    EXPECT_EQ(slot.consume(), nullptr);
+}
+
+TEST(LatestFrameSlotTest, LatestValueWins) {
+    LatestFrameSlot<int> slot;
+
+    slot.writeBuffer() = 1;
+    EXPECT_FALSE(slot.publish());
+    slot.writeBuffer() = 2;
+    EXPECT_TRUE(slot.publish());  // Value 1 was never read
+    slot.writeBuffer() = 3;
+    EXPECT_TRUE(slot.publish());
+
+    const int* value = slot.consume();
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 3);
+}
+
+TEST(LatestFrameSlotTest, ConsumedBufferIsNotReusedByProducer) {
+    LatestFrameSlot<int> slot;
+
+    slot.writeBuffer() = 7;
+    slot.publish();
+    const int* held = slot.consume();
+    ASSERT_NE(held, nullptr);
+
+    // Producer keeps publishing while the consumer still holds its buffer
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_NE(&slot.writeBuffer(), held);
+        slot.writeBuffer() = 100 + i;
+        slot.publish();
+    }
+    EXPECT_EQ(*held, 7);
+
+    const int* latest = slot.consume();
+    ASSERT_NE(latest, nullptr);
+    EXPECT_EQ(*latest, 109);
+}
+
+TEST(LatestFrameSlotTest, ConcurrentConsumerSeesIncreasingValues) {
+    LatestFrameSlot<uint64_t> slot;
+    constexpr uint64_t FRAME_COUNT = 200000;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&]() {
+        for (uint64_t i = 1; i <= FRAME_COUNT; ++i) {
+            slot.writeBuffer() = i;
+            slot.publish();
+        }
+        done = true;
+    });
+
+    uint64_t last = 0;
+    bool monotonic = true;
+    while (last != FRAME_COUNT) {
+        const uint64_t* value = slot.consume();
+        if (value) {
+            if (*value <= last) {
+                monotonic = false;
+            }
+            last = *value;
+        } else if (done.load() && !slot.hasFresh()) {
+            break;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(monotonic);
+    EXPECT_EQ(last, FRAME_COUNT);  // The final value is never lost
+}
+
+TEST(FrameCaptureThreadTest, StartFailsWithoutInitializedCamera) {
+    auto logger = std::make_shared<Logger>("test_capture_thread.log", false);
+    auto webcam = std::make_shared<WebcamInterface>(999, 640, 480, logger);
+    FrameCaptureThread capture(webcam, logger);
+
+    EXPECT_FALSE(capture.start());
+    EXPECT_FALSE(capture.isRunning());
+
+    CapturedFrame captured;
+    EXPECT_FALSE(capture.tryGetLatest(captured));
+    EXPECT_EQ(capture.getFramesCaptured(), 0u);
+    capture.stop();  // Safe when never started
+}
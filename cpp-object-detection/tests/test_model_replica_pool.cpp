@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include "model_replica_pool.hpp"
+#include "object_detector.hpp"
+#include "logger.hpp"
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <memory>
+
+namespace {
+
+// Minimal model that records how many callers are inside detect() at once
+class ConcurrencyProbeModel : public IDetectionModel {
+public:
+    ConcurrencyProbeModel(std::atomic<int>& active_calls, std::atomic<int>& max_active_calls)
+        : active_calls_(active_calls), max_active_calls_(max_active_calls), in_use_(false) {}
+
+    bool initialize(const std::string&, const std::string&, const std::string&, double, double = 1.0) override {
+        return true;
+    }
+
+    std::vector<Detection> detect(const cv::Mat&) override {
+        // The same replica must never be entered by two threads
+        bool was_in_use = in_use_.exchange(true);
+        EXPECT_FALSE(was_in_use);
+        int current = ++active_calls_;
+        int previous = max_active_calls_.load();
+        while (current > previous && !max_active_calls_.compare_exchange_weak(previous, current)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        active_calls_--;
+        in_use_ = false;
+        return {};
+    }
+
+    ModelMetrics getMetrics() const override { return {"Probe", "Test", 0.0, 0, 0, "Probe"}; }
+    std::vector<std::string> getSupportedClasses() const override { return {}; }
+    bool isInitialized() const override { return true; }
+    std::string getModelName() const override { return "Probe"; }
+    void warmUp() override {}
+
+private:
+    std::atomic<int>& active_calls_;
+    std::atomic<int>& max_active_calls_;
+    std::atomic<bool> in_use_;
+};
+
+}  // namespace
+
+class ModelReplicaPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        active_calls = 0;
+        max_active_calls = 0;
+        for (int i = 0; i < 3; ++i) {
+            models.push_back(std::make_unique<ConcurrencyProbeModel>(active_calls, max_active_calls));
+        }
+    }
+
+    std::vector<IDetectionModel*> rawModels(size_t count) const {
+        std::vector<IDetectionModel*> raw;
+        for (size_t i = 0; i < count && i < models.size(); ++i) {
+            raw.push_back(models[i].get());
+        }
+        return raw;
+    }
+
+    std::atomic<int> active_calls;
+    std::atomic<int> max_active_calls;
+    std::vector<std::unique_ptr<ConcurrencyProbeModel>> models;
+};
+
+TEST_F(ModelReplicaPoolTest, SizeAndAvailability) {
+    ModelReplicaPool pool(rawModels(3));
+
+    EXPECT_EQ(pool.size(), 3);
+    EXPECT_EQ(pool.available(), 3);
+
+    {
+        auto lease = pool.acquire();
+        EXPECT_TRUE(static_cast<bool>(lease));
+        EXPECT_EQ(pool.available(), 2);
+    }
+
+    // Lease returns the replica on destruction
+    EXPECT_EQ(pool.available(), 3);
+}
+
+TEST_F(ModelReplicaPoolTest, LeasesAreDistinct) {
+    ModelReplicaPool pool(rawModels(2));
+
+    auto first = pool.acquire();
+    auto second = pool.acquire();
+
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_FALSE(static_cast<bool>(pool.tryAcquire()));
+}
+
+TEST_F(ModelReplicaPoolTest, LeaseResetReturnsReplica) {
+    ModelReplicaPool pool(rawModels(1));
+
+    auto lease = pool.acquire();
+    EXPECT_EQ(pool.available(), 0);
+
+    lease.reset();
+    EXPECT_FALSE(static_cast<bool>(lease));
+    EXPECT_EQ(pool.available(), 1);
+}
+
+TEST_F(ModelReplicaPoolTest, LeaseMoveTransfersOwnership) {
+    ModelReplicaPool pool(rawModels(1));
+
+    auto lease = pool.acquire();
+    IDetectionModel* model = lease.get();
+
+    ModelReplicaPool::Lease moved = std::move(lease);
+    EXPECT_EQ(moved.get(), model);
+    EXPECT_FALSE(static_cast<bool>(lease));
+    EXPECT_EQ(pool.available(), 0);
+
+    moved.reset();
+    EXPECT_EQ(pool.available(), 1);
+}
+
+TEST_F(ModelReplicaPoolTest, EmptyPoolReturnsEmptyLease) {
+    ModelReplicaPool pool(std::vector<IDetectionModel*>{});
+
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_FALSE(static_cast<bool>(pool.acquire()));
+}
+
+TEST_F(ModelReplicaPoolTest, ConcurrentInferenceBoundedByReplicaCount) {
+    ModelReplicaPool pool(rawModels(2));
+    cv::Mat frame = cv::Mat::zeros(32, 32, CV_8UC3);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&] {
+            for (int i = 0; i < 10; ++i) {
+                auto lease = pool.acquire();
+                lease->detect(frame);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_LE(max_active_calls.load(), 2);
+    EXPECT_EQ(pool.available(), 2);
+}
+
+TEST_F(ModelReplicaPoolTest, DetectorReplicaCountBeforeInitialization) {
+    auto logger = std::make_shared<Logger>("test_replica_pool.log", false);
+    ObjectDetector detector("non_existent_model.onnx", "non_existent_config.yaml",
+                            "non_existent_classes.txt", 0.5, logger);
+
+    detector.setInferenceReplicas(4);
+
+    // No replicas exist until the model loads successfully
+    EXPECT_EQ(detector.getInferenceReplicaCount(), 0);
+    EXPECT_FALSE(detector.initialize());
+    EXPECT_TRUE(detector.detectObjects(cv::Mat::zeros(32, 32, CV_8UC3)).empty());
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "motion_gate.hpp"
+#include "logger.hpp"
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+class MotionGateTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        logger = std::make_shared<Logger>("test_motion_gate.log", false);
+    }
+
+    static int scalarChangedPixels(const std::vector<uchar>& a, const std::vector<uchar>& b, int threshold) {
+        int changed = 0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (std::abs(a[i] - b[i]) > threshold) {
+                changed++;
+            }
+        }
+        return changed;
+    }
+
+    std::shared_ptr<Logger> logger;
+};
+
+TEST_F(MotionGateTest, ChangedPixelCountMatchesScalarReference) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> byte(0, 255);
+
+    // Lengths around the 16-byte vector width exercise both the SIMD body and the scalar tail
+    for (int length : {0, 1, 15, 16, 17, 33, MotionGate::GATE_WIDTH * MotionGate::GATE_HEIGHT, 300000}) {
+        std::vector<uchar> a(length), b(length);
+        for (int i = 0; i < length; ++i) {
+            a[i] = static_cast<uchar>(byte(rng));
+            b[i] = static_cast<uchar>(byte(rng));
+        }
+        for (int threshold : {0, 25, 254, 255}) {
+            EXPECT_EQ(MotionGate::countChangedPixels(a.data(), b.data(), length, threshold),
+                      scalarChangedPixels(a, b, threshold))
+                << "length " << length << ", threshold " << threshold;
+        }
+    }
+}
+
+TEST_F(MotionGateTest, IdenticalBuffersHaveNoChangedPixels) {
+    std::vector<uchar> a(1000, 200);
+    EXPECT_EQ(MotionGate::countChangedPixels(a.data(), a.data(), 1000, 0), 0);
+}
+
+TEST_F(MotionGateTest, StaticSceneIsSkippedAndMotionRuns) {
+    MotionGate gate(logger);
+    cv::Mat frame(720, 1280, CV_8UC3, cv::Scalar(80, 80, 80));
+
+    EXPECT_TRUE(gate.shouldRunInference(frame, false));   // First frame seeds the background
+    EXPECT_FALSE(gate.shouldRunInference(frame, false));
+    EXPECT_FALSE(gate.shouldRunInference(frame, false));
+
+    cv::Mat moved = frame.clone();
+    cv::rectangle(moved, cv::Rect(400, 200, 200, 200), cv::Scalar(255, 255, 255), cv::FILLED);
+    EXPECT_TRUE(gate.shouldRunInference(moved, false));
+
+    auto stats = gate.getStats();
+    EXPECT_EQ(stats.frames_checked, 4u);
+    EXPECT_EQ(stats.frames_skipped, 2u);
+    EXPECT_EQ(stats.forced_refreshes, 0u);
+}
+
+TEST_F(MotionGateTest, ActiveObjectsKeepInferenceRunning) {
+    MotionGate gate(logger);
+    cv::Mat frame(720, 1280, CV_8UC3, cv::Scalar(80, 80, 80));
+
+    gate.shouldRunInference(frame, false);
+    EXPECT_TRUE(gate.shouldRunInference(frame, true));
+    EXPECT_EQ(gate.getStats().frames_skipped, 0u);
+}
+
+TEST_F(MotionGateTest, RefreshForcesInferenceOnStaticScene) {
+    MotionGate gate(logger, 0.005, 25, 0);
+    cv::Mat frame(720, 1280, CV_8UC3, cv::Scalar(80, 80, 80));
+
+    gate.shouldRunInference(frame, false);
+    EXPECT_TRUE(gate.shouldRunInference(frame, false));
+    EXPECT_EQ(gate.getStats().forced_refreshes, 1u);
+}
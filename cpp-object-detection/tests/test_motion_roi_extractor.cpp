@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "motion_roi_extractor.hpp"
+#include <memory>
+#include <vector>
+
+TEST(MotionRoiExtractorTest, OverlappingBoxesAreMerged) {
+    std::vector<cv::Rect> boxes = {cv::Rect(0, 0, 100, 100), cv::Rect(50, 50, 100, 100), cv::Rect(500, 500, 50, 50)};
+    auto merged = MotionRoiExtractor::mergeRegions(boxes, 0, 4);
+
+    ASSERT_EQ(merged.size(), 2u);
+    EXPECT_EQ(merged[0], cv::Rect(0, 0, 150, 150));
+    EXPECT_EQ(merged[1], cv::Rect(500, 500, 50, 50));
+}
+
+TEST(MotionRoiExtractorTest, BoxesWithinGapAreMerged) {
+    std::vector<cv::Rect> boxes = {cv::Rect(0, 0, 100, 100), cv::Rect(110, 0, 100, 100)};
+
+    EXPECT_EQ(MotionRoiExtractor::mergeRegions(boxes, 5, 4).size(), 2u);
+    auto merged = MotionRoiExtractor::mergeRegions(boxes, 20, 4);
+    ASSERT_EQ(merged.size(), 1u);
+    EXPECT_EQ(merged[0], cv::Rect(0, 0, 210, 100));
+}
+
+TEST(MotionRoiExtractorTest, RegionBudgetMergesClosestPairFirst) {
+    // Two boxes close together in one corner, one far away: the close pair is merged
+    std::vector<cv::Rect> boxes = {cv::Rect(0, 0, 50, 50), cv::Rect(60, 0, 50, 50), cv::Rect(1000, 600, 50, 50)};
+    auto merged = MotionRoiExtractor::mergeRegions(boxes, 0, 2);
+
+    ASSERT_EQ(merged.size(), 2u);
+    EXPECT_EQ(merged[0], cv::Rect(0, 0, 110, 50));
+    EXPECT_EQ(merged[1], cv::Rect(1000, 600, 50, 50));
+
+    EXPECT_EQ(MotionRoiExtractor::mergeRegions(boxes, 0, 1).size(), 1u);
+}
+
+TEST(MotionRoiExtractorTest, MergedRegionsNeverOverlap) {
+    // Merging the closest pair (first two boxes) creates a union that overlaps the third
+    std::vector<cv::Rect> boxes = {cv::Rect(0, 0, 10, 10), cv::Rect(40, 0, 10, 10), cv::Rect(20, 5, 5, 50),
+                                   cv::Rect(1000, 0, 10, 10)};
+    auto merged = MotionRoiExtractor::mergeRegions(boxes, 0, 3);
+
+    ASSERT_EQ(merged.size(), 2u);
+    EXPECT_EQ(merged[0], cv::Rect(0, 0, 50, 55));
+    EXPECT_EQ(merged[1], cv::Rect(1000, 0, 10, 10));
+}
+
+TEST(MotionRoiExtractorTest, SmallRegionGrowsAroundItsCenter) {
+    auto region = MotionRoiExtractor::expandRegion(cv::Rect(600, 300, 40, 100), 256, cv::Size(1280, 720));
+    EXPECT_EQ(region, cv::Rect(492, 222, 256, 256));
+}
+
+TEST(MotionRoiExtractorTest, GrownRegionStaysInsideFrame) {
+    const cv::Size frame(1280, 720);
+    EXPECT_EQ(MotionRoiExtractor::expandRegion(cv::Rect(0, 0, 20, 20), 256, frame), cv::Rect(0, 0, 256, 256));
+    EXPECT_EQ(MotionRoiExtractor::expandRegion(cv::Rect(1270, 710, 10, 10), 256, frame),
+              cv::Rect(1024, 464, 256, 256));
+    // Never larger than the frame itself
+    EXPECT_EQ(MotionRoiExtractor::expandRegion(cv::Rect(10, 10, 50, 50), 256, cv::Size(200, 150)),
+              cv::Rect(0, 0, 200, 150));
+}
+
+TEST(MotionRoiExtractorTest, LargeRegionKeepsItsSize) {
+    cv::Rect box(100, 100, 400, 300);
+    EXPECT_EQ(MotionRoiExtractor::expandRegion(box, 256, cv::Size(1280, 720)), box);
+}
+
+TEST(MotionRoiExtractorTest, PaddedRegionIsClippedToBounds) {
+    const cv::Rect bounds(0, 0, 1280, 720);
+    EXPECT_EQ(MotionRoiExtractor::padRegion(cv::Rect(400, 200, 100, 200), 0.25, bounds), cv::Rect(375, 150, 150, 300));
+    EXPECT_EQ(MotionRoiExtractor::padRegion(cv::Rect(0, 0, 100, 100), 0.25, bounds), cv::Rect(0, 0, 125, 125));
+}
+
+TEST(MotionRoiExtractorTest, StillTrackedObjectIsStillInferred) {
+    // After warm-up nothing moves, so MOG2 alone would ask for a full-frame pass
+    MotionRoiExtractor extractor(std::make_shared<Logger>("test_motion_roi.log", false));
+    cv::Mat frame(720, 1280, CV_8UC3, cv::Scalar(90, 90, 90));
+    cv::rectangle(frame, cv::Rect(600, 300, 80, 200), cv::Scalar(30, 160, 200), cv::FILLED);
+    for (int i = 0; i < 50; ++i) {
+        extractor.extract(frame);
+    }
+    EXPECT_TRUE(extractor.extract(frame).empty());
+
+    // The person sitting there is tracked, so its box keeps being inferred as a crop
+    const cv::Rect track(600, 300, 80, 200);
+    auto regions = extractor.extract(frame, {track});
+    ASSERT_EQ(regions.size(), 1u);
+    EXPECT_EQ(regions[0] & track, track);
+    EXPECT_LT(regions[0].area(), frame.cols * frame.rows / 2);
+}
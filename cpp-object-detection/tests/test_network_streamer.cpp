@@ -5,6 +5,7 @@
 #include <arpa/inet.h>
 #include <unistd.h>
 #include "network_streamer.hpp"
+#include "class_registry.hpp"
 #include "logger.hpp"
 
 class NetworkStreamerTest : public ::testing::Test {
@@ -77,7 +78,7 @@ TEST_F(NetworkStreamerTest, UpdateFrameWithValidFrame) {
     
     // Add a test detection
     Detection det;
-    det.class_name = "person";
+    det.class_id = ClassRegistry::intern("person");
     det.confidence = 0.95;
     det.bbox = cv::Rect(100, 100, 200, 300);
     detections.push_back(det);
@@ -115,7 +116,7 @@ TEST_F(NetworkStreamerTest, UpdateFrameWithStats) {
     
     // Add a test detection
     Detection det;
-    det.class_name = "cat";
+    det.class_id = ClassRegistry::intern("cat");
     det.confidence = 0.92;
     det.bbox = cv::Rect(50, 50, 150, 150);
     detections.push_back(det);
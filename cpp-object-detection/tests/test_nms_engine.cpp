@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "nms_engine.hpp"
+#include <opencv2/opencv.hpp>
+#include <opencv2/dnn.hpp>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+TEST(NmsEngineTest, EmptyInputKeepsNothing) {
+    NmsEngine nms;
+    EXPECT_TRUE(nms.suppress(0.45f).empty());
+}
+
+TEST(NmsEngineTest, OverlappingSameClassKeepsHighestScore) {
+    NmsEngine nms;
+    nms.add(cv::Rect(100, 100, 100, 100), 0.6f, 0);
+    int best = nms.add(cv::Rect(105, 105, 100, 100), 0.9f, 0);
+    nms.add(cv::Rect(110, 95, 100, 100), 0.7f, 0);
+
+    const auto& keep = nms.suppress(0.45f);
+    ASSERT_EQ(keep.size(), 1u);
+    EXPECT_EQ(keep[0], best);
+}
+
+TEST(NmsEngineTest, OverlappingDifferentClassesAreBothKept) {
+    // A person riding a bicycle must not suppress the bicycle
+    NmsEngine nms;
+    int person = nms.add(cv::Rect(100, 50, 80, 200), 0.9f, 0);
+    int bicycle = nms.add(cv::Rect(95, 120, 90, 120), 0.8f, 1);
+
+    const auto& keep = nms.suppress(0.45f);
+    ASSERT_EQ(keep.size(), 2u);
+    EXPECT_EQ(keep[0], person);
+    EXPECT_EQ(keep[1], bicycle);
+}
+
+TEST(NmsEngineTest, DisjointBoxesAreKeptInScoreOrder) {
+    NmsEngine nms;
+    for (int i = 0; i < 10; ++i) {
+        nms.add(cv::Rect(i * 50, 0, 40, 40), 0.1f * (i + 1), 0);
+    }
+
+    const auto& keep = nms.suppress(0.45f);
+    ASSERT_EQ(keep.size(), 10u);
+    for (size_t i = 1; i < keep.size(); ++i) {
+        EXPECT_GE(nms.score(keep[i - 1]), nms.score(keep[i]));
+    }
+}
+
+TEST(NmsEngineTest, ThresholdIsExclusive) {
+    // Two 100x100 boxes shifted by 50px overlap with IoU 1/3
+    cv::Rect a(0, 0, 100, 100);
+    cv::Rect b(50, 0, 100, 100);
+    ASSERT_NEAR(NmsEngine::iou(a, b), 1.0f / 3.0f, 1e-6);
+
+    NmsEngine nms;
+    nms.add(a, 0.9f, 0);
+    nms.add(b, 0.8f, 0);
+    EXPECT_EQ(nms.suppress(0.34f).size(), 2u);
+    EXPECT_EQ(nms.suppress(0.30f).size(), 1u);
+}
+
+TEST(NmsEngineTest, AccessorsReturnAddedValues) {
+    NmsEngine nms;
+    int index = nms.add(cv::Rect(10, 20, 30, 40), 0.75f, 7);
+
+    EXPECT_EQ(nms.size(), 1u);
+    EXPECT_EQ(nms.box(index), cv::Rect(10, 20, 30, 40));
+    EXPECT_FLOAT_EQ(nms.score(index), 0.75f);
+    EXPECT_EQ(nms.classId(index), 7);
+}
+
+TEST(NmsEngineTest, ClearResetsBetweenFrames) {
+    NmsEngine nms;
+    nms.add(cv::Rect(0, 0, 10, 10), 0.9f, 0);
+    nms.add(cv::Rect(100, 100, 10, 10), 0.9f, 0);
+    EXPECT_EQ(nms.suppress(0.45f).size(), 2u);
+
+    nms.clear();
+    EXPECT_EQ(nms.size(), 0u);
+    nms.add(cv::Rect(0, 0, 10, 10), 0.5f, 3);
+    const auto& keep = nms.suppress(0.45f);
+    ASSERT_EQ(keep.size(), 1u);
+    EXPECT_EQ(nms.classId(keep[0]), 3);
+}
+
+TEST(NmsEngineTest, MatchesPerClassNmsBoxes) {
+    cv::RNG rng(1234);
+    std::vector<cv::Rect> boxes;
+    std::vector<float> scores;
+    std::vector<int> class_ids;
+
+    // Clustered boxes so plenty of them overlap
+    for (int i = 0; i < 600; ++i) {
+        int cluster_x = rng.uniform(0, 8) * 150;
+        int cluster_y = rng.uniform(0, 4) * 150;
+        boxes.emplace_back(cluster_x + rng.uniform(0, 40), cluster_y + rng.uniform(0, 40),
+                           rng.uniform(40, 120), rng.uniform(40, 120));
+        scores.push_back(static_cast<float>(rng.uniform(0.3, 1.0)));
+        class_ids.push_back(rng.uniform(0, 5));
+    }
+
+    NmsEngine nms;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        nms.add(boxes[i], scores[i], class_ids[i]);
+    }
+    std::vector<int> actual = nms.suppress(0.45f);
+    std::sort(actual.begin(), actual.end());
+
+    // Reference: OpenCV NMSBoxes run separately for each class
+    std::map<int, std::vector<int>> by_class;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        by_class[class_ids[i]].push_back(static_cast<int>(i));
+    }
+    std::vector<int> expected;
+    for (const auto& entry : by_class) {
+        std::vector<cv::Rect> class_boxes;
+        std::vector<float> class_scores;
+        for (int index : entry.second) {
+            class_boxes.push_back(boxes[index]);
+            class_scores.push_back(scores[index]);
+        }
+        std::vector<int> kept;
+        cv::dnn::NMSBoxes(class_boxes, class_scores, 0.0f, 0.45f, kept);
+        for (int k : kept) {
+            expected.push_back(entry.second[k]);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    EXPECT_EQ(actual, expected);
+}
@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include "notification_manager.hpp"
+#include "class_registry.hpp"
 #include "logger.hpp"
 
 // Check if filesystem is available
@@ -166,13 +167,13 @@ TEST_F(NotificationManagerTest, NotificationWithDetections) {
     
     // Add some detections
     Detection det1;
-    det1.class_name = "dog";
+    det1.class_id = ClassRegistry::intern("dog");
     det1.confidence = 0.92;
     det1.bbox = cv::Rect(100, 200, 50, 75);
     data.all_detections.push_back(det1);
     
     Detection det2;
-    det2.class_name = "person";
+    det2.class_id = ClassRegistry::intern("person");
     det2.confidence = 0.88;
     det2.bbox = cv::Rect(300, 150, 80, 120);
     data.all_detections.push_back(det2);
@@ -2,7 +2,9 @@
 #include "object_detector.hpp"
 #include "logger.hpp"
 #include <opencv2/opencv.hpp>
+#include <algorithm>
 #include <memory>
+#include <set>
 
 class ObjectDetectorTest : public ::testing::Test {
 protected:
@@ -167,7 +169,7 @@ TEST_F(ObjectDetectorTest, ObjectTrackerStructure) {
     ObjectDetector::ObjectTracker tracker;
     
     // Set basic fields
-    tracker.object_type = "person";
+    tracker.class_id = ClassRegistry::intern("person");
     tracker.center = cv::Point2f(100.0f, 200.0f);
     tracker.previous_center = cv::Point2f(90.0f, 190.0f);
     tracker.was_present_last_frame = true;
@@ -235,7 +237,7 @@ TEST_F(ObjectDetectorTest, EnrichDetectionsWithStationaryStatus) {
     // Create some mock detections
     std::vector<Detection> detections;
     Detection d1;
-    d1.class_name = "person";
+    d1.class_id = ClassRegistry::intern("person");
     d1.confidence = 0.92;
     d1.bbox = cv::Rect(100, 100, 50, 100);
     d1.is_stationary = false;  // Initially not stationary
@@ -255,7 +257,7 @@ TEST_F(ObjectDetectorTest, EnrichDetectionsWithStationaryStatus) {
     for (int i = 0; i < 5; i++) {
         std::vector<Detection> same_detections;
         Detection d;
-        d.class_name = "person";
+        d.class_id = ClassRegistry::intern("person");
         d.confidence = 0.92;
         d.bbox = cv::Rect(100, 100, 50, 100);  // Same position
         same_detections.push_back(d);
@@ -267,7 +269,7 @@ TEST_F(ObjectDetectorTest, EnrichDetectionsWithStationaryStatus) {
     // After several frames in the same position, the object should be marked as stationary
     std::vector<Detection> final_detections;
     Detection d_final;
-    d_final.class_name = "person";
+    d_final.class_id = ClassRegistry::intern("person");
     d_final.confidence = 0.92;
     d_final.bbox = cv::Rect(100, 100, 50, 100);
     final_detections.push_back(d_final);
@@ -287,13 +289,13 @@ TEST_F(ObjectDetectorTest, StationaryLabelFormat) {
     // This is a documentation test - the actual label formatting happens in drawing code
     
     Detection d;
-    d.class_name = "car";
+    d.class_id = ClassRegistry::intern("car");
     d.confidence = 0.91;
     d.is_stationary = true;
     d.stationary_duration_seconds = 120;  // 2 minutes
     
     // Build label as done in network_streamer.cpp, viewfinder_window.cpp, and parallel_frame_processor.cpp
-    std::string label = d.class_name + " (" + 
+    std::string label = ClassRegistry::name(d.class_id) + " (" + 
                        std::to_string(static_cast<int>(d.confidence * 100)) + "%)";
     if (d.is_stationary) {
         label += ", stationary";
@@ -315,7 +317,7 @@ TEST_F(ObjectDetectorTest, StationaryLabelFormat) {
     
     // Test with seconds
     d.stationary_duration_seconds = 45;
-    label = d.class_name + " (" + 
+    label = ClassRegistry::name(d.class_id) + " (" + 
            std::to_string(static_cast<int>(d.confidence * 100)) + "%)";
     if (d.is_stationary) {
         label += ", stationary";
@@ -334,7 +336,7 @@ TEST_F(ObjectDetectorTest, StationaryLabelFormat) {
     // Test non-stationary object
     d.is_stationary = false;
     d.stationary_duration_seconds = 0;
-    label = d.class_name + " (" + 
+    label = ClassRegistry::name(d.class_id) + " (" + 
            std::to_string(static_cast<int>(d.confidence * 100)) + "%)";
     if (d.is_stationary) {
         label += ", stationary";
@@ -367,3 +369,270 @@ TEST_F(ObjectDetectorTest, GetTopDetectedObjectsWithLimit) {
     EXPECT_TRUE(top_10.empty());
     EXPECT_TRUE(top_20.empty());
 }
+
+TEST_F(ObjectDetectorTest, SharedModelTrackerKeepsOwnTrackingState) {
+    auto owner = std::make_shared<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    ObjectDetector tracker(owner, logger);
+    
+    // The model owner failed to load, so the tracking-only detector cannot initialize either
+    EXPECT_FALSE(tracker.initialize());
+    EXPECT_EQ(tracker.getInferenceReplicaCount(), owner->getInferenceReplicaCount());
+    EXPECT_FALSE(tracker.switchModel(DetectionModelFactory::ModelType::YOLO_V8_NANO));
+    
+    Detection person;
+    person.class_id = ClassRegistry::intern("person");
+    person.confidence = 0.9f;
+    person.bbox = cv::Rect(100, 100, 50, 100);
+    tracker.updateTracking({person});
+    
+    EXPECT_EQ(tracker.getTrackedObjects().size(), 1u);
+    EXPECT_TRUE(owner->getTrackedObjects().empty());
+}
+
+TEST_F(ObjectDetectorTest, PredictTracksExtrapolatesBetweenInferences) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    // A person walking right at 200 pixels per second, inferred at 5 fps
+    auto start = std::chrono::steady_clock::now();
+    auto at = [start](double seconds) {
+        return start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(seconds));
+    };
+    Detection person;
+    person.class_id = ClassRegistry::intern("person");
+    person.confidence = 0.9;
+    for (int i = 0; i < 8; ++i) {
+        person.bbox = cv::Rect(100 + i * 40, 200, 50, 100);
+        detector->updateTracking({person}, at(i * 0.2));
+    }
+    
+    // Half a second later, without inference, the box has moved on
+    std::vector<Detection> predicted;
+    detector->predictTracks(at(1.9), cv::Size(1280, 720), predicted);
+    ASSERT_EQ(predicted.size(), 1u);
+    EXPECT_EQ(ClassRegistry::name(predicted[0].class_id), "person");
+    EXPECT_NEAR(predicted[0].bbox.x, 380 + 100, 15);
+    EXPECT_NEAR(predicted[0].confidence, 0.9, 1e-6);
+    ASSERT_EQ(detector->getTrackedObjects().size(), 1u);
+    EXPECT_EQ(detector->getTrackedObjects()[0].bbox, predicted[0].bbox);
+}
+
+TEST_F(ObjectDetectorTest, TrackKeepsIdentityAtLowInferenceRate) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    // Inferred once a second: the last step (150 pixels) is beyond the matching
+    // distance from the last detection, but not from the predicted position
+    auto start = std::chrono::steady_clock::now();
+    Detection person;
+    person.class_id = ClassRegistry::intern("person");
+    person.confidence = 0.9;
+    int positions[] = {0, 80, 160, 310};
+    for (int i = 0; i < 4; ++i) {
+        person.bbox = cv::Rect(positions[i], 200, 50, 100);
+        detector->updateTracking({person}, start + std::chrono::seconds(i));
+    }
+    
+    ASSERT_EQ(detector->getTrackedObjects().size(), 1u);
+    EXPECT_FALSE(detector->getTrackedObjects()[0].is_new);
+    EXPECT_EQ(detector->getTotalObjectsDetected(), 1);
+}
+
+TEST_F(ObjectDetectorTest, TrackPredictedOutOfFrameExits) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    auto start = std::chrono::steady_clock::now();
+    Detection person;
+    person.class_id = ClassRegistry::intern("person");
+    person.confidence = 0.9;
+    for (int i = 0; i < 6; ++i) {
+        person.bbox = cv::Rect(400 + i * 40, 200, 50, 100);
+        detector->updateTracking({person}, start + std::chrono::milliseconds(200 * i));
+    }
+    
+    // Next inference misses it near the right edge; shortly after, its predicted box is past the edge
+    detector->updateTracking({}, start + std::chrono::milliseconds(1200));
+    std::vector<Detection> predicted;
+    detector->predictTracks(start + std::chrono::milliseconds(1300), cv::Size(640, 480), predicted);
+    EXPECT_TRUE(predicted.empty());
+    EXPECT_TRUE(detector->getTrackedObjects().empty());
+}
+
+TEST_F(ObjectDetectorTest, MoveTracksRepositionsBySlot) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    Detection person;
+    person.class_id = ClassRegistry::intern("person");
+    person.confidence = 0.9;
+    person.bbox = cv::Rect(100, 200, 50, 100);
+    Detection car;
+    car.class_id = ClassRegistry::intern("car");
+    car.confidence = 0.8;
+    car.bbox = cv::Rect(600, 300, 200, 120);
+    detector->updateTracking({person, car});
+    
+    const auto& tracked = detector->getTrackedObjects();
+    ASSERT_EQ(tracked.size(), 2u);
+    EXPECT_NE(tracked[0].id, tracked[1].id);
+    uint64_t person_id = ClassRegistry::name(tracked[0].class_id) == "person" ? tracked[0].id : tracked[1].id;
+    
+    std::vector<cv::Rect> boxes;
+    detector->presentTrackBoxes(boxes);
+    auto person_slot = std::find(boxes.begin(), boxes.end(), person.bbox);
+    ASSERT_NE(person_slot, boxes.end());
+    EXPECT_EQ(std::count(boxes.begin(), boxes.end(), car.bbox), 1);
+    
+    // Only the person is moved; that is not a detection, so no track ages or recovers.
+    // The car was seen once, so its prediction stays where it was
+    for (auto& box : boxes) {
+        box = cv::Rect();
+    }
+    boxes[person_slot - boxes.begin()] = cv::Rect(130, 205, 52, 104);
+    std::vector<Detection> moved;
+    detector->moveTracks(boxes, std::chrono::steady_clock::now(), moved);
+    ASSERT_EQ(moved.size(), 2u);
+    for (const auto& tracker : detector->getTrackedObjects()) {
+        EXPECT_EQ(tracker.bbox, tracker.id == person_id ? cv::Rect(130, 205, 52, 104) : car.bbox);
+        EXPECT_EQ(tracker.frames_since_detection, 0);
+    }
+}
+
+TEST_F(ObjectDetectorTest, SharedSnapshotOutlivesTrackingUpdates) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    Detection person;
+    person.class_id = ClassRegistry::intern("person");
+    person.confidence = 0.9;
+    person.bbox = cv::Rect(100, 200, 50, 100);
+    detector->updateTracking({person});
+    auto held = detector->shareTrackedObjects();
+    EXPECT_EQ(held.get(), detector->shareTrackedObjects().get());
+    
+    // A held snapshot keeps its records while the tracker moves on
+    person.bbox = cv::Rect(120, 200, 50, 100);
+    detector->updateTracking({person});
+    auto next = detector->shareTrackedObjects();
+    EXPECT_NE(held.get(), next.get());
+    ASSERT_EQ(held->size(), 1u);
+    EXPECT_EQ((*held)[0].bbox, cv::Rect(100, 200, 50, 100));
+    EXPECT_EQ((*next)[0].bbox, cv::Rect(120, 200, 50, 100));
+    
+    // Once released, its buffer is refilled rather than a new one allocated
+    const auto* released = held.get();
+    held.reset();
+    next.reset();
+    person.bbox = cv::Rect(140, 200, 50, 100);
+    detector->updateTracking({person});
+    EXPECT_EQ(detector->shareTrackedObjects().get(), released);
+}
+
+TEST_F(ObjectDetectorTest, CrossingObjectsKeepIdentity) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    // Two people walk past each other on almost the same line, inferred at 5 fps
+    auto start = std::chrono::steady_clock::now();
+    Detection left_walker;
+    left_walker.class_id = ClassRegistry::intern("person");
+    left_walker.confidence = 0.9;
+    Detection right_walker = left_walker;
+    for (int i = 0; i < 10; ++i) {
+        left_walker.bbox = cv::Rect(100 + i * 40, 200, 50, 100);
+        right_walker.bbox = cv::Rect(460 - i * 40, 215, 50, 100);
+        detector->updateTracking({right_walker, left_walker}, start + std::chrono::milliseconds(200 * i));
+        
+        ASSERT_EQ(detector->getTrackedObjects().size(), 2u) << "step " << i;
+    }
+    
+    // Same two tracks, each now on the other side
+    EXPECT_EQ(detector->getTotalObjectsDetected(), 2);
+    for (const auto& tracker : detector->getTrackedObjects()) {
+        bool is_left_walker = tracker.id == 2;  // Created second, after right_walker
+        EXPECT_EQ(tracker.bbox, is_left_walker ? left_walker.bbox : right_walker.bbox);
+    }
+}
+
+TEST_F(ObjectDetectorTest, NeighboursStartingToWalkKeepTheirTracks) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    // Two people standing side by side...
+    auto start = std::chrono::steady_clock::now();
+    Detection left;
+    left.class_id = ClassRegistry::intern("person");
+    left.confidence = 0.9;
+    Detection right = left;
+    left.bbox = cv::Rect(100, 200, 50, 100);
+    right.bbox = cv::Rect(160, 200, 50, 100);
+    for (int i = 0; i < 3; ++i) {
+        detector->updateTracking({left, right}, start + std::chrono::milliseconds(200 * i));
+    }
+    
+    // ...set off together: the left one is now nearest to where the right one stood
+    left.bbox.x += 40;
+    right.bbox.x += 40;
+    detector->updateTracking({left, right}, start + std::chrono::milliseconds(600));
+    
+    const auto& tracked = detector->getTrackedObjects();
+    ASSERT_EQ(tracked.size(), 2u);
+    EXPECT_EQ(detector->getTotalObjectsDetected(), 2);
+    for (const auto& tracker : tracked) {
+        EXPECT_TRUE(tracker.was_present_last_frame);
+        EXPECT_EQ(tracker.bbox, tracker.id == 1 ? left.bbox : right.bbox);
+    }
+}
+
+TEST_F(ObjectDetectorTest, FullTrackerTableRecyclesSlots) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    // Fill every slot with people far enough apart to be separate objects
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Detection> crowd;
+    for (int i = 0; i < 100; ++i) {
+        Detection person;
+        person.class_id = ClassRegistry::intern("person");
+        person.confidence = 0.9;
+        person.bbox = cv::Rect((i % 10) * 300, (i / 10) * 300, 50, 100);
+        crowd.push_back(person);
+    }
+    detector->updateTracking(crowd, start);
+    ASSERT_EQ(detector->getTrackedObjects().size(), 100u);
+    
+    // Newcomers elsewhere push out the oldest 20 tracks and take their slots under fresh ids
+    std::vector<Detection> newcomers(crowd.begin(), crowd.begin() + 10);
+    for (auto& person : newcomers) {
+        person.bbox.y += 5000;
+    }
+    detector->updateTracking(newcomers, start + std::chrono::milliseconds(200));
+    
+    const auto& tracked = detector->getTrackedObjects();
+    ASSERT_EQ(tracked.size(), 90u);
+    std::set<uint64_t> ids;
+    for (const auto& tracker : tracked) {
+        ids.insert(tracker.id);
+    }
+    EXPECT_EQ(ids.size(), tracked.size());
+    EXPECT_EQ(*ids.rbegin(), 110u);
+    EXPECT_TRUE(tracked.back().is_new);
+}
+
+TEST_F(ObjectDetectorTest, TargetCheckUsesClassId) {
+    auto detector = std::make_unique<ObjectDetector>(
+        model_path, config_path, classes_path, confidence_threshold, logger);
+    
+    // Model detections carry the registry id; the name is only for output
+    Detection dog;
+    dog.class_id = ClassRegistry::intern("dog");
+    EXPECT_TRUE(detector->isTargetClass(dog));
+    
+    Detection toaster;
+    toaster.class_id = ClassRegistry::intern("toaster");
+    EXPECT_FALSE(detector->isTargetClass(toaster));
+    EXPECT_TRUE(detector->isTargetClass("person"));
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "onnx_model_info.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Minimal protobuf encoder for building synthetic ONNX ModelProtos
+using Bytes = std::vector<uint8_t>;
+
+void appendVarint(Bytes& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+Bytes varintField(uint32_t number, uint64_t value) {
+    Bytes out;
+    appendVarint(out, (number << 3) | 0);
+    appendVarint(out, value);
+    return out;
+}
+
+Bytes bytesField(uint32_t number, const Bytes& payload) {
+    Bytes out;
+    appendVarint(out, (number << 3) | 2);
+    appendVarint(out, payload.size());
+    out.insert(out.end(), payload.begin(), payload.end());
+    return out;
+}
+
+Bytes stringField(uint32_t number, const std::string& text) {
+    return bytesField(number, Bytes(text.begin(), text.end()));
+}
+
+Bytes concat(std::initializer_list<Bytes> parts) {
+    Bytes out;
+    for (const auto& part : parts) {
+        out.insert(out.end(), part.begin(), part.end());
+    }
+    return out;
+}
+
+Bytes node(const std::string& op_type) {
+    return bytesField(1, concat({stringField(1, "x"), stringField(2, "y"), stringField(4, op_type)}));
+}
+
+Bytes initializer(int data_type, size_t raw_bytes) {
+    // dims, data_type, name, raw_data
+    return bytesField(5, concat({varintField(1, 3), varintField(2, data_type), stringField(8, "w"),
+                                 bytesField(9, Bytes(raw_bytes, 0xAB))}));
+}
+
+Bytes input(int elem_type) {
+    Bytes tensor_type = concat({varintField(1, elem_type), bytesField(2, Bytes())});
+    Bytes type = bytesField(1, tensor_type);
+    return bytesField(11, concat({stringField(1, "images"), bytesField(2, type)}));
+}
+
+Bytes model(const Bytes& graph) {
+    // ir_version, producer_name, graph
+    return concat({varintField(1, 8), stringField(2, "pytorch"), bytesField(7, graph)});
+}
+
+OnnxModelInfo::Summary inspect(const Bytes& bytes) {
+    return OnnxModelInfo::inspectBuffer(bytes.data(), bytes.size());
+}
+
+}  // namespace
+
+TEST(OnnxModelInfoTest, Fp32Model) {
+    auto summary = inspect(model(concat({node("Conv"), node("Sigmoid"), input(OnnxModelInfo::ELEM_TYPE_FLOAT),
+                                         initializer(OnnxModelInfo::ELEM_TYPE_FLOAT, 400)})));
+
+    ASSERT_TRUE(summary.valid);
+    EXPECT_EQ(summary.precision, OnnxModelInfo::Precision::FP32);
+    EXPECT_EQ(summary.quant_format, OnnxModelInfo::QuantFormat::NONE);
+    EXPECT_EQ(summary.node_count, 2);
+    EXPECT_EQ(summary.input_elem_type, OnnxModelInfo::ELEM_TYPE_FLOAT);
+    EXPECT_EQ(OnnxModelInfo::describe(summary), "FP32");
+}
+
+TEST(OnnxModelInfoTest, QdqModelIsInt8) {
+    auto summary = inspect(model(concat({input(OnnxModelInfo::ELEM_TYPE_FLOAT),
+                                         node("QuantizeLinear"), node("DequantizeLinear"),
+                                         node("DequantizeLinear"), node("Conv"),
+                                         initializer(OnnxModelInfo::ELEM_TYPE_INT8, 64)})));
+
+    ASSERT_TRUE(summary.valid);
+    EXPECT_EQ(summary.precision, OnnxModelInfo::Precision::INT8);
+    EXPECT_EQ(summary.quant_format, OnnxModelInfo::QuantFormat::QDQ);
+    EXPECT_EQ(summary.quantize_nodes, 1);
+    EXPECT_EQ(summary.dequantize_nodes, 2);
+    EXPECT_EQ(OnnxModelInfo::describe(summary), "INT8 (QDQ)");
+}
+
+TEST(OnnxModelInfoTest, QOperatorModelIsInt8) {
+    auto summary = inspect(model(concat({node("QLinearConv"), node("QLinearAdd"), node("ConvInteger")})));
+
+    ASSERT_TRUE(summary.valid);
+    EXPECT_EQ(summary.quant_format, OnnxModelInfo::QuantFormat::QOPERATOR);
+    EXPECT_EQ(summary.integer_op_nodes, 3);
+    EXPECT_EQ(OnnxModelInfo::describe(summary), "INT8 (QOperator)");
+}
+
+TEST(OnnxModelInfoTest, Fp16WeightsWithFloatIo) {
+    // onnxconverter-common with keep_io_types=True
+    auto summary = inspect(model(concat({input(OnnxModelInfo::ELEM_TYPE_FLOAT), node("Cast"), node("Conv"),
+                                         initializer(OnnxModelInfo::ELEM_TYPE_FLOAT16, 200),
+                                         initializer(OnnxModelInfo::ELEM_TYPE_FLOAT16, 200),
+                                         initializer(OnnxModelInfo::ELEM_TYPE_FLOAT, 4)})));
+
+    ASSERT_TRUE(summary.valid);
+    EXPECT_EQ(summary.precision, OnnxModelInfo::Precision::FP16);
+    EXPECT_EQ(summary.float16_initializers, 2);
+    EXPECT_EQ(summary.float_initializers, 1);
+}
+
+TEST(OnnxModelInfoTest, Fp16Input) {
+    auto summary = inspect(model(concat({input(OnnxModelInfo::ELEM_TYPE_FLOAT16), node("Conv")})));
+
+    ASSERT_TRUE(summary.valid);
+    EXPECT_EQ(summary.input_elem_type, OnnxModelInfo::ELEM_TYPE_FLOAT16);
+    EXPECT_EQ(OnnxModelInfo::describe(summary), "FP16");
+}
+
+TEST(OnnxModelInfoTest, LargeInitializersAreSkipped) {
+    // Length-delimited payloads larger than 127 bytes need multi-byte lengths
+    auto summary = inspect(model(concat({initializer(OnnxModelInfo::ELEM_TYPE_FLOAT, 100000),
+                                         node("DequantizeLinear")})));
+
+    ASSERT_TRUE(summary.valid);
+    EXPECT_EQ(summary.float_initializers, 1);
+    EXPECT_EQ(summary.quant_format, OnnxModelInfo::QuantFormat::QDQ);
+}
+
+TEST(OnnxModelInfoTest, TruncatedOrMissingFileIsInvalid) {
+    Bytes bytes = model(concat({node("Conv"), initializer(OnnxModelInfo::ELEM_TYPE_FLOAT, 1000)}));
+    bytes.resize(bytes.size() / 2);
+
+    EXPECT_FALSE(inspect(bytes).valid);
+    EXPECT_FALSE(inspect(Bytes()).valid);
+    EXPECT_FALSE(OnnxModelInfo::inspect("non_existent_model.onnx").valid);
+    EXPECT_EQ(OnnxModelInfo::describe(OnnxModelInfo::Summary()), "unknown");
+}
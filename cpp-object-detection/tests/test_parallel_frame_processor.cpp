@@ -118,6 +118,22 @@ TEST_F(ParallelFrameProcessorTest, SubmitFrameMultiThreaded) {
     processor->shutdown();
 }
 
+TEST_F(ParallelFrameProcessorTest, ResultsCarryTheCaptureTime) {
+    // Tracking times motion by when the camera read returned, not when the frame was submitted
+    for (int threads : {1, 2}) {
+        auto processor = std::make_unique<ParallelFrameProcessor>(
+            detector, logger, perf_monitor, threads, 10);
+        processor->initialize();
+        
+        auto captured = std::chrono::steady_clock::now() - std::chrono::milliseconds(250);
+        cv::Mat frame = cv::Mat::zeros(480, 640, CV_8UC3);
+        auto result = processor->submitFrame(frame, nullptr, captured).get();
+        EXPECT_EQ(result.capture_time, captured);
+        
+        processor->shutdown();
+    }
+}
+
 TEST_F(ParallelFrameProcessorTest, QueueSizeTracking) {
     // Test queue size tracking
     auto processor = std::make_unique<ParallelFrameProcessor>(
@@ -221,3 +237,166 @@ TEST_F(ParallelFrameProcessorTest, GetTotalImagesSaved) {
     
     processor->shutdown();
 }
+
+TEST_F(ParallelFrameProcessorTest, ResultsResolveInCaptureOrder) {
+    // Results must carry the capture sequence and resolve in submission order
+    auto processor = std::make_unique<ParallelFrameProcessor>(
+        detector, logger, perf_monitor, 4, 20);
+    
+    processor->initialize();
+    
+    cv::Mat frame = cv::Mat::zeros(120, 160, CV_8UC3);
+    std::vector<std::future<ParallelFrameProcessor::FrameResult>> futures;
+    for (int i = 0; i < 12; ++i) {
+        futures.push_back(processor->submitFrame(frame));
+    }
+    
+    uint64_t previous_sequence = 0;
+    bool first = true;
+    for (auto& future : futures) {
+        auto result = future.get();
+        if (result.processed) {
+            if (!first) {
+                EXPECT_GT(result.sequence, previous_sequence);
+            }
+            previous_sequence = result.sequence;
+            first = false;
+        }
+    }
+    
+    EXPECT_EQ(processor->getReorderBacklog(), 0);
+    processor->shutdown();
+}
+
+TEST_F(ParallelFrameProcessorTest, ShutdownResolvesQueuedFrames) {
+    // Frames still queued at shutdown must resolve rather than hang
+    auto processor = std::make_unique<ParallelFrameProcessor>(
+        detector, logger, perf_monitor, 2, 50);
+    
+    processor->initialize();
+    
+    cv::Mat frame = cv::Mat::zeros(120, 160, CV_8UC3);
+    std::vector<std::future<ParallelFrameProcessor::FrameResult>> futures;
+    for (int i = 0; i < 20; ++i) {
+        futures.push_back(processor->submitFrame(frame));
+    }
+    
+    processor->shutdown();
+    
+    for (auto& future : futures) {
+        EXPECT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    }
+}
+
+TEST_F(ParallelFrameProcessorTest, BatchedInferenceResolvesAllFramesInOrder) {
+    // Bursts are drained in batches; every future must still resolve in capture order
+    auto processor = std::make_unique<ParallelFrameProcessor>(
+        detector, logger, perf_monitor, 2, 20);
+    processor->setBatching(4, 20);
+    EXPECT_EQ(processor->getMaxBatchSize(), 4u);
+    
+    processor->initialize();
+    
+    cv::Mat frame = cv::Mat::zeros(120, 160, CV_8UC3);
+    std::vector<std::future<ParallelFrameProcessor::FrameResult>> futures;
+    for (int i = 0; i < 10; ++i) {
+        futures.push_back(processor->submitFrame(frame));
+    }
+    
+    uint64_t expected_sequence = 0;
+    for (auto& future : futures) {
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        auto result = future.get();
+        EXPECT_TRUE(result.processed);
+        EXPECT_EQ(result.sequence, expected_sequence++);
+    }
+    
+    EXPECT_EQ(processor->getReorderBacklog(), 0);
+    processor->shutdown();
+}
+
+TEST_F(ParallelFrameProcessorTest, BatchingConfigurationIsClamped) {
+    auto processor = std::make_unique<ParallelFrameProcessor>(
+        detector, logger, perf_monitor, 2, 10);
+    EXPECT_EQ(processor->getMaxBatchSize(), 1u);
+    
+    processor->setBatching(0, -5);
+    EXPECT_EQ(processor->getMaxBatchSize(), 1u);
+}
+
+TEST_F(ParallelFrameProcessorTest, CamerasSharingSchedulerResolveInOrder) {
+    // Two cameras, one shared scheduler: each camera's futures resolve in its own capture order
+    auto scheduler = std::make_shared<InferenceScheduler>(detector, logger, 2, 20);
+    auto second_tracker = std::make_shared<ObjectDetector>(detector, logger);
+    auto first = std::make_unique<ParallelFrameProcessor>(detector, logger, perf_monitor, 1, 20);
+    auto second = std::make_unique<ParallelFrameProcessor>(second_tracker, logger, perf_monitor, 1, 20);
+    first->setInferenceScheduler(scheduler, scheduler->registerStream("camera0"));
+    second->setInferenceScheduler(scheduler, scheduler->registerStream("camera1"));
+    EXPECT_TRUE(first->isParallelEnabled());
+    
+    first->initialize();
+    second->initialize();
+    scheduler->initialize();
+    
+    cv::Mat frame = cv::Mat::zeros(120, 160, CV_8UC3);
+    std::vector<std::future<ParallelFrameProcessor::FrameResult>> first_futures, second_futures;
+    for (int i = 0; i < 6; ++i) {
+        first_futures.push_back(first->submitFrame(frame));
+        second_futures.push_back(second->submitFrame(frame));
+    }
+    
+    for (auto* futures : {&first_futures, &second_futures}) {
+        uint64_t expected_sequence = 0;
+        for (auto& future : *futures) {
+            ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+            auto result = future.get();
+            EXPECT_TRUE(result.processed);
+            EXPECT_EQ(result.sequence, expected_sequence++);
+        }
+    }
+    
+    auto stats = scheduler->getStreamStats();
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].inferred, 6u);
+    EXPECT_EQ(stats[1].inferred, 6u);
+    
+    first->shutdown();
+    second->shutdown();
+    scheduler->shutdown();
+}
+
+TEST_F(ParallelFrameProcessorTest, BrightnessEstimateMatchesGrayscaleMean) {
+    cv::Mat frame(480, 640, CV_8UC3);
+    for (int y = 0; y < frame.rows; ++y) {
+        for (int x = 0; x < frame.cols; ++x) {
+            frame.at<cv::Vec3b>(y, x) = cv::Vec3b(static_cast<uchar>(x * 255 / 639),
+                                                  static_cast<uchar>(y * 255 / 479),
+                                                  static_cast<uchar>(200));
+        }
+    }
+    cv::Mat gray;
+    cv::cvtColor(frame, gray, cv::COLOR_BGR2GRAY);
+    EXPECT_NEAR(ParallelFrameProcessor::estimateBrightness(frame), cv::mean(gray)[0], 2.0);
+    
+    // Uniform frames are exact, including frames smaller than the sampling stride
+    EXPECT_NEAR(ParallelFrameProcessor::estimateBrightness(cv::Mat(720, 1280, CV_8UC3, cv::Scalar(200, 200, 200))),
+                200.0, 0.5);
+    EXPECT_NEAR(ParallelFrameProcessor::estimateBrightness(cv::Mat(3, 3, CV_8UC1, cv::Scalar(90))), 90.0, 0.5);
+    EXPECT_DOUBLE_EQ(ParallelFrameProcessor::estimateBrightness(cv::Mat()), 0.0);
+}
+
+TEST_F(ParallelFrameProcessorTest, BrightnessFilterFollowsSceneBrightness) {
+    auto processor = std::make_unique<ParallelFrameProcessor>(
+        detector, logger, perf_monitor, 1, 10, "detections", true);
+    processor->initialize();
+    
+    auto result = processor->processFrameSync(cv::Mat(480, 640, CV_8UC3, cv::Scalar(235, 235, 235)));
+    EXPECT_TRUE(result.processed);
+    EXPECT_TRUE(processor->isBrightnessFilterActive());
+    
+    result = processor->processFrameSync(cv::Mat(480, 640, CV_8UC3, cv::Scalar(60, 60, 60)));
+    EXPECT_TRUE(result.processed);
+    EXPECT_FALSE(processor->isBrightnessFilterActive());
+    
+    processor->shutdown();
+}
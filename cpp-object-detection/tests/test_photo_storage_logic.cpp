@@ -60,10 +60,9 @@ TEST_F(PhotoStorageLogicTest, DetectorCanUpdateTracking) {
     std::vector<Detection> detections;
     
     Detection det1;
-    det1.class_name = "person";
+    det1.class_id = ClassRegistry::intern("person");
     det1.confidence = 0.9;
     det1.bbox = cv::Rect(100, 100, 50, 100);
-    det1.class_id = 0;
     detections.push_back(det1);
     
     detector->updateTracking(detections);
@@ -71,7 +70,7 @@ TEST_F(PhotoStorageLogicTest, DetectorCanUpdateTracking) {
     // After update, tracked objects should contain the detection
     auto tracked = detector->getTrackedObjects();
     EXPECT_EQ(tracked.size(), 1);
-    EXPECT_EQ(tracked[0].object_type, "person");
+    EXPECT_EQ(ClassRegistry::name(tracked[0].class_id), "person");
     EXPECT_TRUE(tracked[0].is_new);  // First detection should be marked as new
 }
 
@@ -80,16 +79,14 @@ TEST_F(PhotoStorageLogicTest, DetectorTracksMultipleObjects) {
     std::vector<Detection> detections;
     
     Detection det1;
-    det1.class_name = "person";
+    det1.class_id = ClassRegistry::intern("person");
     det1.confidence = 0.9;
     det1.bbox = cv::Rect(100, 100, 50, 100);
-    det1.class_id = 0;
     
     Detection det2;
-    det2.class_name = "car";
+    det2.class_id = ClassRegistry::intern("car");
     det2.confidence = 0.85;
     det2.bbox = cv::Rect(300, 200, 100, 80);
-    det2.class_id = 1;
     
     detections.push_back(det1);
     detections.push_back(det2);
@@ -104,10 +101,9 @@ TEST_F(PhotoStorageLogicTest, DetectorMarksNewObjects) {
     // Test that detector correctly marks new objects
     std::vector<Detection> detections1;
     Detection det1;
-    det1.class_name = "person";
+    det1.class_id = ClassRegistry::intern("person");
     det1.confidence = 0.9;
     det1.bbox = cv::Rect(100, 100, 50, 100);
-    det1.class_id = 0;
     detections1.push_back(det1);
     
     detector->updateTracking(detections1);
@@ -118,10 +114,9 @@ TEST_F(PhotoStorageLogicTest, DetectorMarksNewObjects) {
     // Same object in next frame (moved slightly)
     std::vector<Detection> detections2;
     Detection det2;
-    det2.class_name = "person";
+    det2.class_id = ClassRegistry::intern("person");
     det2.confidence = 0.9;
     det2.bbox = cv::Rect(105, 105, 50, 100);  // Moved 5 pixels
-    det2.class_id = 0;
     detections2.push_back(det2);
     
     detector->updateTracking(detections2);
@@ -134,10 +129,9 @@ TEST_F(PhotoStorageLogicTest, DetectorDetectsNewInstance) {
     // Test that detector correctly identifies new instances of same type
     std::vector<Detection> detections1;
     Detection det1;
-    det1.class_name = "car";
+    det1.class_id = ClassRegistry::intern("car");
     det1.confidence = 0.9;
     det1.bbox = cv::Rect(100, 100, 100, 80);
-    det1.class_id = 1;
     detections1.push_back(det1);
     
     detector->updateTracking(detections1);
@@ -145,16 +139,14 @@ TEST_F(PhotoStorageLogicTest, DetectorDetectsNewInstance) {
     // Add a second car far away (new instance)
     std::vector<Detection> detections2;
     Detection det2a;
-    det2a.class_name = "car";
+    det2a.class_id = ClassRegistry::intern("car");
     det2a.confidence = 0.9;
     det2a.bbox = cv::Rect(105, 105, 100, 80);  // First car, moved slightly
-    det2a.class_id = 1;
     
     Detection det2b;
-    det2b.class_name = "car";
+    det2b.class_id = ClassRegistry::intern("car");
     det2b.confidence = 0.85;
     det2b.bbox = cv::Rect(400, 300, 100, 80);  // Second car, far away
-    det2b.class_id = 1;
     
     detections2.push_back(det2a);
     detections2.push_back(det2b);
@@ -205,7 +197,7 @@ TEST_F(PhotoStorageLogicTest, ProcessorCreatesWithCustomOutputDir) {
 TEST_F(PhotoStorageLogicTest, VerifyObjectTrackerStructure) {
     // Verify that ObjectTracker has all required fields
     ObjectDetector::ObjectTracker tracker;
-    tracker.object_type = "test";
+    tracker.class_id = ClassRegistry::intern("test");
     tracker.center = cv::Point2f(100, 100);
     tracker.previous_center = cv::Point2f(95, 95);
     tracker.was_present_last_frame = true;
@@ -213,7 +205,7 @@ TEST_F(PhotoStorageLogicTest, VerifyObjectTrackerStructure) {
     tracker.is_new = true;
     
     // Verify all fields can be set and read
-    EXPECT_EQ(tracker.object_type, "test");
+    EXPECT_EQ(ClassRegistry::name(tracker.class_id), "test");
     EXPECT_EQ(tracker.center.x, 100);
     EXPECT_EQ(tracker.center.y, 100);
     EXPECT_TRUE(tracker.was_present_last_frame);
@@ -228,10 +220,9 @@ TEST_F(PhotoStorageLogicTest, FirstDetectionAlwaysSaves) {
     
     std::vector<Detection> detections;
     Detection det;
-    det.class_name = "car";
+    det.class_id = ClassRegistry::intern("car");
     det.confidence = 0.9;
     det.bbox = cv::Rect(100, 100, 100, 80);
-    det.class_id = 1;
     detections.push_back(det);
     
     detector->updateTracking(detections);
@@ -240,6 +231,6 @@ TEST_F(PhotoStorageLogicTest, FirstDetectionAlwaysSaves) {
     // First detection should be marked as new
     EXPECT_EQ(tracked.size(), 1);
     EXPECT_TRUE(tracked[0].is_new);
-    EXPECT_EQ(tracked[0].object_type, "car");
+    EXPECT_EQ(ClassRegistry::name(tracked[0].class_id), "car");
 }
 
@@ -56,7 +56,7 @@ TEST_F(StationaryDetectionTest, DetectStationaryObjectBasic) {
     // Create fake detections with same position repeatedly
     std::vector<Detection> detections;
     Detection det;
-    det.class_name = "person";
+    det.class_id = ClassRegistry::intern("person");
     det.bbox = cv::Rect(100, 100, 50, 100);
     det.confidence = 0.9f;
     detections.push_back(det);
@@ -83,7 +83,7 @@ TEST_F(StationaryDetectionTest, DetectMovingObject) {
     for (int i = 0; i < 5; i++) {
         std::vector<Detection> detections;
         Detection det;
-        det.class_name = "person";
+        det.class_id = ClassRegistry::intern("person");
         // Move object by 20 pixels each frame (above stationary threshold of 10)
         det.bbox = cv::Rect(100 + i * 20, 100, 50, 100);
         det.confidence = 0.9f;
@@ -111,7 +111,7 @@ TEST_F(StationaryDetectionTest, StationaryTimeoutNotReached) {
     // Create fake detections with same position
     std::vector<Detection> detections;
     Detection det;
-    det.class_name = "person";
+    det.class_id = ClassRegistry::intern("person");
     det.bbox = cv::Rect(100, 100, 50, 100);
     det.confidence = 0.9f;
     detections.push_back(det);
@@ -141,7 +141,7 @@ TEST_F(StationaryDetectionTest, StationaryTimeoutReached) {
     // Create fake detections with same position
     std::vector<Detection> detections;
     Detection det;
-    det.class_name = "person";
+    det.class_id = ClassRegistry::intern("person");
     det.bbox = cv::Rect(100, 100, 50, 100);
     det.confidence = 0.9f;
     detections.push_back(det);
@@ -168,7 +168,7 @@ TEST_F(StationaryDetectionTest, ObjectBecomesMobileAgain) {
     for (int i = 0; i < 5; i++) {
         std::vector<Detection> detections;
         Detection det;
-        det.class_name = "person";
+        det.class_id = ClassRegistry::intern("person");
         det.bbox = cv::Rect(100, 100, 50, 100);
         det.confidence = 0.9f;
         detections.push_back(det);
@@ -184,7 +184,7 @@ TEST_F(StationaryDetectionTest, ObjectBecomesMobileAgain) {
     for (int i = 0; i < 5; i++) {
         std::vector<Detection> detections;
         Detection det;
-        det.class_name = "person";
+        det.class_id = ClassRegistry::intern("person");
         // Move by 30 pixels (well above stationary threshold)
         det.bbox = cv::Rect(100 + i * 30, 100, 50, 100);
         det.confidence = 0.9f;
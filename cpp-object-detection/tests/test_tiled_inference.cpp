@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "tiled_inference.hpp"
+#include "class_registry.hpp"
+#include <vector>
+
+namespace {
+
+TiledInference::TileDetection makeDetection(const std::string& class_name, const cv::Rect& box, double confidence,
+                                            const cv::Rect& tile) {
+    TiledInference::TileDetection candidate;
+    candidate.detection.class_id = ClassRegistry::intern(class_name);
+    candidate.detection.bbox = box;
+    candidate.detection.confidence = confidence;
+    candidate.tile = tile;
+    return candidate;
+}
+
+}  // namespace
+
+TEST(TiledInferenceTest, AutomaticGridKeepsTilesWithinNetworkInput) {
+    auto tiles = TiledInference::computeTiles(cv::Size(1920, 1080), 0, 0, 640, 0.2);
+
+    // 4 columns x 2 rows; first and last tiles sit on the frame border
+    ASSERT_EQ(tiles.size(), 8u);
+    for (const auto& tile : tiles) {
+        EXPECT_LE(tile.width, 640);
+        EXPECT_LE(tile.height, 640);
+        EXPECT_EQ(tile & cv::Rect(0, 0, 1920, 1080), tile);
+    }
+    EXPECT_EQ(tiles.front(), cv::Rect(0, 0, 565, 600));
+    EXPECT_EQ(tiles[3].x + tiles[3].width, 1920);
+    EXPECT_EQ(tiles.back().y + tiles.back().height, 1080);
+
+    // Neighbours share about the requested fraction of a tile
+    int shared = tiles[0].x + tiles[0].width - tiles[1].x;
+    EXPECT_NEAR(static_cast<double>(shared) / tiles[0].width, 0.2, 0.02);
+}
+
+TEST(TiledInferenceTest, ExplicitGridAndSmallFrames) {
+    auto tiles = TiledInference::computeTiles(cv::Size(1280, 720), 2, 1, 640, 0.0);
+    ASSERT_EQ(tiles.size(), 2u);
+    EXPECT_EQ(tiles[0], cv::Rect(0, 0, 640, 720));
+    EXPECT_EQ(tiles[1], cv::Rect(640, 0, 640, 720));
+
+    // A frame no larger than the network input is a single tile
+    tiles = TiledInference::computeTiles(cv::Size(640, 480), 0, 0, 640, 0.2);
+    ASSERT_EQ(tiles.size(), 1u);
+    EXPECT_EQ(tiles[0], cv::Rect(0, 0, 640, 480));
+}
+
+TEST(TiledInferenceTest, ScheduleStaggersTilesOutsideEveryFrameSet) {
+    const std::vector<int> every_frame = {0};
+    for (uint64_t frame = 0; frame < 6; ++frame) {
+        EXPECT_TRUE(TiledInference::isTileDue(0, frame, 3, every_frame));
+
+        // Tiles 1..3 each run once every 3 frames, one of them per frame
+        int due = 0;
+        for (int tile = 1; tile <= 3; ++tile) {
+            due += TiledInference::isTileDue(tile, frame, 3, every_frame) ? 1 : 0;
+        }
+        EXPECT_EQ(due, 1);
+    }
+    EXPECT_TRUE(TiledInference::isTileDue(5, 7, 1, {}));
+}
+
+TEST(TiledInferenceTest, DuplicatesInOverlapBandAreFused) {
+    const cv::Size frame(1280, 720);
+    std::vector<TiledInference::TileDetection> candidates = {
+        makeDetection("person", cv::Rect(600, 100, 60, 150), 0.6, cv::Rect(0, 0, 700, 720)),
+        makeDetection("person", cv::Rect(602, 102, 60, 150), 0.8, cv::Rect(580, 0, 700, 720)),
+    };
+    uint64_t fused = 0;
+    auto detections = TiledInference::fuseDetections(candidates, frame, &fused);
+
+    ASSERT_EQ(detections.size(), 1u);
+    EXPECT_DOUBLE_EQ(detections[0].confidence, 0.8);
+    EXPECT_EQ(detections[0].bbox, cv::Rect(600, 100, 62, 152));
+    EXPECT_EQ(fused, 1u);
+}
+
+TEST(TiledInferenceTest, HalvesCutBySeamAreJoined) {
+    const cv::Size frame(1280, 720);
+    const cv::Rect left_tile(0, 0, 640, 720);
+    const cv::Rect right_tile(640, 0, 640, 720);
+    std::vector<TiledInference::TileDetection> candidates = {
+        makeDetection("car", cv::Rect(600, 100, 40, 200), 0.7, left_tile),
+        makeDetection("car", cv::Rect(640, 110, 50, 190), 0.6, right_tile),
+    };
+    auto detections = TiledInference::fuseDetections(candidates, frame);
+
+    ASSERT_EQ(detections.size(), 1u);
+    EXPECT_EQ(detections[0].bbox, cv::Rect(600, 100, 90, 200));
+}
+
+TEST(TiledInferenceTest, PartialViewMergesIntoFullFrameBox) {
+    const cv::Size frame(1280, 720);
+    std::vector<TiledInference::TileDetection> candidates = {
+        makeDetection("person", cv::Rect(600, 100, 100, 300), 0.9, cv::Rect(0, 0, 1280, 720)),
+        makeDetection("person", cv::Rect(600, 100, 40, 300), 0.5, cv::Rect(0, 0, 640, 720)),
+    };
+    auto detections = TiledInference::fuseDetections(candidates, frame);
+
+    ASSERT_EQ(detections.size(), 1u);
+    EXPECT_EQ(detections[0].bbox, cv::Rect(600, 100, 100, 300));
+}
+
+TEST(TiledInferenceTest, SeparateObjectsStaySeparate) {
+    const cv::Size frame(1280, 720);
+    const cv::Rect tile(0, 0, 640, 720);
+    std::vector<TiledInference::TileDetection> candidates = {
+        makeDetection("person", cv::Rect(100, 100, 40, 200), 0.9, tile),
+        makeDetection("person", cv::Rect(150, 100, 40, 200), 0.8, tile),
+        makeDetection("dog", cv::Rect(100, 100, 40, 200), 0.7, tile),
+        // Touches the frame border, which is not a seam
+        makeDetection("person", cv::Rect(0, 300, 30, 100), 0.6, tile),
+    };
+    EXPECT_EQ(TiledInference::fuseDetections(candidates, frame).size(), 4u);
+}
+
+TEST(TiledInferenceTest, BoxesFromOneSourceAreNeverFused) {
+    const cv::Size frame(1280, 720);
+    const cv::Rect tile(0, 0, 700, 720);
+    std::vector<TiledInference::TileDetection> candidates = {
+        // Two people standing close together, both kept by the tile's own NMS
+        makeDetection("person", cv::Rect(100, 100, 60, 150), 0.9, tile),
+        makeDetection("person", cv::Rect(120, 110, 60, 150), 0.8, tile),
+        // A child in front of an adult
+        makeDetection("person", cv::Rect(300, 100, 80, 200), 0.7, tile),
+        makeDetection("person", cv::Rect(310, 200, 40, 90), 0.6, tile),
+    };
+    uint64_t fused = 0;
+    EXPECT_EQ(TiledInference::fuseDetections(candidates, frame, &fused).size(), 4u);
+    EXPECT_EQ(fused, 0u);
+}
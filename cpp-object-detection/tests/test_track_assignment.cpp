@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "track_assignment.hpp"
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace {
+
+double totalCost(const std::vector<double>& cost, int columns, const std::vector<int>& assignment) {
+    double total = 0.0;
+    for (size_t row = 0; row < assignment.size(); ++row) {
+        total += cost[row * columns + assignment[row]];
+    }
+    return total;
+}
+
+}  // namespace
+
+TEST(TrackAssignmentTest, HungarianFindsMinimumCost) {
+    // Greedy row by row would take 1, then 2 and 5: total 8 instead of 5
+    const std::vector<double> cost = {
+        4, 1, 3,
+        2, 0, 5,
+        3, 2, 2,
+    };
+    TrackAssignment::Workspace workspace;
+    std::vector<int> assignment;
+    TrackAssignment::hungarian(cost, 3, 3, workspace, assignment);
+    EXPECT_EQ(assignment, (std::vector<int>{1, 0, 2}));
+    EXPECT_DOUBLE_EQ(totalCost(cost, 3, assignment), 5.0);
+}
+
+TEST(TrackAssignmentTest, HungarianMatchesBruteForce) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> value(0.0, 1.0);
+    // One workspace for every trial, as the tracker reuses it frame after frame
+    TrackAssignment::Workspace workspace;
+    std::vector<int> assignment;
+    for (int trial = 0; trial < 50; ++trial) {
+        const int rows = 1 + trial % 4;
+        const int columns = 5;
+        std::vector<double> cost(rows * columns);
+        for (auto& c : cost) {
+            c = value(rng);
+        }
+
+        // Every ordered choice of distinct columns for the rows
+        std::vector<int> columns_order(columns);
+        std::iota(columns_order.begin(), columns_order.end(), 0);
+        double best = 1e9;
+        do {
+            std::vector<int> candidate(columns_order.begin(), columns_order.begin() + rows);
+            best = std::min(best, totalCost(cost, columns, candidate));
+        } while (std::next_permutation(columns_order.begin(), columns_order.end()));
+
+        TrackAssignment::hungarian(cost, rows, columns, workspace, assignment);
+        EXPECT_NEAR(totalCost(cost, columns, assignment), best, 1e-9) << "trial " << trial;
+    }
+}
+
+TEST(TrackAssignmentTest, SolveKeepsOneDetectionPerTrack) {
+    // Both detections are closest to track 0; only one may have it
+    std::vector<TrackAssignment::Edge> edges = {
+        {0, 0, 0.1}, {0, 1, 0.6},
+        {1, 0, 0.2},
+    };
+    TrackAssignment::Workspace workspace;
+    std::vector<int> assignment;
+    TrackAssignment::solve(2, 2, edges, workspace, assignment);
+    EXPECT_EQ(assignment, (std::vector<int>{1, 0}));
+}
+
+TEST(TrackAssignmentTest, SolveLeavesRowsWithoutEdgesUnassigned) {
+    std::vector<TrackAssignment::Edge> edges = {
+        {0, 2, 0.3},
+        {2, 2, 0.1},
+        {3, 0, 0.5}, {3, 1, 0.4},
+    };
+    TrackAssignment::Workspace workspace;
+    std::vector<int> assignment;
+    TrackAssignment::solve(4, 3, edges, workspace, assignment);
+    EXPECT_EQ(assignment, (std::vector<int>{-1, -1, 2, 1}));
+
+    TrackAssignment::solve(2, 0, {}, workspace, assignment);
+    EXPECT_EQ(assignment, (std::vector<int>{-1, -1}));
+}
+
+TEST(TrackAssignmentTest, GridQueryFindsNeighboursOnly) {
+    TrackAssignment::GridIndex grid(100.0f);
+    grid.insert(cv::Point2f(10, 10), 0);
+    grid.insert(cv::Point2f(-60, 90), 1);     // Negative coordinates: a box leaving the frame
+    grid.insert(cv::Point2f(150, 150), 2);
+    grid.insert(cv::Point2f(150, 150), 2);    // Same track indexed twice
+    grid.insert(cv::Point2f(600, 400), 3);
+
+    std::vector<int> ids;
+    grid.query(cv::Point2f(50, 50), ids);
+    EXPECT_EQ(ids, (std::vector<int>{0, 1, 2}));
+
+    grid.query(cv::Point2f(620, 390), ids);
+    EXPECT_EQ(ids, (std::vector<int>{3}));
+
+    grid.query(cv::Point2f(1000, 1000), ids);
+    EXPECT_TRUE(ids.empty());
+}
+
+TEST(TrackAssignmentTest, ClearedGridForgetsPoints) {
+    TrackAssignment::GridIndex grid(100.0f);
+    grid.insert(cv::Point2f(10, 10), 0);
+    grid.clear();
+    grid.insert(cv::Point2f(20, 20), 1);
+
+    std::vector<int> ids;
+    grid.query(cv::Point2f(10, 10), ids);
+    EXPECT_EQ(ids, (std::vector<int>{1}));
+}
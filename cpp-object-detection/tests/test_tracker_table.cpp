@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "tracker_table.hpp"
+
+TEST(PositionHistoryTest, FullHistoryDropsOldestPoint) {
+    PositionHistory history;
+    for (size_t i = 0; i < PositionHistory::CAPACITY + 3; ++i) {
+        history.push_back(cv::Point2f(static_cast<float>(i), 0.0f));
+    }
+    ASSERT_EQ(history.size(), PositionHistory::CAPACITY);
+    EXPECT_EQ(history.front().x, 3.0f);
+    EXPECT_EQ(history.back().x, static_cast<float>(PositionHistory::CAPACITY + 2));
+    for (size_t i = 1; i < history.size(); ++i) {
+        EXPECT_EQ(history[i].x - history[i - 1].x, 1.0f);
+    }
+
+    history.pop_front();
+    EXPECT_EQ(history.front().x, 4.0f);
+    history.clear();
+    EXPECT_TRUE(history.empty());
+}
+
+TEST(TrackerTableTest, ReleasedSlotsAreReused) {
+    TrackerTable table(3);
+    int a = table.acquire();
+    int b = table.acquire();
+    int c = table.acquire();
+    EXPECT_EQ(table.acquire(), -1);
+    EXPECT_TRUE(table.full());
+
+    table.histories[b].push_back(cv::Point2f(1.0f, 1.0f));
+    table.set(b, TrackerTable::STATIONARY, true);
+    table.release(b);
+    EXPECT_EQ(table.slots(), (std::vector<int>{a, c}));
+
+    // The recycled slot starts clean and joins as the newest track
+    int d = table.acquire();
+    EXPECT_EQ(d, b);
+    EXPECT_TRUE(table.histories[d].empty());
+    EXPECT_FALSE(table.has(d, TrackerTable::STATIONARY));
+    EXPECT_EQ(table.slots(), (std::vector<int>{a, c, d}));
+}
+
+TEST(TrackerTableTest, ReleaseIfKeepsOrderOfRemainingSlots) {
+    TrackerTable table(5);
+    for (int i = 0; i < 5; ++i) {
+        int slot = table.acquire();
+        table.frames_since_detection[slot] = i;
+    }
+    size_t released = table.releaseIf([&table](int slot) { return table.frames_since_detection[slot] % 2 == 1; });
+    EXPECT_EQ(released, 2u);
+    EXPECT_EQ(table.slots(), (std::vector<int>{0, 2, 4}));
+    EXPECT_EQ(table.size(), 3u);
+    EXPECT_FALSE(table.full());
+}
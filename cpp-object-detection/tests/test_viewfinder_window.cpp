@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "viewfinder_window.hpp"
+#include "class_registry.hpp"
 #include "logger.hpp"
 #include <opencv2/opencv.hpp>
 
@@ -44,7 +45,7 @@ TEST_F(ViewfinderWindowTest, ShowFrameWithDetections) {
     // Create test detections
     std::vector<Detection> detections;
     Detection det;
-    det.class_name = "person";
+    det.class_id = ClassRegistry::intern("person");
     det.confidence = 0.85;
     det.bbox = cv::Rect(100, 100, 200, 300);
     detections.push_back(det);
@@ -70,7 +71,7 @@ TEST_F(ViewfinderWindowTest, ShowFrameWithStatsWithoutInitialization) {
     // Create test detections
     std::vector<Detection> detections;
     Detection det;
-    det.class_name = "cat";
+    det.class_id = ClassRegistry::intern("cat");
     det.confidence = 0.92;
     det.bbox = cv::Rect(50, 50, 150, 150);
     detections.push_back(det);
@@ -81,4 +81,78 @@ TEST_F(WebcamInterfaceTest, ResolutionParametersStored) {
     std::string info = webcam->getCameraInfo();
     // When not initialized, it returns "Camera not initialized"
     EXPECT_EQ(info, "Camera not initialized");
-}
\ No newline at end of file
+}
+TEST_F(WebcamInterfaceTest, V4l2BackendWithInvalidCameraFails) {
+    // The V4L2 backend falls back to OpenCV, which also fails for a missing device
+    auto webcam = std::make_unique<WebcamInterface>(999, 640, 480, logger);
+    webcam->setCaptureBackend("v4l2");
+    
+    EXPECT_FALSE(webcam->initialize());
+    EXPECT_FALSE(webcam->isReady());
+    EXPECT_FALSE(webcam->providesEncodedFrames());
+}
+
+TEST_F(WebcamInterfaceTest, EncodedCaptureWithoutInitialization) {
+    auto webcam = std::make_unique<WebcamInterface>(999, 640, 480, logger);
+    std::vector<uchar> jpeg;
+    
+    EXPECT_FALSE(webcam->captureEncodedFrame(jpeg));
+    EXPECT_TRUE(jpeg.empty());
+}
+
+TEST_F(WebcamInterfaceTest, DecodeFrameRoundTrip) {
+    cv::Mat original(48, 64, CV_8UC3, cv::Scalar(40, 120, 200));
+    std::vector<uchar> jpeg;
+    ASSERT_TRUE(cv::imencode(".jpg", original, jpeg));
+    
+    cv::Mat decoded;
+    EXPECT_TRUE(WebcamInterface::decodeFrame(jpeg, decoded));
+    EXPECT_EQ(decoded.cols, 64);
+    EXPECT_EQ(decoded.rows, 48);
+    EXPECT_EQ(decoded.type(), CV_8UC3);
+}
+
+TEST_F(WebcamInterfaceTest, DecodeFrameRejectsInvalidData) {
+    cv::Mat decoded;
+    EXPECT_FALSE(WebcamInterface::decodeFrame({}, decoded));
+    
+    std::vector<uchar> garbage = {0x00, 0x01, 0x02, 0x03};
+    EXPECT_FALSE(WebcamInterface::decodeFrame(garbage, decoded));
+}
+
+TEST_F(WebcamInterfaceTest, V4l2CaptureOpenMissingDevice) {
+    V4l2Capture capture(logger);
+    
+    EXPECT_FALSE(capture.open(999, 640, 480, 30));
+    EXPECT_FALSE(capture.isOpen());
+    
+    std::vector<uint8_t> jpeg;
+    EXPECT_FALSE(capture.grab(jpeg));
+    capture.close();  // Safe after a failed open
+}
+
+TEST_F(WebcamInterfaceTest, DecodeFrameAtReducedScale) {
+    cv::Mat original(480, 640, CV_8UC3, cv::Scalar(40, 120, 200));
+    std::vector<uchar> jpeg;
+    ASSERT_TRUE(cv::imencode(".jpg", original, jpeg));
+    
+    cv::Mat decoded;
+    ASSERT_TRUE(WebcamInterface::decodeFrame(jpeg, decoded, 2));
+    EXPECT_EQ(decoded.cols, 320);
+    EXPECT_EQ(decoded.rows, 240);
+    
+    ASSERT_TRUE(WebcamInterface::decodeFrame(jpeg, decoded, 8));
+    EXPECT_EQ(decoded.cols, 80);
+    EXPECT_EQ(decoded.rows, 60);
+}
+
+TEST_F(WebcamInterfaceTest, SelectDecodeScaleCoversDetectionResolution) {
+    EXPECT_EQ(WebcamInterface::selectDecodeScale(1.0), 1);
+    EXPECT_EQ(WebcamInterface::selectDecodeScale(0.75), 1);
+    EXPECT_EQ(WebcamInterface::selectDecodeScale(0.5), 2);
+    EXPECT_EQ(WebcamInterface::selectDecodeScale(0.3), 2);
+    EXPECT_EQ(WebcamInterface::selectDecodeScale(0.25), 4);
+    EXPECT_EQ(WebcamInterface::selectDecodeScale(0.2), 4);
+    EXPECT_EQ(WebcamInterface::selectDecodeScale(0.125), 8);
+    EXPECT_EQ(WebcamInterface::selectDecodeScale(0.1), 8);
+}
@@ -0,0 +1,466 @@
+#include <gtest/gtest.h>
+#include "yolo_utils.hpp"
+#include <opencv2/opencv.hpp>
+#include <opencv2/dnn.hpp>
+#include <vector>
+
+TEST(YoloUtilsTest, InputSizeFollowsScaleFactor) {
+    cv::Size hd(1280, 720);
+
+    EXPECT_EQ(YoloUtils::computeInputSize(hd, 0.25, 640), 320);
+    EXPECT_EQ(YoloUtils::computeInputSize(hd, 0.33, 640), 416);
+    EXPECT_EQ(YoloUtils::computeInputSize(hd, 0.375, 640), 480);
+    EXPECT_EQ(YoloUtils::computeInputSize(hd, 0.5, 640), 640);
+}
+
+TEST(YoloUtilsTest, InputSizeIsStrideAlignedAndClamped) {
+    // Never above the nominal model size
+    EXPECT_EQ(YoloUtils::computeInputSize(cv::Size(1920, 1080), 1.0, 640), 640);
+    EXPECT_EQ(YoloUtils::computeInputSize(cv::Size(1920, 1080), 1.0, 832), 832);
+
+    // Never below the minimum useful size
+    EXPECT_EQ(YoloUtils::computeInputSize(cv::Size(640, 480), 0.1, 640), YoloUtils::MIN_INPUT_SIZE);
+
+    for (double scale = 0.1; scale <= 1.0; scale += 0.05) {
+        int size = YoloUtils::computeInputSize(cv::Size(1280, 720), scale, 832);
+        EXPECT_EQ(size % YoloUtils::STRIDE, 0) << "scale " << scale;
+    }
+}
+
+TEST(YoloUtilsTest, InputSizeFallsBackToNominalForInvalidInput) {
+    EXPECT_EQ(YoloUtils::computeInputSize(cv::Size(0, 0), 0.5, 640), 640);
+    EXPECT_EQ(YoloUtils::computeInputSize(cv::Size(1280, 720), 0.0, 640), 640);
+}
+
+TEST(YoloUtilsTest, LetterboxPreservesAspectRatio) {
+    auto letterbox = YoloUtils::computeLetterbox(cv::Size(1280, 720), 320);
+
+    EXPECT_EQ(letterbox.input_size, cv::Size(320, 320));
+    EXPECT_FLOAT_EQ(letterbox.scale, 0.25f);
+    EXPECT_EQ(letterbox.resized, cv::Size(320, 180));
+    EXPECT_EQ(letterbox.pad_x, 0);
+    EXPECT_EQ(letterbox.pad_y, 70);
+}
+
+namespace {
+
+// Reference path: resize, pad, then let OpenCV build the blob
+cv::Mat referenceBlob(const cv::Mat& frame, const YoloUtils::Letterbox& letterbox) {
+    cv::Mat resized;
+    cv::resize(frame, resized, letterbox.resized, 0, 0, cv::INTER_LINEAR);
+
+    cv::Mat padded;
+    int right = letterbox.input_size.width - letterbox.pad_x - letterbox.resized.width;
+    int bottom = letterbox.input_size.height - letterbox.pad_y - letterbox.resized.height;
+    cv::copyMakeBorder(resized, padded, letterbox.pad_y, bottom, letterbox.pad_x, right,
+                       cv::BORDER_CONSTANT, cv::Scalar::all(YoloUtils::LETTERBOX_PAD_VALUE));
+
+    return cv::dnn::blobFromImage(padded, 1.0 / 255.0, cv::Size(), cv::Scalar(), true, false, CV_32F);
+}
+
+cv::Mat randomFrame(int rows, int cols) {
+    cv::Mat frame(rows, cols, CV_8UC3);
+    cv::randu(frame, cv::Scalar::all(0), cv::Scalar::all(256));
+    return frame;
+}
+
+}  // namespace
+
+TEST(YoloUtilsTest, LetterboxToBlobMatchesBlobFromImage) {
+    cv::Mat frame = randomFrame(720, 1280);
+    auto letterbox = YoloUtils::computeLetterbox(frame.size(), 320);
+
+    cv::Mat resize_buffer, blob;
+    YoloUtils::letterboxToBlob(frame, letterbox, 1.0f / 255.0f, resize_buffer, blob);
+
+    cv::Mat expected = referenceBlob(frame, letterbox);
+    ASSERT_EQ(blob.dims, 4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(blob.size[i], expected.size[i]);
+    }
+    EXPECT_LT(cv::norm(blob, expected, cv::NORM_INF), 1e-5);
+}
+
+TEST(YoloUtilsTest, LetterboxToBlobHandlesPortraitAndOddWidths) {
+    // Odd content width exercises the scalar tail after the SIMD loop
+    cv::Mat frame = randomFrame(477, 251);
+    auto letterbox = YoloUtils::computeLetterbox(frame.size(), 416);
+    EXPECT_GT(letterbox.pad_x, 0);
+
+    cv::Mat resize_buffer, blob;
+    YoloUtils::letterboxToBlob(frame, letterbox, 1.0f / 255.0f, resize_buffer, blob);
+
+    EXPECT_LT(cv::norm(blob, referenceBlob(frame, letterbox), cv::NORM_INF), 1e-5);
+}
+
+TEST(YoloUtilsTest, LetterboxToBlobReusesBuffers) {
+    cv::Mat frame = randomFrame(720, 1280);
+    auto letterbox = YoloUtils::computeLetterbox(frame.size(), 320);
+
+    cv::Mat resize_buffer, blob;
+    YoloUtils::letterboxToBlob(frame, letterbox, 1.0f / 255.0f, resize_buffer, blob);
+    const uchar* blob_data = blob.data;
+    const uchar* resize_data = resize_buffer.data;
+
+    YoloUtils::letterboxToBlob(frame, letterbox, 1.0f / 255.0f, resize_buffer, blob);
+    EXPECT_EQ(blob.data, blob_data);
+    EXPECT_EQ(resize_buffer.data, resize_data);
+}
+
+TEST(YoloUtilsTest, LetterboxToBatchBlobStacksSingleBlobs) {
+    // Each slice of the batch must equal the single-frame tensor, even for mixed frame sizes
+    std::vector<cv::Mat> frames = {randomFrame(720, 1280), randomFrame(477, 251), randomFrame(320, 320)};
+    std::vector<YoloUtils::Letterbox> letterboxes;
+    for (const auto& frame : frames) {
+        letterboxes.push_back(YoloUtils::computeLetterbox(frame.size(), 320));
+    }
+
+    cv::Mat resize_buffer, batch_blob;
+    YoloUtils::letterboxToBatchBlob(frames, letterboxes, 1.0f / 255.0f, resize_buffer, batch_blob);
+    ASSERT_EQ(batch_blob.dims, 4);
+    EXPECT_EQ(batch_blob.size[0], 3);
+    EXPECT_EQ(batch_blob.size[1], 3);
+    EXPECT_EQ(batch_blob.size[2], 320);
+    EXPECT_EQ(batch_blob.size[3], 320);
+
+    const size_t image_size = 3 * 320 * 320;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        cv::Mat single_blob;
+        YoloUtils::letterboxToBlob(frames[i], letterboxes[i], 1.0f / 255.0f, resize_buffer, single_blob);
+        cv::Mat slice(1, static_cast<int>(image_size), CV_32F, batch_blob.ptr<float>() + i * image_size);
+        cv::Mat expected(1, static_cast<int>(image_size), CV_32F, single_blob.ptr<float>());
+        EXPECT_EQ(cv::norm(slice, expected, cv::NORM_INF), 0.0);
+    }
+}
+
+TEST(YoloUtilsTest, PrepareBatchSkipsEmptyFramesAndScattersBack) {
+    std::vector<cv::Mat> frames = {cv::Mat(), randomFrame(720, 1280), cv::Mat(), randomFrame(360, 640)};
+    YoloUtils::Batch batch;
+    cv::Mat resize_buffer, blob;
+    ASSERT_TRUE(YoloUtils::prepareBatch(frames, 0, 0.5, 640, 1.0f / 255.0f, batch, resize_buffer, blob));
+
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch.indices, (std::vector<size_t>{1, 3}));
+    EXPECT_EQ(batch.input_size, 640);  // Taken from the first non-empty frame
+    EXPECT_EQ(blob.size[0], 2);
+    EXPECT_EQ(batch.letterboxes[1].input_size, cv::Size(640, 640));
+
+    std::vector<std::vector<Detection>> results(frames.size());
+    YoloUtils::scatterBatch(batch, results, [](size_t b) {
+        return std::vector<Detection>(b + 1);
+    });
+    EXPECT_TRUE(results[0].empty());
+    EXPECT_EQ(results[1].size(), 1u);
+    EXPECT_TRUE(results[2].empty());
+    EXPECT_EQ(results[3].size(), 2u);
+
+    // A fixed input size wins over the scale factor; all-empty input has nothing to run
+    ASSERT_TRUE(YoloUtils::prepareBatch(frames, 320, 1.0, 640, 1.0f / 255.0f, batch, resize_buffer, blob));
+    EXPECT_EQ(batch.input_size, 320);
+    EXPECT_FALSE(YoloUtils::prepareBatch({cv::Mat(), cv::Mat()}, 0, 1.0, 640, 1.0f / 255.0f,
+                                         batch, resize_buffer, blob));
+}
+
+TEST(YoloUtilsTest, ConvertRowSwapsAndScales) {
+    constexpr int WIDTH = 37;
+    std::vector<uchar> bgr(WIDTH * 3);
+    for (int x = 0; x < WIDTH; ++x) {
+        bgr[x * 3] = static_cast<uchar>(x);            // blue
+        bgr[x * 3 + 1] = static_cast<uchar>(100 + x);  // green
+        bgr[x * 3 + 2] = static_cast<uchar>(200 + x);  // red
+    }
+
+    std::vector<float> red(WIDTH), green(WIDTH), blue(WIDTH);
+    YoloUtils::convertBgrRowToPlanes(bgr.data(), red.data(), green.data(), blue.data(), WIDTH, 0.5f);
+
+    for (int x = 0; x < WIDTH; ++x) {
+        EXPECT_FLOAT_EQ(blue[x], x * 0.5f);
+        EXPECT_FLOAT_EQ(green[x], (100 + x) * 0.5f);
+        EXPECT_FLOAT_EQ(red[x], (200 + x) * 0.5f);
+    }
+}
+
+TEST(YoloUtilsTest, UnprojectBoxRoundTrips) {
+    cv::Size frame_size(1280, 720);
+    auto letterbox = YoloUtils::computeLetterbox(frame_size, 320);
+
+    // Box at (400,200) 200x100 in the frame -> network coordinates
+    float center_x = (400 + 100) * letterbox.scale + letterbox.pad_x;
+    float center_y = (200 + 50) * letterbox.scale + letterbox.pad_y;
+    float width = 200 * letterbox.scale;
+    float height = 100 * letterbox.scale;
+
+    cv::Rect box = YoloUtils::unprojectBox(center_x, center_y, width, height, letterbox, frame_size);
+    EXPECT_NEAR(box.x, 400, 1);
+    EXPECT_NEAR(box.y, 200, 1);
+    EXPECT_NEAR(box.width, 200, 1);
+    EXPECT_NEAR(box.height, 100, 1);
+}
+
+TEST(YoloUtilsTest, UnprojectBoxClipsToFrame) {
+    cv::Size frame_size(1280, 720);
+    auto letterbox = YoloUtils::computeLetterbox(frame_size, 320);
+
+    // Box reaching into the top padding and past the right edge
+    cv::Rect box = YoloUtils::unprojectBox(315.0f, 75.0f, 20.0f, 20.0f, letterbox, frame_size);
+    EXPECT_GE(box.y, 0);
+    EXPECT_LE(box.x + box.width, frame_size.width);
+}
+
+namespace {
+
+// Builds a [rows, 5 + classes] YOLOv5 output with every row as background
+struct SyntheticOutput {
+    SyntheticOutput(int rows, int num_classes)
+        : rows(rows), row_size(num_classes + 5), data(static_cast<size_t>(rows) * (num_classes + 5), 0.0f) {}
+
+    float* row(int index) { return data.data() + static_cast<size_t>(index) * row_size; }
+
+    void setBox(int index, float objectness, int class_id, float class_score) {
+        float* r = row(index);
+        r[0] = 100.0f;
+        r[1] = 120.0f;
+        r[2] = 40.0f;
+        r[3] = 60.0f;
+        r[4] = objectness;
+        r[5 + class_id] = class_score;
+    }
+
+    int rows;
+    int row_size;
+    std::vector<float> data;
+};
+
+}  // namespace
+
+TEST(YoloUtilsTest, DecodeSkipsLowObjectness) {
+    SyntheticOutput output(103, 80);  // Not a multiple of the block size
+    output.setBox(5, 0.3f, 0, 0.99f);    // Objectness below threshold
+    output.setBox(50, 0.9f, 2, 0.9f);
+    output.setBox(102, 0.8f, 0, 0.95f);  // In the scalar tail
+
+    std::vector<YoloUtils::Candidate> candidates;
+    YoloUtils::decodeYoloV5(output.data.data(), output.rows, output.row_size, {}, 0.5f, candidates);
+
+    ASSERT_EQ(candidates.size(), 2u);
+    EXPECT_EQ(candidates[0].class_id, 2);
+    EXPECT_NEAR(candidates[0].confidence, 0.81f, 1e-5);
+    EXPECT_EQ(candidates[1].class_id, 0);
+    EXPECT_FLOAT_EQ(candidates[1].center_x, 100.0f);
+    EXPECT_FLOAT_EQ(candidates[1].height, 60.0f);
+}
+
+TEST(YoloUtilsTest, DecodeKeepsEveryPassingRowOfABlock) {
+    SyntheticOutput output(32, 80);
+    output.setBox(0, 0.9f, 1, 0.9f);
+    output.setBox(15, 0.5f, 2, 1.0f);    // Exactly at the threshold, last row of the first block
+    output.setBox(16, 0.9f, 3, 0.9f);    // First row of the second block
+    output.setBox(31, 0.9f, 4, 0.9f);
+
+    std::vector<YoloUtils::Candidate> candidates;
+    YoloUtils::decodeYoloV5(output.data.data(), output.rows, output.row_size, {}, 0.5f, candidates);
+
+    ASSERT_EQ(candidates.size(), 4u);
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        EXPECT_EQ(candidates[i].class_id, static_cast<int>(i) + 1);
+    }
+}
+
+TEST(YoloUtilsTest, DecodeRestrictsArgmaxToTargetClasses) {
+    SyntheticOutput output(8, 80);
+    output.setBox(0, 0.9f, 62, 0.95f);   // "tv" wins overall...
+    output.row(0)[5 + 56] = 0.7f;        // ...but "chair" is the best target class
+    output.setBox(1, 0.9f, 62, 0.95f);   // Only non-target classes score
+
+    std::vector<YoloUtils::Candidate> candidates;
+    YoloUtils::decodeYoloV5(output.data.data(), output.rows, output.row_size, {0, 56}, 0.5f, candidates);
+
+    ASSERT_EQ(candidates.size(), 1u);
+    EXPECT_EQ(candidates[0].class_id, 56);
+    EXPECT_NEAR(candidates[0].confidence, 0.63f, 1e-5);
+}
+
+TEST(YoloUtilsTest, DecodeMatchesScalarReference) {
+    SyntheticOutput output(1000, 80);
+    cv::RNG rng(7);
+    for (float& value : output.data) {
+        value = static_cast<float>(rng.uniform(0.0, 1.0));
+    }
+
+    std::vector<YoloUtils::Candidate> candidates;
+    YoloUtils::decodeYoloV5(output.data.data(), output.rows, output.row_size, {}, 0.6f, candidates);
+
+    // Straightforward per-row scan the decoder must agree with
+    size_t expected = 0;
+    for (int i = 0; i < output.rows; ++i) {
+        const float* r = output.row(i);
+        if (r[4] < 0.6f) {
+            continue;
+        }
+        int best = -1;
+        float best_score = 0.0f;
+        for (int c = 0; c < 80; ++c) {
+            if (r[5 + c] > best_score) {
+                best_score = r[5 + c];
+                best = c;
+            }
+        }
+        if (r[4] * best_score < 0.6f) {
+            continue;
+        }
+        ASSERT_LT(expected, candidates.size());
+        EXPECT_EQ(candidates[expected].class_id, best);
+        EXPECT_FLOAT_EQ(candidates[expected].confidence, r[4] * best_score);
+        expected++;
+    }
+    EXPECT_EQ(candidates.size(), expected);
+}
+
+TEST(YoloUtilsTest, DecodeReusesCandidateBuffer) {
+    SyntheticOutput output(16, 80);
+    output.setBox(3, 0.9f, 0, 0.9f);
+
+    std::vector<YoloUtils::Candidate> candidates;
+    candidates.reserve(64);
+    const auto* buffer = candidates.data();
+
+    YoloUtils::decodeYoloV5(output.data.data(), output.rows, output.row_size, {}, 0.5f, candidates);
+    YoloUtils::decodeYoloV5(output.data.data(), output.rows, output.row_size, {}, 0.5f, candidates);
+
+    EXPECT_EQ(candidates.size(), 1u);
+    EXPECT_EQ(candidates.data(), buffer);
+}
+
+namespace {
+
+// Builds a channel-major [4 + classes, anchors] YOLOv8 output
+struct SyntheticV8Output {
+    SyntheticV8Output(int num_classes, int anchors)
+        : channels(num_classes + 4), anchors(anchors),
+          data(static_cast<size_t>(num_classes + 4) * anchors, 0.0f) {}
+
+    float& at(int channel, int anchor) { return data[static_cast<size_t>(channel) * anchors + anchor]; }
+
+    void setBox(int anchor, int class_id, float score) {
+        at(0, anchor) = 200.0f;
+        at(1, anchor) = 150.0f;
+        at(2, anchor) = 50.0f;
+        at(3, anchor) = 80.0f;
+        at(4 + class_id, anchor) = score;
+    }
+
+    int channels;
+    int anchors;
+    std::vector<float> data;
+};
+
+}  // namespace
+
+TEST(YoloUtilsTest, DecodeV8ReadsChannelMajorLayout) {
+    SyntheticV8Output output(80, 8400);
+    output.setBox(17, 2, 0.9f);
+    output.setBox(8399, 0, 0.7f);  // Last anchor, past any SIMD block
+    output.setBox(4000, 5, 0.3f);  // Below threshold
+
+    std::vector<float> best_scores;
+    std::vector<YoloUtils::Candidate> candidates;
+    YoloUtils::decodeYoloV8(output.data.data(), output.channels, output.anchors, {}, 0.5f,
+                            best_scores, candidates);
+
+    ASSERT_EQ(candidates.size(), 2u);
+    EXPECT_EQ(candidates[0].class_id, 2);
+    EXPECT_FLOAT_EQ(candidates[0].confidence, 0.9f);
+    EXPECT_FLOAT_EQ(candidates[0].center_x, 200.0f);
+    EXPECT_FLOAT_EQ(candidates[0].height, 80.0f);
+    EXPECT_EQ(candidates[1].class_id, 0);
+}
+
+TEST(YoloUtilsTest, DecodeV8RestrictsToTargetClasses) {
+    SyntheticV8Output output(80, 64);
+    output.setBox(3, 62, 0.95f);   // Non-target class wins overall...
+    output.at(4 + 56, 3) = 0.6f;   // ...target class still above threshold
+    output.setBox(9, 62, 0.95f);   // Only a non-target class
+
+    std::vector<float> best_scores;
+    std::vector<YoloUtils::Candidate> candidates;
+    YoloUtils::decodeYoloV8(output.data.data(), output.channels, output.anchors, {0, 56}, 0.5f,
+                            best_scores, candidates);
+
+    ASSERT_EQ(candidates.size(), 1u);
+    EXPECT_EQ(candidates[0].class_id, 56);
+    EXPECT_FLOAT_EQ(candidates[0].confidence, 0.6f);
+}
+
+TEST(YoloUtilsTest, DecodeV8TiesGoToLowestClassId) {
+    SyntheticV8Output output(80, 64);
+    output.setBox(5, 7, 0.8f);
+    output.at(4 + 3, 5) = 0.8f;
+    output.setBox(20, 56, 0.9f);
+    output.at(4 + 0, 20) = 0.9f;
+
+    std::vector<float> best_scores;
+    std::vector<YoloUtils::Candidate> candidates;
+    YoloUtils::decodeYoloV8(output.data.data(), output.channels, output.anchors, {}, 0.5f,
+                            best_scores, candidates);
+    ASSERT_EQ(candidates.size(), 2u);
+    EXPECT_EQ(candidates[0].class_id, 3);
+    EXPECT_EQ(candidates[1].class_id, 0);
+
+    // Target classes listed out of order still resolve to the lowest id
+    YoloUtils::decodeYoloV8(output.data.data(), output.channels, output.anchors, {56, 7, 3, 0}, 0.5f,
+                            best_scores, candidates);
+    ASSERT_EQ(candidates.size(), 2u);
+    EXPECT_EQ(candidates[0].class_id, 3);
+    EXPECT_EQ(candidates[1].class_id, 0);
+}
+
+TEST(YoloUtilsTest, DecodeV8MatchesTransposedReference) {
+    SyntheticV8Output output(80, 1001);
+    cv::RNG rng(11);
+    for (float& value : output.data) {
+        value = static_cast<float>(rng.uniform(0.0, 1.0));
+    }
+
+    std::vector<float> best_scores;
+    std::vector<YoloUtils::Candidate> candidates;
+    YoloUtils::decodeYoloV8(output.data.data(), output.channels, output.anchors, {}, 0.98f,
+                            best_scores, candidates);
+
+    size_t expected = 0;
+    for (int a = 0; a < output.anchors; ++a) {
+        int best = -1;
+        float best_score = 0.0f;
+        for (int c = 0; c < 80; ++c) {
+            if (output.at(4 + c, a) > best_score) {
+                best_score = output.at(4 + c, a);
+                best = c;
+            }
+        }
+        if (best_score < 0.98f) {
+            continue;
+        }
+        ASSERT_LT(expected, candidates.size());
+        EXPECT_EQ(candidates[expected].class_id, best);
+        EXPECT_FLOAT_EQ(candidates[expected].center_x, output.at(0, a));
+        expected++;
+    }
+    EXPECT_EQ(candidates.size(), expected);
+}
+
+TEST(YoloUtilsTest, ResolveClassIdsSkipsUnknownNames) {
+    std::vector<std::string> class_names = {"person", "bicycle", "car", "dog"};
+
+    auto ids = YoloUtils::resolveClassIds({"dog", "fox", "person", "dog"}, class_names);
+
+    EXPECT_EQ(ids, (std::vector<int>{0, 3}));
+    EXPECT_TRUE(YoloUtils::resolveClassIds({}, class_names).empty());
+}
+
+TEST(YoloUtilsTest, CocoClassNamesInModelOrder) {
+    auto names = YoloUtils::cocoClassNames();
+
+    ASSERT_EQ(names.size(), 80u);
+    EXPECT_EQ(names[0], "person");
+    EXPECT_EQ(names[56], "chair");
+    EXPECT_EQ(names[79], "toothbrush");
+}
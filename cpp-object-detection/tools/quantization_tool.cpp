@@ -0,0 +1,224 @@
+/**
+ * Offline helper for INT8/FP16 model quantization
+ *
+ *   quantization_tool calibrate FRAMES_DIR OUTPUT_DIR [input-size|model-type] [max-frames]
+ *       Preprocesses captured frames exactly like the detection models
+ *       (letterbox, RGB, 1/255, NCHW) and writes one raw float32 tensor per
+ *       frame for scripts/quantize_model.py to calibrate on. Given a model
+ *       type instead of a size, uses that model's nominal input size.
+ *
+ *   quantization_tool compare REFERENCE.onnx CANDIDATE.onnx FRAMES_DIR
+ *                             [model-type] [backend] [confidence] [detection-scale]
+ *       Runs both models over the frames and reports how well the candidate's
+ *       detections agree with the reference's, plus the speedup.
+ *
+ * scripts/quantize_model.sh runs calibrate -> quantize -> compare in one go.
+ */
+#include "detection_agreement.hpp"
+#include "detection_model_interface.hpp"
+#include "logger.hpp"
+#include "onnx_model_info.hpp"
+#include "yolo_utils.hpp"
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> listFrames(const std::string& directory) {
+    std::vector<std::string> frames;
+    for (const char* pattern : {"*.jpg", "*.jpeg", "*.png", "*.bmp"}) {
+        std::vector<std::string> matches;
+        cv::glob(directory + "/" + pattern, matches, false);
+        frames.insert(frames.end(), matches.begin(), matches.end());
+    }
+    std::sort(frames.begin(), frames.end());
+    return frames;
+}
+
+// Input side from a number ("832") or a model type ("yolov5l"); 0 if neither
+int parseInputSize(const std::string& argument) {
+    if (!argument.empty() && std::all_of(argument.begin(), argument.end(), [](unsigned char c) { return std::isdigit(c) != 0; })) {
+        return std::atoi(argument.c_str());
+    }
+    try {
+        auto model_type = DetectionModelFactory::parseModelType(argument);
+        auto logger = std::make_shared<Logger>("quantization_tool.log", false);
+        return DetectionModelFactory::createModel(model_type, logger)->getInputSize();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 0;
+    }
+}
+
+int calibrate(int argc, char** argv) {
+    if (argc < 4) {
+        std::cerr << "Usage: " << argv[0] << " calibrate FRAMES_DIR OUTPUT_DIR [input-size|model-type] [max-frames]\n";
+        return 1;
+    }
+    const std::string frames_dir = argv[2];
+    const std::string output_dir = argv[3];
+    const int input_size = argc > 4 ? parseInputSize(argv[4]) : 640;
+    const int max_frames = argc > 5 ? std::atoi(argv[5]) : 200;
+    if (input_size < YoloUtils::MIN_INPUT_SIZE || input_size % YoloUtils::STRIDE != 0 || max_frames <= 0) {
+        std::cerr << "input-size must be a multiple of " << YoloUtils::STRIDE << " (>= "
+                  << YoloUtils::MIN_INPUT_SIZE << ") and max-frames positive\n";
+        return 1;
+    }
+
+    std::vector<std::string> frames = listFrames(frames_dir);
+    if (frames.empty()) {
+        std::cerr << "No frames found in " << frames_dir << "\n";
+        return 1;
+    }
+
+    // Spread the selection over the whole capture (day/night, empty/busy scenes)
+    const size_t count = std::min(frames.size(), static_cast<size_t>(max_frames));
+    cv::Mat resize_buffer, blob;
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const std::string& path = frames[i * frames.size() / count];
+        cv::Mat frame = cv::imread(path);
+        if (frame.empty()) {
+            std::cerr << "Skipping unreadable frame: " << path << "\n";
+            continue;
+        }
+        auto letterbox = YoloUtils::computeLetterbox(frame.size(), input_size);
+        YoloUtils::letterboxToBlob(frame, letterbox, 1.0f / 255.0f, resize_buffer, blob);
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "/calib_%04zu.bin", written);
+        std::ofstream out(output_dir + name, std::ios::binary);
+        if (!out.is_open()) {
+            std::cerr << "Cannot write to " << output_dir << "\n";
+            return 1;
+        }
+        out.write(reinterpret_cast<const char*>(blob.ptr<float>()),
+                  static_cast<std::streamsize>(blob.total() * sizeof(float)));
+        written++;
+    }
+
+    std::cout << "Wrote " << written << " calibration tensors (1x3x" << input_size << "x" << input_size
+              << ", float32) to " << output_dir << "\n";
+    return written > 0 ? 0 : 1;
+}
+
+int compare(int argc, char** argv) {
+    if (argc < 5) {
+        std::cerr << "Usage: " << argv[0] << " compare REFERENCE.onnx CANDIDATE.onnx FRAMES_DIR"
+                  << " [model-type] [backend] [confidence] [detection-scale]\n";
+        return 1;
+    }
+    const std::string reference_path = argv[2];
+    const std::string candidate_path = argv[3];
+    const std::string frames_dir = argv[4];
+    const std::string model_name = argc > 5 ? argv[5] : "yolov5s";
+    const std::string backend_name = argc > 6 ? argv[6] : "opencv";
+    const double confidence = argc > 7 ? std::atof(argv[7]) : 0.5;
+    const double detection_scale = argc > 8 ? std::atof(argv[8]) : 1.0;
+
+    DetectionModelFactory::ModelType model_type;
+    DetectionModelFactory::BackendOptions options;
+    try {
+        model_type = DetectionModelFactory::parseModelType(model_name);
+        options.backend = DetectionModelFactory::parseBackend(backend_name);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    std::vector<std::string> frames = listFrames(frames_dir);
+    if (frames.empty()) {
+        std::cerr << "No frames found in " << frames_dir << "\n";
+        return 1;
+    }
+
+    auto logger = std::make_shared<Logger>("quantization_tool.log", false);
+    auto reference = DetectionModelFactory::createModel(model_type, logger, options);
+    auto candidate = DetectionModelFactory::createModel(model_type, logger, options);
+    if (!reference->initialize(reference_path, "", "", confidence, detection_scale) ||
+        !candidate->initialize(candidate_path, "", "", confidence, detection_scale)) {
+        std::cerr << "Failed to load models (see quantization_tool.log)\n";
+        return 1;
+    }
+    reference->warmUp();
+    candidate->warmUp();
+
+    DetectionAgreement agreement(0.5);
+    double reference_ms = 0.0;
+    double candidate_ms = 0.0;
+    for (const auto& path : frames) {
+        cv::Mat frame = cv::imread(path);
+        if (frame.empty()) {
+            continue;
+        }
+        auto start = std::chrono::steady_clock::now();
+        auto reference_detections = reference->detect(frame);
+        auto middle = std::chrono::steady_clock::now();
+        auto candidate_detections = candidate->detect(frame);
+        auto end = std::chrono::steady_clock::now();
+        reference_ms += std::chrono::duration<double, std::milli>(middle - start).count();
+        candidate_ms += std::chrono::duration<double, std::milli>(end - middle).count();
+        agreement.addFrame(reference_detections, candidate_detections);
+    }
+    if (agreement.frames() == 0) {
+        std::cerr << "No readable frames in " << frames_dir << "\n";
+        return 1;
+    }
+
+    const double frame_count = static_cast<double>(agreement.frames());
+    const auto& totals = agreement.totals();
+    std::cout << std::fixed << std::setprecision(3)
+              << "Reference:  " << reference_path << " ["
+              << OnnxModelInfo::describe(OnnxModelInfo::inspect(reference_path)) << "]\n"
+              << "Candidate:  " << candidate_path << " ["
+              << OnnxModelInfo::describe(OnnxModelInfo::inspect(candidate_path)) << "]\n"
+              << "Backend:    " << DetectionModelFactory::backendToString(options.backend) << "\n"
+              << "Frames:     " << agreement.frames() << " (confidence >= " << confidence << ", IoU >= 0.5)\n\n"
+              << "Detections: " << totals.reference << " reference, " << totals.candidate << " candidate, "
+              << totals.matched << " matched\n"
+              << "Recall:     " << agreement.recall() << "  (reference detections still found)\n"
+              << "Precision:  " << agreement.precision() << "  (candidate detections confirmed)\n"
+              << "F1:         " << agreement.f1() << "\n"
+              << "Mean IoU:   " << agreement.meanIou() << "\n"
+              << "Mean |dConf|: " << agreement.meanConfidenceDelta() << "\n\n"
+              << std::setprecision(1)
+              << "Latency:    " << reference_ms / frame_count << " ms -> " << candidate_ms / frame_count
+              << " ms per frame (" << std::setprecision(2)
+              << (candidate_ms > 0.0 ? reference_ms / candidate_ms : 0.0) << "x)\n\n";
+
+    std::cout << "  " << std::left << std::setw(16) << "class"
+              << std::right << std::setw(10) << "reference" << std::setw(11) << "candidate"
+              << std::setw(9) << "matched" << std::setw(9) << "recall" << "\n";
+    for (const auto& entry : agreement.perClass()) {
+        const auto& counts = entry.second;
+        double recall = counts.reference > 0 ? static_cast<double>(counts.matched) / counts.reference : 1.0;
+        std::cout << "  " << std::left << std::setw(16) << entry.first
+                  << std::right << std::setw(10) << counts.reference << std::setw(11) << counts.candidate
+                  << std::setw(9) << counts.matched << std::setw(9) << std::setprecision(3) << recall << "\n";
+    }
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::string command = argc > 1 ? argv[1] : "";
+    if (command == "calibrate") {
+        return calibrate(argc, argv);
+    } else if (command == "compare") {
+        return compare(argc, argv);
+    }
+    std::cerr << "Usage: " << argv[0] << " calibrate|compare ...\n"
+              << "  calibrate FRAMES_DIR OUTPUT_DIR [input-size|model-type] [max-frames]\n"
+              << "  compare REFERENCE.onnx CANDIDATE.onnx FRAMES_DIR [model-type] [backend] [confidence] [detection-scale]\n";
+    return 1;
+}